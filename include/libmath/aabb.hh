@@ -0,0 +1,67 @@
+#ifndef MICRO_LIBMATH_AABB_HH__GUARD
+#define MICRO_LIBMATH_AABB_HH__GUARD
+
+#include "vector3.hh"
+
+namespace micro::math
+{
+	template <class T,
+		  class F = std::enable_if_t<std::is_arithmetic_v<T>, int>>
+	struct TAABB
+	{
+		typedef std::remove_reference_t<std::remove_cv_t<T>> type;
+
+		//
+		//
+
+		constexpr TAABB(TVector3<T> const &lower = {},
+				TVector3<T> const &upper = {}) noexcept
+		{
+			data[0] = lower;
+			data[1] = upper;
+		}
+
+		constexpr TVector3<T> &lower() noexcept { return data[0]; }
+		constexpr TVector3<T> &upper() noexcept { return data[1]; }
+		constexpr TVector3<T> const &lower() const noexcept { return data[0]; }
+		constexpr TVector3<T> const &upper() const noexcept { return data[1]; }
+
+		TVector3<T> data[2] = {};
+	};
+
+	using AABB = TAABB<float>;
+
+	// ----------------------------------------------------------------- //
+
+	template <class T>
+	constexpr TVector3<T> center(TAABB<T> const &b) noexcept
+	{
+		return (b.lower() + b.upper()) / T(2);
+	}
+
+	template <class T>
+	constexpr TVector3<T> extent(TAABB<T> const &b) noexcept
+	{
+		return b.upper() - b.lower();
+	}
+
+	template <class T>
+	constexpr TAABB<T> merge(TAABB<T> const &b, TVector3<T> const &p) noexcept
+	{
+		return TAABB<T>{{p.x() < b.lower().x() ? p.x() : b.lower().x(),
+				 p.y() < b.lower().y() ? p.y() : b.lower().y(),
+				 p.z() < b.lower().z() ? p.z() : b.lower().z()},
+				{p.x() > b.upper().x() ? p.x() : b.upper().x(),
+				 p.y() > b.upper().y() ? p.y() : b.upper().y(),
+				 p.z() > b.upper().z() ? p.z() : b.upper().z()}};
+	}
+
+	template <class T>
+	constexpr bool contains(TAABB<T> const &b, TVector3<T> const &p) noexcept
+	{
+		return all(b.lower() <= p) &&
+		       all(p <= b.upper());
+	}
+}
+
+#endif
\ No newline at end of file
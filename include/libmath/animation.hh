@@ -0,0 +1,595 @@
+#ifndef MICRO_LIBMATH_ANIMATION_HH__GUARD
+#define MICRO_LIBMATH_ANIMATION_HH__GUARD
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include "batch.hh"
+#include "matrix4x4.hh"
+#include "matrix4xN_transform.hh"
+#include "vector3.hh"
+#include "vector4.hh"
+
+//
+// A clip holds three tracks per bone (translation, rotation, scale), each
+// reduced to the keys a linear (rotation: normalized linear) interpolation
+// needs to stay within a tolerance, with every component quantized to 16
+// bits inside the range of its track. A key is 16 bytes against 64 for a
+// raw matrix, and most tracks keep only a few keys.
+//
+// The keys of all tracks share one array, ordered by the time they are
+// first needed: key k of a track comes right after the keys needed before
+// key k - 1 of that track is reached. A cursor sampling forward in time
+// therefore reads the array once, front to back.
+//
+
+namespace micro::math
+{
+	/**
+	 * @brief One key of a compressed track, value[c] = lo[c] + q * step[c]
+	 *        with the range of the track
+	 */
+	struct AnimationKey
+	{
+		float time = 0.f;
+		std::uint32_t track = 0;
+		std::uint16_t value[4] = {};
+	};
+
+	constexpr std::size_t animation_translation = 0;
+	constexpr std::size_t animation_rotation = 1;
+	constexpr std::size_t animation_scale = 2;
+	constexpr std::size_t animation_channels = 3;
+
+	/**
+	 * @brief Components and first SoA row of every channel, rotation is a
+	 *        quaternion as (x, y, z, w)
+	 */
+	constexpr std::size_t animation_components[animation_channels] = {3, 4, 3};
+	constexpr std::size_t animation_rows[animation_channels] = {0, 3, 7};
+	constexpr std::size_t animation_row_count = 10;
+
+	/**
+	 * @brief Splits an affine matrix without shear or mirroring into
+	 *        translation, unit quaternion and scale, the inverse of trs4x4
+	 */
+	template <class T>
+	inline void decompose4x4(TMatrix4x4<T> const &m,
+				 TVector3<T> &t,
+				 TVector4<T> &q,
+				 TVector3<T> &s) noexcept
+	{
+		T r[3][3];
+
+		for (auto c = 0; c < 3; c++)
+		{
+			auto const l = std::sqrt(m.data[0].data[c] * m.data[0].data[c] +
+						 m.data[1].data[c] * m.data[1].data[c] +
+						 m.data[2].data[c] * m.data[2].data[c]);
+
+			s.data[c] = l;
+			t.data[c] = m.data[c].data[3];
+
+			for (auto k = 0; k < 3; k++)
+			{
+				r[k][c] = l > T(0) ? m.data[k].data[c] / l : T(k == c);
+			}
+		}
+
+		auto const d = r[0][0] + r[1][1] + r[2][2];
+
+		if (d > T(0))
+		{
+			auto const k = std::sqrt(d + T(1)) * T(2);
+
+			q = TVector4<T>{(r[2][1] - r[1][2]) / k, (r[0][2] - r[2][0]) / k, (r[1][0] - r[0][1]) / k, k / T(4)};
+		}
+		else if (r[0][0] > r[1][1] && r[0][0] > r[2][2])
+		{
+			auto const k = std::sqrt(T(1) + r[0][0] - r[1][1] - r[2][2]) * T(2);
+
+			q = TVector4<T>{k / T(4), (r[0][1] + r[1][0]) / k, (r[0][2] + r[2][0]) / k, (r[2][1] - r[1][2]) / k};
+		}
+		else if (r[1][1] > r[2][2])
+		{
+			auto const k = std::sqrt(T(1) + r[1][1] - r[0][0] - r[2][2]) * T(2);
+
+			q = TVector4<T>{(r[0][1] + r[1][0]) / k, k / T(4), (r[1][2] + r[2][1]) / k, (r[0][2] - r[2][0]) / k};
+		}
+		else
+		{
+			auto const k = std::sqrt(T(1) + r[2][2] - r[0][0] - r[1][1]) * T(2);
+
+			q = TVector4<T>{(r[0][2] + r[2][0]) / k, (r[1][2] + r[2][1]) / k, k / T(4), (r[1][0] - r[0][1]) / k};
+		}
+	}
+
+	// ----------------------------- Clip ------------------------------ //
+
+	/**
+	 * @brief Compressed keyframes of a skeleton, track c * bones() + b holds
+	 *        channel c of bone b
+	 */
+	template <class T>
+	class TAnimationClip
+	{
+	public:
+		TAnimationClip() noexcept = default;
+
+		/**
+		 * @brief Builds the clip from frames sampled at rate frames per
+		 *        second, element f * bones + b of every array is bone b in
+		 *        frame f
+		 *
+		 * A key is dropped when interpolating its neighbours reproduces
+		 * every frame in between within tolerance, on every component
+		 * (translation and scale units, quaternion components). The
+		 * quantization of the kept keys adds at most range / 131070.
+		 *
+		 * @return false when there is nothing to compress or too many
+		 *         tracks, the clip is then empty
+		 */
+		bool compress(TVector3<T> const *t,
+			      TVector4<T> const *q,
+			      TVector3<T> const *s,
+			      std::size_t bones, std::size_t frames, T rate, T tolerance)
+		{
+			m_keys.clear();
+			m_range.clear();
+			m_bones = 0;
+			m_duration = T(0);
+
+			if (bones == 0 || frames == 0 || !(rate > T(0)) ||
+			    bones * animation_channels > std::numeric_limits<std::uint32_t>::max())
+			{
+				return false;
+			}
+
+			struct Pending
+			{
+				float need = 0.f;
+				AnimationKey key;
+			};
+
+			std::vector<Pending> pending;
+			std::vector<T> v(frames * 4);
+			std::vector<T> d(frames * 4);
+			std::vector<std::uint16_t> u(frames * 4);
+			std::vector<std::size_t> kept;
+
+			m_range.resize(bones * animation_channels * 8);
+
+			for (std::size_t c = 0; c < animation_channels; c++)
+			{
+				auto const C = animation_components[c];
+
+				for (std::size_t b = 0; b < bones; b++)
+				{
+					auto const track = c * bones + b;
+					auto *r = m_range.data() + track * 8;
+
+					for (std::size_t f = 0; f < frames; f++)
+					{
+						auto const *x = c == animation_translation ? t[f * bones + b].data :
+								c == animation_rotation ? q[f * bones + b].data : s[f * bones + b].data;
+
+						auto const flip = c == animation_rotation && f > 0 &&
+								  x[0] * v[f * 4 - 4] + x[1] * v[f * 4 - 3] + x[2] * v[f * 4 - 2] + x[3] * v[f * 4 - 1] < T(0);
+
+						for (std::size_t j = 0; j < C; j++)
+						{
+							v[f * 4 + j] = flip ? -x[j] : x[j];
+						}
+					}
+
+					//
+					// 16-bit unorm over the range each component covers
+					//
+
+					for (std::size_t j = 0; j < C; j++)
+					{
+						auto lo = v[j];
+						auto hi = v[j];
+
+						for (std::size_t f = 1; f < frames; f++)
+						{
+							lo = std::min(lo, v[f * 4 + j]);
+							hi = std::max(hi, v[f * 4 + j]);
+						}
+
+						r[j] = lo;
+						r[4 + j] = (hi - lo) / T(65535);
+
+						for (std::size_t f = 0; f < frames; f++)
+						{
+							auto const k = r[4 + j] > T(0) ? std::nearbyint((v[f * 4 + j] - lo) / r[4 + j]) : T(0);
+
+							u[f * 4 + j] = static_cast<std::uint16_t>(std::clamp(k, T(0), T(65535)));
+							d[f * 4 + j] = lo + T(u[f * 4 + j]) * r[4 + j];
+						}
+					}
+
+					//
+					// greedy reduction, a segment grows while its interpolation
+					// stays within tolerance of every frame it spans
+					//
+
+					auto const fits = [&](std::size_t i, std::size_t j)
+					{
+						for (auto k = i + 1; k < j; k++)
+						{
+							auto const a = T(k - i) / T(j - i);
+
+							T x[4] = {};
+							T l = T(0);
+
+							for (std::size_t e = 0; e < C; e++)
+							{
+								x[e] = d[i * 4 + e] + (d[j * 4 + e] - d[i * 4 + e]) * a;
+								l += x[e] * x[e];
+							}
+
+							l = c == animation_rotation && l > T(0) ? std::sqrt(l) : T(1);
+
+							for (std::size_t e = 0; e < C; e++)
+							{
+								if (std::abs(x[e] / l - v[k * 4 + e]) > tolerance)
+								{
+									return false;
+								}
+							}
+						}
+
+						return true;
+					};
+
+					kept.assign(1, 0);
+
+					for (std::size_t i = 0; i + 1 < frames;)
+					{
+						auto j = i + 1;
+
+						while (j + 1 < frames && fits(i, j + 1))
+						{
+							j++;
+						}
+
+						kept.push_back(j);
+						i = j;
+					}
+
+					//
+					// a single frame still makes a segment, of length zero
+					//
+
+					if (kept.size() == 1)
+					{
+						kept.push_back(0);
+					}
+
+					for (std::size_t k = 0; k < kept.size(); k++)
+					{
+						AnimationKey key;
+
+						key.time = float(T(kept[k]) / rate);
+						key.track = std::uint32_t(track);
+
+						for (std::size_t j = 0; j < C; j++)
+						{
+							key.value[j] = u[kept[k] * 4 + j];
+						}
+
+						pending.push_back(Pending{k < 2 ? -std::numeric_limits<float>::infinity() : pending.back().key.time, key});
+					}
+				}
+			}
+
+			std::stable_sort(pending.begin(), pending.end(), [](Pending const &a, Pending const &b) { return a.need < b.need; });
+
+			m_keys.reserve(pending.size());
+
+			for (auto const &p : pending)
+			{
+				m_keys.push_back(p.key);
+			}
+
+			m_bones = bones;
+			m_duration = T(frames - 1) / rate;
+
+			return true;
+		}
+
+		/**
+		 * @brief Builds the clip from raw matrices, see decompose4x4
+		 */
+		bool compress(TMatrix4x4<T> const *m, std::size_t bones, std::size_t frames, T rate, T tolerance)
+		{
+			std::vector<TVector3<T>> t(bones * frames);
+			std::vector<TVector4<T>> q(bones * frames);
+			std::vector<TVector3<T>> s(bones * frames);
+
+			for (std::size_t i = 0; i < bones * frames; i++)
+			{
+				decompose4x4(m[i], t[i], q[i], s[i]);
+			}
+
+			return compress(t.data(), q.data(), s.data(), bones, frames, rate, tolerance);
+		}
+
+		std::size_t bones() const noexcept { return m_bones; }
+
+		T duration() const noexcept { return m_duration; }
+
+		std::vector<AnimationKey> const &keys() const noexcept { return m_keys; }
+
+		/**
+		 * @return lo[4] followed by step[4] of a track
+		 */
+		T const *range(std::size_t track) const noexcept { return m_range.data() + track * 8; }
+
+		/**
+		 * @brief Bytes of keys and ranges
+		 */
+		std::size_t size() const noexcept
+		{
+			return m_keys.size() * sizeof(AnimationKey) + m_range.size() * sizeof(T);
+		}
+
+	private:
+		std::vector<AnimationKey> m_keys;
+		std::vector<T> m_range;
+
+		std::size_t m_bones = 0;
+
+		T m_duration = T(0);
+	};
+
+	using AnimationClip = TAnimationClip<float>;
+
+	// ---------------------------- Cursor ----------------------------- //
+
+	/**
+	 * @brief The keys on both sides of the sampled time, SoA over the bones
+	 *        of one channel
+	 */
+	template <class T>
+	struct TAnimationKeys
+	{
+		T const *value[4] = {}; // left key
+		T const *delta[4] = {}; // right key - left key
+		T const *time = nullptr;
+		T const *rate = nullptr; // 1 / (right time - left time), 0 for a single frame
+	};
+
+	/**
+	 * @brief The same keys from bone i on
+	 */
+	template <class T>
+	constexpr TAnimationKeys<T> operator+(TAnimationKeys<T> const &k, std::size_t i) noexcept
+	{
+		TAnimationKeys<T> r;
+
+		for (auto j = 0; j < 4; j++)
+		{
+			r.value[j] = k.value[j] ? k.value[j] + i : nullptr;
+			r.delta[j] = k.delta[j] ? k.delta[j] + i : nullptr;
+		}
+
+		r.time = k.time + i;
+		r.rate = k.rate + i;
+
+		return r;
+	}
+
+	/**
+	 * @brief Sampling state of a clip
+	 *
+	 * Seeking forward pulls the keys that became needed from the clip,
+	 * seeking backwards starts over from the first key. The clip must
+	 * outlive the cursor and not be compressed again while in use.
+	 */
+	template <class T>
+	class TAnimationCursor
+	{
+	public:
+		explicit TAnimationCursor(TAnimationClip<T> const &clip)
+			: m_clip(&clip)
+		{
+			auto const n = clip.bones();
+
+			m_left.resize(animation_row_count * n);
+			m_right.resize(animation_row_count * n);
+			m_delta.resize(animation_row_count * n);
+			m_pose.resize(animation_row_count * n);
+			m_start.resize(animation_channels * n);
+			m_end.resize(animation_channels * n);
+			m_rate.resize(animation_channels * n);
+
+			reset();
+		}
+
+		void seek(T t) noexcept
+		{
+			if (t < m_time)
+			{
+				reset();
+			}
+
+			m_time = t;
+
+			auto const &keys = m_clip->keys();
+
+			//
+			// the head of the array always follows the right key of its
+			// track, it is needed once t reaches that key
+			//
+
+			for (; m_next < keys.size() && !(m_end[keys[m_next].track] > t); m_next++)
+			{
+				push(keys[m_next]);
+			}
+		}
+
+		std::size_t bones() const noexcept { return m_clip->bones(); }
+
+		T time() const noexcept { return m_time; }
+
+		TAnimationKeys<T> keys(std::size_t channel) const noexcept
+		{
+			auto const n = bones();
+
+			TAnimationKeys<T> k;
+
+			for (std::size_t j = 0; j < animation_components[channel]; j++)
+			{
+				k.value[j] = m_left.data() + (animation_rows[channel] + j) * n;
+				k.delta[j] = m_delta.data() + (animation_rows[channel] + j) * n;
+			}
+
+			k.time = m_start.data() + channel * n;
+			k.rate = m_rate.data() + channel * n;
+
+			return k;
+		}
+
+		/**
+		 * @brief The sampled pose, written by sample_clip
+		 */
+		TVector3SoA<T> translation() noexcept { return TVector3SoA<T>{{row(0), row(1), row(2)}}; }
+		TVector4SoA<T> rotation() noexcept { return TVector4SoA<T>{{row(3), row(4), row(5), row(6)}}; }
+		TVector3SoA<T> scale() noexcept { return TVector3SoA<T>{{row(7), row(8), row(9)}}; }
+
+		TVector3SoA<T const> translation() const noexcept { return TVector3SoA<T const>{{row(0), row(1), row(2)}}; }
+		TVector4SoA<T const> rotation() const noexcept { return TVector4SoA<T const>{{row(3), row(4), row(5), row(6)}}; }
+		TVector3SoA<T const> scale() const noexcept { return TVector3SoA<T const>{{row(7), row(8), row(9)}}; }
+
+	private:
+		T *row(std::size_t r) noexcept { return m_pose.data() + r * bones(); }
+		T const *row(std::size_t r) const noexcept { return m_pose.data() + r * bones(); }
+
+		void reset() noexcept
+		{
+			auto const &keys = m_clip->keys();
+
+			m_next = 0;
+			m_time = std::numeric_limits<T>::lowest();
+
+			//
+			// the first two keys of every track lead the array
+			//
+
+			for (auto const n = std::min(keys.size(), animation_channels * bones() * 2); m_next < n; m_next++)
+			{
+				push(keys[m_next]);
+			}
+		}
+
+		void push(AnimationKey const &k) noexcept
+		{
+			auto const n = bones();
+			auto const c = k.track / n;
+			auto const b = k.track % n;
+			auto const *r = m_clip->range(k.track);
+
+			for (std::size_t j = 0; j < animation_components[c]; j++)
+			{
+				auto const i = (animation_rows[c] + j) * n + b;
+
+				m_left[i] = m_right[i];
+				m_right[i] = r[j] + T(k.value[j]) * r[4 + j];
+				m_delta[i] = m_right[i] - m_left[i];
+			}
+
+			m_start[k.track] = m_end[k.track];
+			m_end[k.track] = T(k.time);
+			m_rate[k.track] = m_end[k.track] > m_start[k.track] ? T(1) / (m_end[k.track] - m_start[k.track]) : T(0);
+		}
+
+		TAnimationClip<T> const *m_clip = nullptr;
+
+		std::vector<T> m_left;
+		std::vector<T> m_right;
+		std::vector<T> m_delta;
+		std::vector<T> m_pose;
+		std::vector<T> m_start;
+		std::vector<T> m_end;
+		std::vector<T> m_rate;
+
+		std::size_t m_next = 0;
+
+		T m_time = T(0);
+	};
+
+	using AnimationCursor = TAnimationCursor<float>;
+
+	// --------------------------- Sampling ---------------------------- //
+
+	/**
+	 * @brief dst[i] = value[i] + delta[i] * clamp((t - time[i]) * rate[i], 0, 1)
+	 */
+	template <class T>
+	inline void interpolate_batch(TVector3SoA<T> const &dst,
+				      TAnimationKeys<T> const &k, T t, std::size_t n) noexcept
+	{
+		for (std::size_t i = 0; i < n; i++)
+		{
+			auto const a = std::clamp((t - k.time[i]) * k.rate[i], T(0), T(1));
+
+			for (auto j = 0; j < 3; j++)
+			{
+				dst.data[j][i] = k.value[j][i] + k.delta[j][i] * a;
+			}
+		}
+	}
+
+	/**
+	 * @brief The same for quaternions, normalized after interpolation
+	 */
+	template <class T>
+	inline void nlerp_batch(TVector4SoA<T> const &dst,
+				TAnimationKeys<T> const &k, T t, std::size_t n) noexcept
+	{
+		for (std::size_t i = 0; i < n; i++)
+		{
+			auto const a = std::clamp((t - k.time[i]) * k.rate[i], T(0), T(1));
+
+			T q[4];
+
+			for (auto j = 0; j < 4; j++)
+			{
+				q[j] = k.value[j][i] + k.delta[j][i] * a;
+			}
+
+			auto const l = std::sqrt(q[0] * q[0] + q[1] * q[1] + q[2] * q[2] + q[3] * q[3]);
+
+			for (auto j = 0; j < 4; j++)
+			{
+				dst.data[j][i] = q[j] / l;
+			}
+		}
+	}
+
+	/**
+	 * @brief Samples every bone at time t into dst, TMatrix4x4 or TMatrix3x4
+	 */
+	template <class M, class T>
+	inline void sample_clip(M *dst, TAnimationCursor<T> &c, T t) noexcept
+	{
+		auto const n = c.bones();
+		auto const &p = c;
+
+		c.seek(t);
+
+		interpolate_batch(c.translation(), c.keys(animation_translation), t, n);
+		nlerp_batch(c.rotation(), c.keys(animation_rotation), t, n);
+		interpolate_batch(c.scale(), c.keys(animation_scale), t, n);
+
+		trs_batch(dst, p.translation(), p.rotation(), p.scale(), n);
+	}
+}
+
+#endif
\ No newline at end of file
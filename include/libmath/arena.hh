@@ -0,0 +1,216 @@
+#ifndef MICRO_LIBMATH_ARENA_HH__GUARD
+#define MICRO_LIBMATH_ARENA_HH__GUARD
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <type_traits>
+
+namespace micro::math
+{
+	constexpr std::size_t cache_line = 64;
+
+	/**
+	 * @brief Linear allocator for per-frame scratch batches
+	 *
+	 * Every allocation starts on a cache line, reset() releases all of them
+	 * at once. An arena is meant to be owned by a single worker thread, so
+	 * allocations never touch the global heap nor any lock.
+	 */
+	class Arena
+	{
+	public:
+		explicit Arena(std::size_t capacity) noexcept
+		{
+			m_data = static_cast<std::byte *>(::operator new(capacity, std::align_val_t{cache_line}, std::nothrow));
+			m_size = m_data ? capacity : 0;
+			m_owns = true;
+		}
+
+		/**
+		 * @brief Wraps an external buffer, the arena does not take ownership
+		 *
+		 * @param data buffer, should be cache line aligned
+		 * @param size buffer size in bytes
+		 */
+		Arena(void *data, std::size_t size) noexcept
+		{
+			m_data = static_cast<std::byte *>(data);
+			m_size = size;
+		}
+
+		Arena(Arena const &) = delete;
+		Arena &operator=(Arena const &) = delete;
+
+		~Arena() noexcept
+		{
+			if (m_owns)
+			{
+				::operator delete(m_data, std::align_val_t{cache_line});
+			}
+		}
+
+		/**
+		 * @brief Allocates and value-initializes n objects of type T
+		 *
+		 * @return pointer to the first object, nullptr when the arena is exhausted
+		 */
+		template <class T>
+		T *allocate(std::size_t n) noexcept
+		{
+			static_assert(std::is_trivially_destructible_v<T>, "arena never runs destructors");
+			static_assert(alignof(T) <= cache_line);
+
+			auto const base = reinterpret_cast<std::uintptr_t>(m_data);
+			auto const head = (base + m_used + cache_line - 1) & ~(cache_line - 1);
+			auto const tail = head + n * sizeof(T);
+
+			if (n > m_size / sizeof(T) || tail > base + m_size)
+			{
+				return nullptr;
+			}
+
+			m_used = tail - base;
+			m_peak = m_used > m_peak ? m_used : m_peak;
+
+			//
+			//
+
+			auto const p = reinterpret_cast<T *>(head);
+
+			for (std::size_t i = 0; i < n; i++)
+			{
+				::new (static_cast<void *>(p + i)) T{};
+			}
+
+			return p;
+		}
+
+		/**
+		 * @brief Returns the current fill level, pass it to rewind() to
+		 *        release everything allocated afterwards
+		 */
+		std::size_t mark() const noexcept { return m_used; }
+
+		void rewind(std::size_t mark) noexcept { m_used = mark < m_used ? mark : m_used; }
+		void reset() noexcept { m_used = 0; }
+
+		std::size_t used() const noexcept { return m_used; }
+		std::size_t capacity() const noexcept { return m_size; }
+		std::size_t high_water() const noexcept { return m_peak; }
+
+	private:
+		std::byte *m_data = nullptr;
+		std::size_t m_size = 0;
+		std::size_t m_used = 0;
+		std::size_t m_peak = 0;
+		bool m_owns = false;
+	};
+
+	/**
+	 * @brief Pool of fixed-size, cache line aligned blocks of T
+	 *
+	 * Each block holds `block` objects and can be released on its own or
+	 * together with all the others through reset(). Like Arena, a pool is
+	 * meant to be owned by a single worker thread.
+	 */
+	template <class T>
+	class TPool
+	{
+		static_assert(std::is_trivially_destructible_v<T>, "pool never runs destructors");
+		static_assert(alignof(T) <= cache_line);
+
+	public:
+		TPool(std::size_t block,
+		      std::size_t count) noexcept
+		{
+			auto const bytes = block * sizeof(T) > sizeof(void *) ? block * sizeof(T) : sizeof(void *);
+
+			m_step = (bytes + cache_line - 1) & ~(cache_line - 1);
+			m_data = static_cast<std::byte *>(::operator new(m_step * count, std::align_val_t{cache_line}, std::nothrow));
+			m_size = m_data ? count : 0;
+			m_block = block;
+		}
+
+		TPool(TPool const &) = delete;
+		TPool &operator=(TPool const &) = delete;
+
+		~TPool() noexcept
+		{
+			::operator delete(m_data, std::align_val_t{cache_line});
+		}
+
+		/**
+		 * @brief Takes a block and value-initializes its objects
+		 *
+		 * @return pointer to the first of block_size() objects, nullptr when the pool is exhausted
+		 */
+		T *allocate() noexcept
+		{
+			std::byte *p = nullptr;
+
+			if (m_free)
+			{
+				p = m_free;
+				m_free = *reinterpret_cast<std::byte **>(p);
+			}
+			else if (m_next < m_size)
+			{
+				p = m_data + m_step * m_next++;
+			}
+			else
+			{
+				return nullptr;
+			}
+
+			m_used = m_used + 1;
+			m_peak = m_used > m_peak ? m_used : m_peak;
+
+			//
+			//
+
+			auto const r = reinterpret_cast<T *>(p);
+
+			for (std::size_t i = 0; i < m_block; i++)
+			{
+				::new (static_cast<void *>(r + i)) T{};
+			}
+
+			return r;
+		}
+
+		void release(T *block) noexcept
+		{
+			auto const p = reinterpret_cast<std::byte *>(block);
+
+			*reinterpret_cast<std::byte **>(p) = m_free;
+
+			m_free = p;
+			m_used = m_used - 1;
+		}
+
+		void reset() noexcept
+		{
+			m_free = nullptr;
+			m_next = 0;
+			m_used = 0;
+		}
+
+		std::size_t block_size() const noexcept { return m_block; }
+		std::size_t used() const noexcept { return m_used; }
+		std::size_t capacity() const noexcept { return m_size; }
+		std::size_t high_water() const noexcept { return m_peak; }
+
+	private:
+		std::byte *m_data = nullptr;
+		std::byte *m_free = nullptr;
+		std::size_t m_step = 0;
+		std::size_t m_size = 0;
+		std::size_t m_next = 0;
+		std::size_t m_used = 0;
+		std::size_t m_peak = 0;
+		std::size_t m_block = 0;
+	};
+}
+
+#endif
\ No newline at end of file
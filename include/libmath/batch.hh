@@ -0,0 +1,608 @@
+#ifndef MICRO_LIBMATH_BATCH_HH__GUARD
+#define MICRO_LIBMATH_BATCH_HH__GUARD
+
+#include <cmath>
+#include <cstddef>
+#include <type_traits>
+
+#include "matrix.hh"
+#include "vector3.hh"
+#include "vector4.hh"
+
+namespace micro::math
+{
+	/**
+	 * @brief Structure-of-arrays view over 3D vectors, one array per component
+	 *
+	 * Sources are viewed as TVector3SoA<T const>, destinations as TVector3SoA<T>.
+	 */
+	template <class T>
+	struct TVector3SoA
+	{
+		constexpr T *x() const noexcept { return data[0]; }
+		constexpr T *y() const noexcept { return data[1]; }
+		constexpr T *z() const noexcept { return data[2]; }
+
+		T *data[3] = {};
+	};
+
+	template <class T>
+	struct TVector4SoA
+	{
+		constexpr T *x() const noexcept { return data[0]; }
+		constexpr T *y() const noexcept { return data[1]; }
+		constexpr T *z() const noexcept { return data[2]; }
+		constexpr T *w() const noexcept { return data[3]; }
+
+		T *data[4] = {};
+	};
+
+	/**
+	 * @brief Structure-of-arrays view over 4x4 matrices, data[r * 4 + c]
+	 *        holds element (r, c) of every matrix
+	 */
+	template <class T>
+	struct TMatrix4x4SoA
+	{
+		T *data[16] = {};
+	};
+
+	/**
+	 * @brief Matrix kept in the layout the transform kernels consume
+	 *
+	 * Built once per matrix and reused for every vector it transforms, the
+	 * columns are stored aligned so each kernel loads them straight into
+	 * registers without a per-call transpose.
+	 */
+	template <class M>
+	struct PreparedTransform;
+
+	template <class T>
+	struct PreparedTransform<TMatrix4x4<T>>
+	{
+		constexpr PreparedTransform() noexcept = default;
+
+		constexpr explicit PreparedTransform(TMatrix4x4<T> const &m) noexcept
+		{
+			data[0] = {m._11(), m._21(), m._31(), m._41()};
+			data[1] = {m._12(), m._22(), m._32(), m._42()};
+			data[2] = {m._13(), m._23(), m._33(), m._43()};
+			data[3] = {m._14(), m._24(), m._34(), m._44()};
+		}
+
+		constexpr explicit PreparedTransform(TMatrix4x4<T, ColumnMajor> const &m) noexcept
+		{
+			data[0] = m.data[0];
+			data[1] = m.data[1];
+			data[2] = m.data[2];
+			data[3] = m.data[3];
+		}
+
+		alignas(sizeof(TVector4<T>)) TVector4<T> data[4] = {}; // columns
+	};
+
+	// ------------------------- MV arithmetic ------------------------- //
+
+	/**
+	 * @brief Transforms n vectors, dst[i] = m * src[i]
+	 */
+	template <class T>
+	inline void transform_batch(TVector4<T> *dst,
+				    TMatrix4x4<T> const &m,
+				    TVector4<T> const *src, std::size_t n) noexcept
+	{
+		for (std::size_t i = 0; i < n; i++)
+		{
+			dst[i] = m * src[i];
+		}
+	}
+
+	template <class T>
+	inline void transform_batch(TVector4<T> *dst,
+				    TMatrix4x4<T, ColumnMajor> const &m,
+				    TVector4<T> const *src, std::size_t n) noexcept
+	{
+		for (std::size_t i = 0; i < n; i++)
+		{
+			dst[i] = m * src[i];
+		}
+	}
+
+	template <class T>
+	constexpr TVector4<T> operator*(PreparedTransform<TMatrix4x4<T>> const &p, TVector4<T> const &v) noexcept
+	{
+		return p.data[0] * v.x() +
+		       p.data[1] * v.y() +
+		       p.data[2] * v.z() +
+		       p.data[3] * v.w();
+	}
+
+	template <class T>
+	inline void transform_batch(TVector4<T> *dst,
+				    PreparedTransform<TMatrix4x4<T>> const &m,
+				    TVector4<T> const *src, std::size_t n) noexcept
+	{
+		for (std::size_t i = 0; i < n; i++)
+		{
+			dst[i] = m * src[i];
+		}
+	}
+
+	template <class T>
+	inline void transform_batch(TVector3<T> *dst,
+				    TMatrix3x3<T> const &m,
+				    TVector3<T> const *src, std::size_t n) noexcept
+	{
+		for (std::size_t i = 0; i < n; i++)
+		{
+			dst[i] = m * src[i];
+		}
+	}
+
+	// ------------------------- SoA arithmetic ------------------------ //
+
+	template <class T>
+	inline void dot_batch(T *dst,
+			      TVector3SoA<T const> const &a,
+			      TVector3SoA<T const> const &b, std::size_t n) noexcept
+	{
+		for (std::size_t i = 0; i < n; i++)
+		{
+			dst[i] = a.x()[i] * b.x()[i] + a.y()[i] * b.y()[i] + a.z()[i] * b.z()[i];
+		}
+	}
+
+	template <class T>
+	inline void normalize_batch(TVector3SoA<T> const &dst,
+				    TVector3SoA<T const> const &src, std::size_t n) noexcept
+	{
+		for (std::size_t i = 0; i < n; i++)
+		{
+			auto const x = src.x()[i];
+			auto const y = src.y()[i];
+			auto const z = src.z()[i];
+			auto const l = std::sqrt(x * x + y * y + z * z);
+
+			dst.x()[i] = x / l;
+			dst.y()[i] = y / l;
+			dst.z()[i] = z / l;
+		}
+	}
+
+	// ------------------------- MM arithmetic ------------------------- //
+
+	/**
+	 * @brief Multiplies n pairs of matrices, dst[i] = a[i] * b[i]
+	 *
+	 * The broadcast forms take one side by reference and reuse it for every
+	 * product, dst[i] = a * b[i] or dst[i] = a[i] * b. TMatrix3x4 is taken as
+	 * an affine transform and composed through compose3x4. dst may be the
+	 * same array as a or b, but must not overlap a broadcast operand.
+	 */
+	template <class T>
+	inline void multiply_batch(TMatrix2x2<T> *dst,
+				   TMatrix2x2<T> const *a,
+				   TMatrix2x2<T> const *b, std::size_t n) noexcept
+	{
+		for (std::size_t i = 0; i < n; i++)
+		{
+			dst[i] = a[i] * b[i];
+		}
+	}
+
+	template <class T>
+	inline void multiply_batch(TMatrix2x2<T> *dst,
+				   TMatrix2x2<T> const &a,
+				   TMatrix2x2<T> const *b, std::size_t n) noexcept
+	{
+		for (std::size_t i = 0; i < n; i++)
+		{
+			dst[i] = a * b[i];
+		}
+	}
+
+	template <class T>
+	inline void multiply_batch(TMatrix2x2<T> *dst,
+				   TMatrix2x2<T> const *a,
+				   TMatrix2x2<T> const &b, std::size_t n) noexcept
+	{
+		for (std::size_t i = 0; i < n; i++)
+		{
+			dst[i] = a[i] * b;
+		}
+	}
+
+	template <class T>
+	inline void multiply_batch(TMatrix3x3<T> *dst,
+				   TMatrix3x3<T> const *a,
+				   TMatrix3x3<T> const *b, std::size_t n) noexcept
+	{
+		for (std::size_t i = 0; i < n; i++)
+		{
+			dst[i] = a[i] * b[i];
+		}
+	}
+
+	template <class T>
+	inline void multiply_batch(TMatrix3x3<T> *dst,
+				   TMatrix3x3<T> const &a,
+				   TMatrix3x3<T> const *b, std::size_t n) noexcept
+	{
+		for (std::size_t i = 0; i < n; i++)
+		{
+			dst[i] = a * b[i];
+		}
+	}
+
+	template <class T>
+	inline void multiply_batch(TMatrix3x3<T> *dst,
+				   TMatrix3x3<T> const *a,
+				   TMatrix3x3<T> const &b, std::size_t n) noexcept
+	{
+		for (std::size_t i = 0; i < n; i++)
+		{
+			dst[i] = a[i] * b;
+		}
+	}
+
+	template <class T>
+	inline void multiply_batch(TMatrix3x4<T> *dst,
+				   TMatrix3x4<T> const *a,
+				   TMatrix3x4<T> const *b, std::size_t n) noexcept
+	{
+		for (std::size_t i = 0; i < n; i++)
+		{
+			dst[i] = compose3x4(a[i], b[i]);
+		}
+	}
+
+	template <class T>
+	inline void multiply_batch(TMatrix3x4<T> *dst,
+				   TMatrix3x4<T> const &a,
+				   TMatrix3x4<T> const *b, std::size_t n) noexcept
+	{
+		for (std::size_t i = 0; i < n; i++)
+		{
+			dst[i] = compose3x4(a, b[i]);
+		}
+	}
+
+	template <class T>
+	inline void multiply_batch(TMatrix3x4<T> *dst,
+				   TMatrix3x4<T> const *a,
+				   TMatrix3x4<T> const &b, std::size_t n) noexcept
+	{
+		for (std::size_t i = 0; i < n; i++)
+		{
+			dst[i] = compose3x4(a[i], b);
+		}
+	}
+
+	template <class T>
+	inline void multiply_batch(TMatrix4x4<T> *dst,
+				   TMatrix4x4<T> const *a,
+				   TMatrix4x4<T> const *b, std::size_t n) noexcept
+	{
+		for (std::size_t i = 0; i < n; i++)
+		{
+			dst[i] = a[i] * b[i];
+		}
+	}
+
+	template <class T>
+	inline void multiply_batch(TMatrix4x4<T> *dst,
+				   TMatrix4x4<T> const &a,
+				   TMatrix4x4<T> const *b, std::size_t n) noexcept
+	{
+		for (std::size_t i = 0; i < n; i++)
+		{
+			dst[i] = a * b[i];
+		}
+	}
+
+	template <class T>
+	inline void multiply_batch(TMatrix4x4<T> *dst,
+				   TMatrix4x4<T> const *a,
+				   TMatrix4x4<T> const &b, std::size_t n) noexcept
+	{
+		for (std::size_t i = 0; i < n; i++)
+		{
+			dst[i] = a[i] * b;
+		}
+	}
+
+	// ------------------------ Inverse / det -------------------------- //
+
+	/**
+	 * @brief Determinants of n matrices, dst[i] = det(src[i])
+	 */
+	template <class T>
+	inline void det_batch(T *dst,
+			      TMatrix2x2<T> const *src, std::size_t n) noexcept
+	{
+		for (std::size_t i = 0; i < n; i++)
+		{
+			dst[i] = det(src[i]);
+		}
+	}
+
+	template <class T>
+	inline void det_batch(T *dst,
+			      TMatrix3x3<T> const *src, std::size_t n) noexcept
+	{
+		for (std::size_t i = 0; i < n; i++)
+		{
+			dst[i] = det(src[i]);
+		}
+	}
+
+	template <class T>
+	inline void det_batch(T *dst,
+			      TMatrix4x4<T> const *src, std::size_t n) noexcept
+	{
+		for (std::size_t i = 0; i < n; i++)
+		{
+			dst[i] = det(src[i]);
+		}
+	}
+
+	/**
+	 * @brief Inverts n matrices, dst[i] = inverse(src[i])
+	 *
+	 * When singular is given it receives det(src[i]) == 0 for every matrix,
+	 * dst[i] of a singular matrix is left as adjoint / det like inverse()
+	 * does. dst may be the same array as src.
+	 */
+	template <class T>
+	inline void inverse_batch(TMatrix2x2<T> *dst,
+				  TMatrix2x2<T> const *src, std::size_t n, bool *singular = nullptr) noexcept
+	{
+		for (std::size_t i = 0; i < n; i++)
+		{
+			auto const d = det(src[i]);
+
+			if (singular)
+			{
+				singular[i] = d == T(0);
+			}
+
+			dst[i] = adjoint(src[i]) / d;
+		}
+	}
+
+	template <class T>
+	inline void inverse_batch(TMatrix3x3<T> *dst,
+				  TMatrix3x3<T> const *src, std::size_t n, bool *singular = nullptr) noexcept
+	{
+		for (std::size_t i = 0; i < n; i++)
+		{
+			auto const d = det(src[i]);
+
+			if (singular)
+			{
+				singular[i] = d == T(0);
+			}
+
+			dst[i] = adjoint(src[i]) / d;
+		}
+	}
+
+	template <class T>
+	inline void inverse_batch(TMatrix4x4<T> *dst,
+				  TMatrix4x4<T> const *src, std::size_t n, bool *singular = nullptr) noexcept
+	{
+		for (std::size_t i = 0; i < n; i++)
+		{
+			auto const d = det(src[i]);
+
+			if (singular)
+			{
+				singular[i] = d == T(0);
+			}
+
+			dst[i] = adjoint(src[i]) / d;
+		}
+	}
+
+	// --------------------------- Transpose --------------------------- //
+
+	/**
+	 * @brief Transposes n matrices, dst[i] = transpose(src[i])
+	 *
+	 * Flips whole arrays between row-major and column-major storage. dst may
+	 * be the same array as src for the square shapes.
+	 */
+	template <class T>
+	inline void transpose_batch(TMatrix2x2<T> *dst,
+				    TMatrix2x2<T> const *src, std::size_t n) noexcept
+	{
+		for (std::size_t i = 0; i < n; i++)
+		{
+			dst[i] = transpose(src[i]);
+		}
+	}
+
+	template <class T>
+	inline void transpose_batch(TMatrix3x2<T> *dst,
+				    TMatrix2x3<T> const *src, std::size_t n) noexcept
+	{
+		for (std::size_t i = 0; i < n; i++)
+		{
+			dst[i] = transpose(src[i]);
+		}
+	}
+
+	template <class T>
+	inline void transpose_batch(TMatrix4x2<T> *dst,
+				    TMatrix2x4<T> const *src, std::size_t n) noexcept
+	{
+		for (std::size_t i = 0; i < n; i++)
+		{
+			dst[i] = transpose(src[i]);
+		}
+	}
+
+	template <class T>
+	inline void transpose_batch(TMatrix2x3<T> *dst,
+				    TMatrix3x2<T> const *src, std::size_t n) noexcept
+	{
+		for (std::size_t i = 0; i < n; i++)
+		{
+			dst[i] = transpose(src[i]);
+		}
+	}
+
+	template <class T>
+	inline void transpose_batch(TMatrix3x3<T> *dst,
+				    TMatrix3x3<T> const *src, std::size_t n) noexcept
+	{
+		for (std::size_t i = 0; i < n; i++)
+		{
+			dst[i] = transpose(src[i]);
+		}
+	}
+
+	template <class T>
+	inline void transpose_batch(TMatrix4x3<T> *dst,
+				    TMatrix3x4<T> const *src, std::size_t n) noexcept
+	{
+		for (std::size_t i = 0; i < n; i++)
+		{
+			dst[i] = transpose(src[i]);
+		}
+	}
+
+	template <class T>
+	inline void transpose_batch(TMatrix2x4<T> *dst,
+				    TMatrix4x2<T> const *src, std::size_t n) noexcept
+	{
+		for (std::size_t i = 0; i < n; i++)
+		{
+			dst[i] = transpose(src[i]);
+		}
+	}
+
+	template <class T>
+	inline void transpose_batch(TMatrix3x4<T> *dst,
+				    TMatrix4x3<T> const *src, std::size_t n) noexcept
+	{
+		for (std::size_t i = 0; i < n; i++)
+		{
+			dst[i] = transpose(src[i]);
+		}
+	}
+
+	template <class T>
+	inline void transpose_batch(TMatrix4x4<T> *dst,
+				    TMatrix4x4<T> const *src, std::size_t n) noexcept
+	{
+		for (std::size_t i = 0; i < n; i++)
+		{
+			dst[i] = transpose(src[i]);
+		}
+	}
+
+	/**
+	 * @brief Scatters n matrices into SoA, dst.data[k][i] = element k of src[i]
+	 */
+	template <class T>
+	inline void transpose_batch(TMatrix4x4SoA<T> const &dst,
+				    TMatrix4x4<T> const *src, std::size_t n) noexcept
+	{
+		for (std::size_t i = 0; i < n; i++)
+		{
+			for (auto k = 0; k < 16; k++)
+			{
+				dst.data[k][i] = src[i].data[k / 4].data[k % 4];
+			}
+		}
+	}
+
+	/**
+	 * @brief Gathers n matrices back from SoA, the inverse of the above
+	 */
+	template <class T>
+	inline void transpose_batch(TMatrix4x4<T> *dst,
+				    TMatrix4x4SoA<T const> const &src, std::size_t n) noexcept
+	{
+		for (std::size_t i = 0; i < n; i++)
+		{
+			for (auto k = 0; k < 16; k++)
+			{
+				dst[i].data[k / 4].data[k % 4] = src.data[k][i];
+			}
+		}
+	}
+
+	// ------------------------------ TRS ------------------------------ //
+
+	/**
+	 * @brief Builds n model matrices from SoA translation, quaternion and
+	 *        scale arrays, dst[i] = trs4x4(t[i], q[i], s[i])
+	 */
+	template <class T>
+	inline void trs_batch(TMatrix4x4<T> *dst,
+			      TVector3SoA<T const> const &t,
+			      TVector4SoA<T const> const &q,
+			      TVector3SoA<T const> const &s, std::size_t n) noexcept
+	{
+		for (std::size_t i = 0; i < n; i++)
+		{
+			dst[i] = trs4x4(TVector3<T>{t.x()[i], t.y()[i], t.z()[i]},
+					TVector4<T>{q.x()[i], q.y()[i], q.z()[i], q.w()[i]},
+					TVector3<T>{s.x()[i], s.y()[i], s.z()[i]});
+		}
+	}
+
+	template <class T>
+	inline void trs_batch(TMatrix3x4<T> *dst,
+			      TVector3SoA<T const> const &t,
+			      TVector4SoA<T const> const &q,
+			      TVector3SoA<T const> const &s, std::size_t n) noexcept
+	{
+		for (std::size_t i = 0; i < n; i++)
+		{
+			dst[i] = trs3x4(TVector3<T>{t.x()[i], t.y()[i], t.z()[i]},
+					TVector4<T>{q.x()[i], q.y()[i], q.z()[i], q.w()[i]},
+					TVector3<T>{s.x()[i], s.y()[i], s.z()[i]});
+		}
+	}
+
+	// ------------------------------ Cast ----------------------------- //
+
+	/**
+	 * @brief dst[i] = static_cast<U>(src[i]) over spans of scalars, vectors
+	 *        or matrices
+	 *
+	 * Vectors and matrices are unpadded, standard layout arrays of their
+	 * scalar type, so a span of n of them converts as one run of n times
+	 * their scalar count, the way serialize_batch copies them. Float to
+	 * integer conversions truncate. Half precision goes through pack_batch
+	 * and unpack_batch.
+	 */
+	template <class U, class T>
+	inline void cast_batch(U *dst, T const *src, std::size_t n) noexcept
+	{
+		if constexpr (std::is_arithmetic_v<U>)
+		{
+			for (std::size_t i = 0; i < n; i++)
+			{
+				dst[i] = static_cast<U>(src[i]);
+			}
+		}
+		else
+		{
+			using R = typename U::type;
+			using S = typename T::type;
+
+			constexpr auto N = sizeof(U) / sizeof(R);
+
+			static_assert(sizeof(U) == N * sizeof(R) && sizeof(T) == N * sizeof(S), "shape mismatch or padding");
+			static_assert(std::is_standard_layout_v<U> && std::is_standard_layout_v<T>);
+
+			micro::math::cast_batch(reinterpret_cast<R *>(dst), reinterpret_cast<S const *>(src), n * N);
+		}
+	}
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,329 @@
+#ifndef MICRO_LIBMATH_HALF_HH__GUARD
+#define MICRO_LIBMATH_HALF_HH__GUARD
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#include "vector2.hh"
+#include "vector3.hh"
+#include "vector4.hh"
+#include "matrix3x3.hh"
+#include "matrix3x4.hh"
+#include "matrix4x4.hh"
+
+namespace micro::math
+{
+	/**
+	 * @brief IEEE 754 binary16, storage only
+	 */
+	struct half
+	{
+		std::uint16_t bits = 0;
+	};
+
+	/**
+	 * @brief Upper half of an IEEE 754 binary32, storage only
+	 */
+	struct bfloat16
+	{
+		std::uint16_t bits = 0;
+	};
+
+	// ----------------------------------------------------------------- //
+
+	template <class H>
+	struct TPackedVector2
+	{
+		H data[2] = {};
+	};
+
+	template <class H>
+	struct TPackedVector3
+	{
+		H data[3] = {};
+	};
+
+	template <class H>
+	struct TPackedVector4
+	{
+		H data[4] = {};
+	};
+
+	template <class H>
+	struct TPackedMatrix3x4
+	{
+		TPackedVector4<H> data[3] = {};
+	};
+
+	template <class H>
+	struct TPackedMatrix4x4
+	{
+		TPackedVector4<H> data[4] = {};
+	};
+
+	using Vector2h = TPackedVector2<half>;
+	using Vector3h = TPackedVector3<half>;
+	using Vector4h = TPackedVector4<half>;
+	using Matrix3x4h = TPackedMatrix3x4<half>;
+	using Matrix4x4h = TPackedMatrix4x4<half>;
+
+	using Vector2bf = TPackedVector2<bfloat16>;
+	using Vector3bf = TPackedVector3<bfloat16>;
+	using Vector4bf = TPackedVector4<bfloat16>;
+	using Matrix3x4bf = TPackedMatrix3x4<bfloat16>;
+	using Matrix4x4bf = TPackedMatrix4x4<bfloat16>;
+
+	// ---------------------------- Scalar ----------------------------- //
+
+	/**
+	 * @brief Rounds a float to the nearest binary16, ties to even
+	 */
+	template <class H>
+	inline std::enable_if_t<std::is_same_v<H, half>, half> pack(float f) noexcept
+	{
+		std::uint32_t x;
+		std::uint16_t o;
+
+		std::memcpy(&x, &f, sizeof(x));
+
+		auto const s = (x >> 16) & 0x8000u;
+
+		x = x & 0x7FFFFFFFu;
+
+		if (x >= 0x47800000u)
+		{
+			o = x > 0x7F800000u ? 0x7E00u : 0x7C00u; // NaN or overflow to Inf
+		}
+		else if (x < 0x38800000u)
+		{
+			auto const magic = 0x3F000000u; // 0.5f, pushes the mantissa into the binary16 subnormal range
+
+			float m;
+			float v;
+
+			std::memcpy(&m, &magic, sizeof(m));
+			std::memcpy(&v, &x, sizeof(v));
+
+			v = v + m;
+
+			std::memcpy(&x, &v, sizeof(x));
+
+			o = static_cast<std::uint16_t>(x - magic);
+		}
+		else
+		{
+			x = x + 0xC8000FFFu + ((x >> 13) & 1); // rebias exponent, round to nearest even
+
+			o = static_cast<std::uint16_t>(x >> 13);
+		}
+
+		return half{static_cast<std::uint16_t>(o | s)};
+	}
+
+	/**
+	 * @brief Rounds a float to the nearest bfloat16, ties to even
+	 */
+	template <class H>
+	inline std::enable_if_t<std::is_same_v<H, bfloat16>, bfloat16> pack(float f) noexcept
+	{
+		std::uint32_t x;
+
+		std::memcpy(&x, &f, sizeof(x));
+
+		if ((x & 0x7FFFFFFFu) > 0x7F800000u)
+		{
+			return bfloat16{static_cast<std::uint16_t>((x >> 16) | 0x40u)}; // quiet NaN
+		}
+
+		return bfloat16{static_cast<std::uint16_t>((x + 0x7FFFu + ((x >> 16) & 1)) >> 16)};
+	}
+
+	inline float unpack(half h) noexcept
+	{
+		auto const e = 0x7C00u << 13;
+
+		std::uint32_t x = (h.bits & 0x7FFFu) << 13;
+		std::uint32_t k = x & e;
+
+		float f;
+
+		x = x + ((127 - 15) << 23);
+
+		if (k == e)
+		{
+			x = x + ((128 - 16) << 23); // Inf or NaN
+		}
+		else if (k == 0)
+		{
+			auto const magic = 113u << 23;
+
+			float m;
+
+			std::memcpy(&m, &magic, sizeof(m));
+
+			x = x + (1 << 23);
+
+			std::memcpy(&f, &x, sizeof(f));
+
+			f = f - m; // zero or subnormal, renormalized by the FPU
+
+			std::memcpy(&x, &f, sizeof(x));
+		}
+
+		x = x | ((h.bits & 0x8000u) << 16);
+
+		std::memcpy(&f, &x, sizeof(f));
+
+		return f;
+	}
+
+	inline float unpack(bfloat16 h) noexcept
+	{
+		std::uint32_t const x = std::uint32_t(h.bits) << 16;
+
+		float f;
+
+		std::memcpy(&f, &x, sizeof(f));
+
+		return f;
+	}
+
+	// ---------------------------- Vector ----------------------------- //
+
+	template <class H>
+	inline TPackedVector2<H> pack(TVector2<float> const &v) noexcept
+	{
+		return TPackedVector2<H>{{pack<H>(v.data[0]),
+					  pack<H>(v.data[1])}};
+	}
+
+	template <class H>
+	inline TPackedVector3<H> pack(TVector3<float> const &v) noexcept
+	{
+		return TPackedVector3<H>{{pack<H>(v.data[0]),
+					  pack<H>(v.data[1]),
+					  pack<H>(v.data[2])}};
+	}
+
+	template <class H>
+	inline TPackedVector4<H> pack(TVector4<float> const &v) noexcept
+	{
+		return TPackedVector4<H>{{pack<H>(v.data[0]),
+					  pack<H>(v.data[1]),
+					  pack<H>(v.data[2]),
+					  pack<H>(v.data[3])}};
+	}
+
+	template <class H>
+	inline TVector2<float> unpack(TPackedVector2<H> const &v) noexcept
+	{
+		return TVector2<float>{unpack(v.data[0]),
+				       unpack(v.data[1])};
+	}
+
+	template <class H>
+	inline TVector3<float> unpack(TPackedVector3<H> const &v) noexcept
+	{
+		return TVector3<float>{unpack(v.data[0]),
+				       unpack(v.data[1]),
+				       unpack(v.data[2])};
+	}
+
+	template <class H>
+	inline TVector4<float> unpack(TPackedVector4<H> const &v) noexcept
+	{
+		return TVector4<float>{unpack(v.data[0]),
+				       unpack(v.data[1]),
+				       unpack(v.data[2]),
+				       unpack(v.data[3])};
+	}
+
+	// ---------------------------- Matrix ----------------------------- //
+
+	template <class H>
+	inline TPackedMatrix3x4<H> pack(TMatrix3x4<float> const &m) noexcept
+	{
+		return TPackedMatrix3x4<H>{{pack<H>(m.data[0]),
+					    pack<H>(m.data[1]),
+					    pack<H>(m.data[2])}};
+	}
+
+	template <class H>
+	inline TPackedMatrix4x4<H> pack(TMatrix4x4<float> const &m) noexcept
+	{
+		return TPackedMatrix4x4<H>{{pack<H>(m.data[0]),
+					    pack<H>(m.data[1]),
+					    pack<H>(m.data[2]),
+					    pack<H>(m.data[3])}};
+	}
+
+	template <class H>
+	inline TMatrix3x4<float> unpack(TPackedMatrix3x4<H> const &m) noexcept
+	{
+		return TMatrix3x4<float>{unpack(m.data[0]),
+					 unpack(m.data[1]),
+					 unpack(m.data[2])};
+	}
+
+	template <class H>
+	inline TMatrix4x4<float> unpack(TPackedMatrix4x4<H> const &m) noexcept
+	{
+		return TMatrix4x4<float>{unpack(m.data[0]),
+					 unpack(m.data[1]),
+					 unpack(m.data[2]),
+					 unpack(m.data[3])};
+	}
+
+	// ----------------------------- Batch ----------------------------- //
+
+	/**
+	 * @brief Converts n floats, every packed vector and matrix is a plain
+	 *        array of H so a span of any shape goes through here as a whole
+	 */
+	template <class H>
+	inline void pack_batch(H *dst, float const *src, std::size_t n) noexcept
+	{
+		for (std::size_t i = 0; i < n; i++)
+		{
+			dst[i] = pack<H>(src[i]);
+		}
+	}
+
+	template <class H>
+	inline void unpack_batch(float *dst, H const *src, std::size_t n) noexcept
+	{
+		for (std::size_t i = 0; i < n; i++)
+		{
+			dst[i] = unpack(src[i]);
+		}
+	}
+
+	/**
+	 * @brief Transforms n packed vectors, math runs in float and only the
+	 *        storage is 16 bits wide
+	 */
+	template <class H>
+	inline void transform_batch(TPackedVector4<H> *dst,
+				    TMatrix4x4<float> const &m,
+				    TPackedVector4<H> const *src, std::size_t n) noexcept
+	{
+		for (std::size_t i = 0; i < n; i++)
+		{
+			dst[i] = pack<H>(m * unpack(src[i]));
+		}
+	}
+
+	template <class H>
+	inline void transform_batch(TPackedVector3<H> *dst,
+				    TMatrix3x3<float> const &m,
+				    TPackedVector3<H> const *src, std::size_t n) noexcept
+	{
+		for (std::size_t i = 0; i < n; i++)
+		{
+			dst[i] = pack<H>(m * unpack(src[i]));
+		}
+	}
+}
+
+#endif
\ No newline at end of file
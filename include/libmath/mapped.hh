@@ -0,0 +1,319 @@
+#ifndef MICRO_LIBMATH_MAPPED_HH__GUARD
+#define MICRO_LIBMATH_MAPPED_HH__GUARD
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <type_traits>
+#include <utility>
+
+#ifdef _WIN32
+#	ifndef NOMINMAX
+#		define NOMINMAX
+#	endif
+#	include <windows.h>
+#else
+#	include <fcntl.h>
+#	include <sys/mman.h>
+#	include <sys/stat.h>
+#	include <unistd.h>
+#endif
+
+#include "arena.hh"
+#include "matrix4x4.hh"
+
+namespace micro::math
+{
+	/**
+	 * @brief File header of a mapped array, the elements follow at offset
+	 *
+	 * Elements are stored exactly as they are in memory, so a file is only
+	 * readable on a machine with the same endianness and scalar format.
+	 */
+	struct MappedHeader
+	{
+		char magic[4] = {'L', 'M', 'A', 'P'};
+		std::uint16_t version = 1;
+		std::uint16_t size = sizeof(MappedHeader);
+		std::uint32_t endian = 0x01020304;
+		std::uint8_t scalar = 0;      // mapped_float, mapped_int or mapped_uint
+		std::uint8_t scalar_size = 0; // bytes
+		std::uint8_t rows = 0;	      // outer extent of data
+		std::uint8_t cols = 0;	      // inner extent of data, 1 for vectors
+		std::uint8_t layout = 0;      // mapped_row_major or mapped_column_major
+		std::uint8_t reserved[3] = {};
+		std::uint32_t alignment = 0;
+		std::uint32_t stride = 0;
+		std::uint64_t count = 0;
+		std::uint64_t offset = cache_line;
+	};
+
+	static_assert(sizeof(MappedHeader) <= cache_line);
+
+	constexpr std::uint8_t mapped_float = 1;
+	constexpr std::uint8_t mapped_int   = 2;
+	constexpr std::uint8_t mapped_uint  = 3;
+
+	constexpr std::uint8_t mapped_row_major    = 0;
+	constexpr std::uint8_t mapped_column_major = 1;
+
+	template <class T>
+	constexpr std::uint8_t mapped_layout = mapped_row_major;
+
+	template <class T>
+	constexpr std::uint8_t mapped_layout<TMatrix4x4<T, ColumnMajor>> = mapped_column_major;
+
+	/**
+	 * @brief Header describing n elements of T, any vector or matrix of
+	 *        an arithmetic type
+	 */
+	template <class T>
+	constexpr MappedHeader mapped_header(std::uint64_t n) noexcept
+	{
+		using S = typename T::type;
+		using D = std::remove_extent_t<decltype(T::data)>;
+
+		static_assert(std::is_arithmetic_v<S>);
+		static_assert(std::is_trivially_copyable_v<T>);
+
+		MappedHeader h;
+
+		h.scalar = std::is_floating_point_v<S> ? mapped_float : std::is_signed_v<S> ? mapped_int : mapped_uint;
+		h.scalar_size = std::uint8_t(sizeof(S));
+		h.rows = std::uint8_t(sizeof(T::data) / sizeof(D));
+		h.cols = std::uint8_t(sizeof(D) / sizeof(S));
+		h.layout = mapped_layout<T>;
+		h.alignment = std::uint32_t(alignof(T));
+		h.stride = std::uint32_t(sizeof(T));
+		h.count = n;
+
+		return h;
+	}
+
+	/**
+	 * @brief Writes n elements in the format read by TMappedSpan
+	 *
+	 * @return false on any I/O error, the file content is then unspecified
+	 */
+	template <class T>
+	inline bool write_mapped(char const *path, T const *src, std::size_t n) noexcept
+	{
+		auto const h = mapped_header<T>(n);
+
+		unsigned char head[cache_line] = {};
+
+		std::memcpy(head, &h, sizeof(h));
+
+		auto *f = std::fopen(path, "wb");
+
+		if (!f)
+		{
+			return false;
+		}
+
+		auto ok = std::fwrite(head, 1, sizeof(head), f) == sizeof(head) &&
+			  std::fwrite(src, sizeof(T), n, f) == n;
+
+		ok = std::fclose(f) == 0 && ok;
+
+		return ok;
+	}
+
+	/**
+	 * @brief Read-only view of an array of T mapped from a file
+	 *
+	 * Opening only checks the header, the elements are paged in on first
+	 * access. data() is cache line aligned and can be handed as is to the
+	 * batch functions. A span is movable but not copyable.
+	 */
+	template <class T>
+	class TMappedSpan
+	{
+	public:
+		TMappedSpan() noexcept = default;
+
+		explicit TMappedSpan(char const *path) noexcept { open(path); }
+
+		TMappedSpan(TMappedSpan const &) = delete;
+		TMappedSpan &operator=(TMappedSpan const &) = delete;
+
+		TMappedSpan(TMappedSpan &&other) noexcept { swap(other); }
+
+		TMappedSpan &operator=(TMappedSpan &&other) noexcept
+		{
+			if (this != &other)
+			{
+				close();
+				swap(other);
+			}
+
+			return *this;
+		}
+
+		~TMappedSpan() noexcept { close(); }
+
+		/**
+		 * @return false when the file can't be mapped or does not hold an
+		 *         array of T, the span is then empty
+		 */
+		bool open(char const *path) noexcept
+		{
+			close();
+
+			std::size_t bytes = 0;
+
+			auto const *base = static_cast<unsigned char const *>(map(path, bytes));
+
+			if (!base)
+			{
+				return false;
+			}
+
+			m_base = base;
+			m_bytes = bytes;
+
+			MappedHeader h;
+			MappedHeader const e = mapped_header<T>(0);
+
+			if (bytes < sizeof(h))
+			{
+				close();
+				return false;
+			}
+
+			std::memcpy(&h, base, sizeof(h));
+
+			auto const ok = std::memcmp(h.magic, e.magic, sizeof(h.magic)) == 0 &&
+					h.version == e.version &&
+					h.endian == e.endian &&
+					h.scalar == e.scalar &&
+					h.scalar_size == e.scalar_size &&
+					h.rows == e.rows &&
+					h.cols == e.cols &&
+					h.layout == e.layout &&
+					h.stride == e.stride &&
+					h.offset % alignof(T) == 0 &&
+					h.offset <= bytes &&
+					h.count <= (bytes - h.offset) / sizeof(T);
+
+			if (!ok)
+			{
+				close();
+				return false;
+			}
+
+			m_data = reinterpret_cast<T const *>(base + h.offset);
+			m_size = std::size_t(h.count);
+
+			return true;
+		}
+
+		void close() noexcept
+		{
+			if (m_base)
+			{
+				unmap(m_base, m_bytes);
+			}
+
+			m_base = nullptr;
+			m_bytes = 0;
+			m_data = nullptr;
+			m_size = 0;
+		}
+
+		T const *data() const noexcept { return m_data; }
+		std::size_t size() const noexcept { return m_size; }
+		bool empty() const noexcept { return m_size == 0; }
+
+		T const *begin() const noexcept { return m_data; }
+		T const *end() const noexcept { return m_data + m_size; }
+
+		T const &operator[](std::size_t i) const noexcept { return m_data[i]; }
+
+		explicit operator bool() const noexcept { return m_base != nullptr; }
+
+	private:
+		void swap(TMappedSpan &other) noexcept
+		{
+			std::swap(m_base, other.m_base);
+			std::swap(m_bytes, other.m_bytes);
+			std::swap(m_data, other.m_data);
+			std::swap(m_size, other.m_size);
+		}
+
+#ifdef _WIN32
+		static void const *map(char const *path, std::size_t &bytes) noexcept
+		{
+			auto const file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+
+			if (file == INVALID_HANDLE_VALUE)
+			{
+				return nullptr;
+			}
+
+			LARGE_INTEGER size;
+			void const *p = nullptr;
+
+			if (GetFileSizeEx(file, &size) && size.QuadPart > 0)
+			{
+				auto const mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+
+				if (mapping)
+				{
+					p = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+					bytes = std::size_t(size.QuadPart);
+
+					CloseHandle(mapping);
+				}
+			}
+
+			CloseHandle(file);
+
+			return p;
+		}
+
+		static void unmap(void const *p, std::size_t) noexcept
+		{
+			UnmapViewOfFile(p);
+		}
+#else
+		static void const *map(char const *path, std::size_t &bytes) noexcept
+		{
+			auto const fd = ::open(path, O_RDONLY);
+
+			if (fd < 0)
+			{
+				return nullptr;
+			}
+
+			struct stat st;
+			void *p = nullptr;
+
+			if (::fstat(fd, &st) == 0 && st.st_size > 0)
+			{
+				p = ::mmap(nullptr, std::size_t(st.st_size), PROT_READ, MAP_SHARED, fd, 0);
+				p = p == MAP_FAILED ? nullptr : p;
+				bytes = std::size_t(st.st_size);
+			}
+
+			::close(fd);
+
+			return p;
+		}
+
+		static void unmap(void const *p, std::size_t bytes) noexcept
+		{
+			::munmap(const_cast<void *>(p), bytes);
+		}
+#endif
+
+		void const *m_base = nullptr;
+		std::size_t m_bytes = 0;
+
+		T const *m_data = nullptr;
+		std::size_t m_size = 0;
+	};
+}
+
+#endif
\ No newline at end of file
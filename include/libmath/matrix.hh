@@ -39,6 +39,9 @@ namespace micro::math
 	using Matrix4x3 = TMatrix4x3<float>;
 	using Matrix4x4 = TMatrix4x4<float>;
 
+	using Matrix4x4A = TMatrix4x4A<float>;
+	using Matrix4x4C = TMatrix4x4<float, ColumnMajor>;
+
 	// ----------------------------- 2 x 2 ----------------------------- //
 
 	template <class T>
@@ -352,6 +355,31 @@ namespace micro::math
 				     I + J + K + L};
 	}
 
+	/**
+	 * @brief Composes two affine transforms, both with an implied last row
+	 *        of (0, 0, 0, 1)
+	 *
+	 * @return l * r, rotation and scale of r applied first
+	 */
+	template <class T>
+	constexpr TMatrix3x4<T> compose3x4(TMatrix3x4<T> const &l,
+					   TMatrix3x4<T> const &r) noexcept
+	{
+		auto const A = l._11() * r.data[0];
+		auto const B = l._12() * r.data[1];
+		auto const C = l._13() * r.data[2];
+		auto const D = l._21() * r.data[0];
+		auto const E = l._22() * r.data[1];
+		auto const F = l._23() * r.data[2];
+		auto const G = l._31() * r.data[0];
+		auto const H = l._32() * r.data[1];
+		auto const I = l._33() * r.data[2];
+
+		return TMatrix3x4<T>{A + B + C + TVector4<T>{T(0), T(0), T(0), l._14()},
+				     D + E + F + TVector4<T>{T(0), T(0), T(0), l._24()},
+				     G + H + I + TVector4<T>{T(0), T(0), T(0), l._34()}};
+	}
+
 	// ----------------------------- 4 x 2 ----------------------------- //
 
 	template <class T>
@@ -552,6 +580,29 @@ namespace micro::math
 				     I + J + K + L,
 				     M + N + O + P};
 	}
+
+	// ----------------------------- Normal ---------------------------- //
+
+	/**
+	 * @brief Inverse-transpose of the upper 3x3 block of m, maps normals
+	 *        without going through a full 4x4 inverse
+	 */
+	template <class T>
+	inline TMatrix3x3<T> normal_matrix(TMatrix4x4<T> const &m) noexcept
+	{
+		auto const a = TVector3<T>{m._11(), m._12(), m._13()};
+		auto const b = TVector3<T>{m._21(), m._22(), m._23()};
+		auto const c = TVector3<T>{m._31(), m._32(), m._33()};
+
+		auto const A = b ^ c;
+		auto const B = c ^ a;
+		auto const C = a ^ b;
+		auto const d = sum(a * A);
+
+		return TMatrix3x3<T>{A / d,
+				     B / d,
+				     C / d};
+	}
 }
 
 namespace micro::math::simd
@@ -287,7 +287,10 @@ namespace micro::math
 	template <class T>
 	constexpr TMatrix3x3<T> inverse(TMatrix3x3<T> const &m) noexcept
 	{
-		return adjoint(m) / det(m);
+		auto const a = adjoint(m);
+		auto const d = m._11() * a._11() + m._12() * a._21() + m._13() * a._31(); // det(m) from the cofactors in a
+
+		return a / d;
 	}
 
 	// ----------------------------------------------------------------- //
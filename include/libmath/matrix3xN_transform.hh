@@ -79,6 +79,75 @@ namespace micro::math
 		return identity3x3<T>() + s * K + (T(1) - c) * K * K;
 	}
 
+	/**
+	 * @brief Builds a 3x3 rotation matrix from a quaternion
+	 *
+	 * @param q unit quaternion as (x, y, z, w)
+	 */
+	template<class T>
+	constexpr TMatrix3x3<T> rotate3x3(TVector4<T> const &q) noexcept
+	{
+		auto const x = q.x() + q.x();
+		auto const y = q.y() + q.y();
+		auto const z = q.z() + q.z();
+		auto const a = q.x() * x;
+		auto const b = q.y() * y;
+		auto const c = q.z() * z;
+		auto const d = q.x() * y;
+		auto const e = q.x() * z;
+		auto const f = q.y() * z;
+		auto const g = q.w() * x;
+		auto const h = q.w() * y;
+		auto const i = q.w() * z;
+
+		return TMatrix3x3<T>{T(1) - b - c, d - i, e + h,
+				     d + i, T(1) - a - c, f - g,
+				     e - h, f + g, T(1) - a - b};
+	}
+
+	// ------------------------------ TRS ------------------------------ //
+
+	/**
+	 * @brief Builds the affine rows of translate * rotate * scale directly
+	 *
+	 * @param q unit quaternion as (x, y, z, w)
+	 */
+	template <class T>
+	constexpr TMatrix3x4<T> trs3x4(TVector3<T> const &t,
+				       TVector4<T> const &q,
+				       TVector3<T> const &s) noexcept
+	{
+		auto const x = q.x() + q.x();
+		auto const y = q.y() + q.y();
+		auto const z = q.z() + q.z();
+		auto const a = q.x() * x;
+		auto const b = q.y() * y;
+		auto const c = q.z() * z;
+		auto const d = q.x() * y;
+		auto const e = q.x() * z;
+		auto const f = q.y() * z;
+		auto const g = q.w() * x;
+		auto const h = q.w() * y;
+		auto const i = q.w() * z;
+
+		return TMatrix3x4<T>{(T(1) - b - c) * s.x(), (d - i) * s.y(), (e + h) * s.z(), t.x(),
+				     (d + i) * s.x(), (T(1) - a - c) * s.y(), (f - g) * s.z(), t.y(),
+				     (e - h) * s.x(), (f + g) * s.y(), (T(1) - a - b) * s.z(), t.z()};
+	}
+
+	/**
+	 * @param u normalized rotation axis
+	 */
+	template <class T>
+	inline TMatrix3x4<T> trs3x4(TVector3<T> const &t,
+				    TVector3<T> const &u, T angle,
+				    TVector3<T> const &s) noexcept
+	{
+		auto const k = std::sin(angle / T(2));
+
+		return trs3x4(t, TVector4<T>{u.x() * k, u.y() * k, u.z() * k, std::cos(angle / T(2))}, s);
+	}
+
 	// ------------------------------ View ----------------------------- //
 
 	/**
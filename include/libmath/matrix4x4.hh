@@ -6,7 +6,22 @@
 
 namespace micro::math
 {
+	/**
+	 * @brief Storage order policies, data[i] holds row i or column i
+	 *
+	 * Only TMatrix4x4 takes a storage order, TMatrix2x2, TMatrix3x3 and
+	 * TMatrix3x4 are always row-major.
+	 */
+	struct RowMajor
+	{
+	};
+
+	struct ColumnMajor
+	{
+	};
+
 	template <class T,
+		  class O = RowMajor,
 		  class F = std::enable_if_t<std::is_arithmetic_v<T>, int>>
 	struct TMatrix4x4
 	{
@@ -73,6 +88,95 @@ namespace micro::math
 		TVector4<T> data[4] = {};
 	};
 
+	/**
+	 * @brief TMatrix4x4 stored as four columns, data[c] holds column c
+	 *
+	 * Constructor arguments and the _RC() accessors keep the mathematical
+	 * order, so both layouts read the same and only the memory differs. The
+	 * vector constructor takes columns.
+	 */
+	template <class T,
+		  class F>
+	struct TMatrix4x4<T, ColumnMajor, F>
+	{
+		typedef std::remove_reference_t<std::remove_cv_t<T>> type;
+
+		//
+		//
+
+		constexpr TMatrix4x4(T _11 = {}, T _12 = {}, T _13 = {}, T _14 = {},
+				     T _21 = {}, T _22 = {}, T _23 = {}, T _24 = {},
+				     T _31 = {}, T _32 = {}, T _33 = {}, T _34 = {},
+				     T _41 = {}, T _42 = {}, T _43 = {}, T _44 = {}) noexcept
+		{
+			data[0] = {_11, _21, _31, _41};
+			data[1] = {_12, _22, _32, _42};
+			data[2] = {_13, _23, _33, _43};
+			data[3] = {_14, _24, _34, _44};
+		}
+
+		constexpr TMatrix4x4(TVector4<T> const &_1,
+				     TVector4<T> const &_2,
+				     TVector4<T> const &_3,
+				     TVector4<T> const &_4) noexcept
+		{
+			data[0] = _1;
+			data[1] = _2;
+			data[2] = _3;
+			data[3] = _4;
+		}
+
+		constexpr type &_11() noexcept { return data[0].data[0]; }
+		constexpr type &_12() noexcept { return data[1].data[0]; }
+		constexpr type &_13() noexcept { return data[2].data[0]; }
+		constexpr type &_14() noexcept { return data[3].data[0]; }
+		constexpr type &_21() noexcept { return data[0].data[1]; }
+		constexpr type &_22() noexcept { return data[1].data[1]; }
+		constexpr type &_23() noexcept { return data[2].data[1]; }
+		constexpr type &_24() noexcept { return data[3].data[1]; }
+		constexpr type &_31() noexcept { return data[0].data[2]; }
+		constexpr type &_32() noexcept { return data[1].data[2]; }
+		constexpr type &_33() noexcept { return data[2].data[2]; }
+		constexpr type &_34() noexcept { return data[3].data[2]; }
+		constexpr type &_41() noexcept { return data[0].data[3]; }
+		constexpr type &_42() noexcept { return data[1].data[3]; }
+		constexpr type &_43() noexcept { return data[2].data[3]; }
+		constexpr type &_44() noexcept { return data[3].data[3]; }
+		constexpr type const &_11() const noexcept { return data[0].data[0]; }
+		constexpr type const &_12() const noexcept { return data[1].data[0]; }
+		constexpr type const &_13() const noexcept { return data[2].data[0]; }
+		constexpr type const &_14() const noexcept { return data[3].data[0]; }
+		constexpr type const &_21() const noexcept { return data[0].data[1]; }
+		constexpr type const &_22() const noexcept { return data[1].data[1]; }
+		constexpr type const &_23() const noexcept { return data[2].data[1]; }
+		constexpr type const &_24() const noexcept { return data[3].data[1]; }
+		constexpr type const &_31() const noexcept { return data[0].data[2]; }
+		constexpr type const &_32() const noexcept { return data[1].data[2]; }
+		constexpr type const &_33() const noexcept { return data[2].data[2]; }
+		constexpr type const &_34() const noexcept { return data[3].data[2]; }
+		constexpr type const &_41() const noexcept { return data[0].data[3]; }
+		constexpr type const &_42() const noexcept { return data[1].data[3]; }
+		constexpr type const &_43() const noexcept { return data[2].data[3]; }
+		constexpr type const &_44() const noexcept { return data[3].data[3]; }
+
+		TVector4<T> data[4] = {};
+	};
+
+	/**
+	 * @brief TMatrix4x4 placed on a cache line boundary, a float matrix
+	 *        fills exactly one line and a double row never straddles two
+	 */
+	template <class T>
+	struct alignas(64) TMatrix4x4A : TMatrix4x4<T>
+	{
+		using TMatrix4x4<T>::TMatrix4x4;
+
+		constexpr TMatrix4x4A() noexcept = default;
+		constexpr TMatrix4x4A(TMatrix4x4<T> const &m) noexcept : TMatrix4x4<T>(m)
+		{
+		}
+	};
+
 	// -------------------------- M identity  -------------------------- //
 
 	template <class T>
@@ -95,6 +199,18 @@ namespace micro::math
 				   sum(l.data[3] * r)};
 	}
 
+	/**
+	 * @brief Column-major product, a broadcast multiply-add over the columns
+	 */
+	template <class T>
+	constexpr TVector4<T> operator*(TMatrix4x4<T, ColumnMajor> const &l, TVector4<T> const &r) noexcept
+	{
+		return l.data[0] * r.x() +
+		       l.data[1] * r.y() +
+		       l.data[2] * r.z() +
+		       l.data[3] * r.w();
+	}
+
 	// ------------------------- MM arithmetic ------------------------- //
 
 	template <class T>
@@ -378,6 +494,101 @@ namespace micro::math
 				     vector_cast<U>(src.data[2]),
 				     vector_cast<U>(src.data[3])};
 	}
+
+	// -------------------------- Column-major ------------------------- //
+
+	template <class T>
+	constexpr TMatrix4x4<T, ColumnMajor> operator+(TMatrix4x4<T, ColumnMajor> const &l,
+						       TMatrix4x4<T, ColumnMajor> const &r) noexcept
+	{
+		return TMatrix4x4<T, ColumnMajor>{l.data[0] + r.data[0],
+						  l.data[1] + r.data[1],
+						  l.data[2] + r.data[2],
+						  l.data[3] + r.data[3]};
+	}
+
+	template <class T>
+	constexpr TMatrix4x4<T, ColumnMajor> operator-(TMatrix4x4<T, ColumnMajor> const &l,
+						       TMatrix4x4<T, ColumnMajor> const &r) noexcept
+	{
+		return TMatrix4x4<T, ColumnMajor>{l.data[0] - r.data[0],
+						  l.data[1] - r.data[1],
+						  l.data[2] - r.data[2],
+						  l.data[3] - r.data[3]};
+	}
+
+	template <class T>
+	constexpr TMatrix4x4<T, ColumnMajor> operator+(TMatrix4x4<T, ColumnMajor> const &a) noexcept
+	{
+		return a;
+	}
+
+	template <class T>
+	constexpr TMatrix4x4<T, ColumnMajor> operator-(TMatrix4x4<T, ColumnMajor> const &a) noexcept
+	{
+		return TMatrix4x4<T, ColumnMajor>{} - a;
+	}
+
+	template <class T>
+	constexpr TMatrix4x4<T, ColumnMajor> operator*(TMatrix4x4<T, ColumnMajor> const &l,
+						       TMatrix4x4<T, ColumnMajor> const &r) noexcept
+	{
+		return TMatrix4x4<T, ColumnMajor>{l * r.data[0],
+						  l * r.data[1],
+						  l * r.data[2],
+						  l * r.data[3]};
+	}
+
+	template <class T>
+	constexpr TMatrix4x4<T, ColumnMajor> transpose(TMatrix4x4<T, ColumnMajor> const &m) noexcept
+	{
+		return TMatrix4x4<T, ColumnMajor>{m._11(), m._21(), m._31(), m._41(),
+						  m._12(), m._22(), m._32(), m._42(),
+						  m._13(), m._23(), m._33(), m._43(),
+						  m._14(), m._24(), m._34(), m._44()};
+	}
+
+	/**
+	 * @brief The columns read as rows form the transpose, which has the
+	 *        same determinant
+	 */
+	template <class T>
+	constexpr T det(TMatrix4x4<T, ColumnMajor> const &m) noexcept
+	{
+		return det(TMatrix4x4<T>{m.data[0], m.data[1], m.data[2], m.data[3]});
+	}
+
+	/**
+	 * @brief The rows of inverse(transpose(m)) are the columns of inverse(m)
+	 */
+	template <class T>
+	constexpr TMatrix4x4<T, ColumnMajor> inverse(TMatrix4x4<T, ColumnMajor> const &m) noexcept
+	{
+		auto const r = inverse(TMatrix4x4<T>{m.data[0], m.data[1], m.data[2], m.data[3]});
+
+		return TMatrix4x4<T, ColumnMajor>{r.data[0], r.data[1], r.data[2], r.data[3]};
+	}
+
+	/**
+	 * @brief Same matrix in the other storage order
+	 */
+	template <class T>
+	constexpr TMatrix4x4<T, ColumnMajor> column_major(TMatrix4x4<T> const &m) noexcept
+	{
+		return TMatrix4x4<T, ColumnMajor>{m._11(), m._12(), m._13(), m._14(),
+						  m._21(), m._22(), m._23(), m._24(),
+						  m._31(), m._32(), m._33(), m._34(),
+						  m._41(), m._42(), m._43(), m._44()};
+	}
+
+	template <class T>
+	constexpr TMatrix4x4<T> row_major(TMatrix4x4<T, ColumnMajor> const &m) noexcept
+	{
+		return TMatrix4x4<T>{m._11(), m._12(), m._13(), m._14(),
+				     m._21(), m._22(), m._23(), m._24(),
+				     m._31(), m._32(), m._33(), m._34(),
+				     m._41(), m._42(), m._43(), m._44()};
+	}
 }
 
 #endif
\ No newline at end of file
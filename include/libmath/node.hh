@@ -0,0 +1,164 @@
+#ifndef MICRO_LIBMATH_NODE_HH__GUARD
+#define MICRO_LIBMATH_NODE_HH__GUARD
+
+#include <cmath>
+#include <cstdint>
+
+#include "matrix3x4.hh"
+#include "matrix4x4.hh"
+#include "matrix4xN_transform.hh"
+#include "vector3.hh"
+#include "vector4.hh"
+
+namespace micro::math
+{
+	/**
+	 * @brief Translation, rotation and scale with lazily rebuilt matrices
+	 *
+	 * The local matrix is only rebuilt after one of its inputs changed, the
+	 * world matrix after the local one or the world matrix of the parent
+	 * changed. Every world rebuild bumps generation(), children compare it
+	 * with the last generation they saw, so a static hierarchy costs one
+	 * walk up the parent chain and no arithmetic.
+	 *
+	 * A node is not thread-safe and a parent must outlive its children.
+	 */
+	template <class T>
+	class TTransformNode
+	{
+	public:
+		explicit TTransformNode(TVector3<T> const &t = {},
+					TVector4<T> const &r = {T(0), T(0), T(0), T(1)},
+					TVector3<T> const &s = {T(1), T(1), T(1)}) noexcept
+		{
+			m_translation = t;
+			m_rotation = r;
+			m_scale = s;
+		}
+
+		TTransformNode(TTransformNode const &) = delete;
+		TTransformNode &operator=(TTransformNode const &) = delete;
+
+		void set_parent(TTransformNode *parent) noexcept
+		{
+			m_parent = parent;
+			m_seen = 0;
+			m_dirty |= dirty_world;
+		}
+
+		void set_translation(TVector3<T> const &t) noexcept
+		{
+			m_translation = t;
+			m_dirty |= dirty_local;
+		}
+
+		/**
+		 * @param q unit quaternion as (x, y, z, w)
+		 */
+		void set_rotation(TVector4<T> const &q) noexcept
+		{
+			m_rotation = q;
+			m_dirty |= dirty_local;
+		}
+
+		/**
+		 * @param u normalized rotation axis
+		 */
+		void set_rotation(TVector3<T> const &u, T angle) noexcept
+		{
+			auto const s = std::sin(angle / T(2));
+			auto const c = std::cos(angle / T(2));
+
+			set_rotation(TVector4<T>{u.x() * s, u.y() * s, u.z() * s, c});
+		}
+
+		void set_scale(TVector3<T> const &s) noexcept
+		{
+			m_scale = s;
+			m_dirty |= dirty_local;
+		}
+
+		TTransformNode *parent() const noexcept { return m_parent; }
+
+		TVector3<T> const &translation() const noexcept { return m_translation; }
+		TVector4<T> const &rotation() const noexcept { return m_rotation; }
+		TVector3<T> const &scale() const noexcept { return m_scale; }
+
+		TMatrix4x4<T> const &local() noexcept
+		{
+			if (m_dirty & dirty_local)
+			{
+				m_local = trs4x4(m_translation, m_rotation, m_scale);
+
+				m_dirty = (m_dirty & ~dirty_local) | dirty_world;
+			}
+
+			return m_local;
+		}
+
+		TMatrix4x4<T> const &world() noexcept
+		{
+			auto const &l = local();
+
+			if (m_parent)
+			{
+				m_parent->world();
+
+				if (m_parent->m_generation != m_seen)
+				{
+					m_seen = m_parent->m_generation;
+					m_dirty |= dirty_world;
+				}
+			}
+
+			if (m_dirty & dirty_world)
+			{
+				m_world = m_parent ? m_parent->m_world * l : l;
+				m_world3x4 = TMatrix3x4<T>{m_world.data[0], m_world.data[1], m_world.data[2]};
+
+				m_dirty &= ~dirty_world;
+				m_generation++;
+			}
+
+			return m_world;
+		}
+
+		/**
+		 * @brief Rows 1-3 of world(), the last row of an affine transform
+		 *        is always (0, 0, 0, 1)
+		 */
+		TMatrix3x4<T> const &world3x4() noexcept
+		{
+			world();
+
+			return m_world3x4;
+		}
+
+		/**
+		 * @brief Number of world matrix rebuilds so far
+		 */
+		std::uint32_t generation() const noexcept { return m_generation; }
+
+	private:
+		static constexpr std::uint8_t dirty_local = 0x01;
+		static constexpr std::uint8_t dirty_world = 0x02;
+
+		TMatrix4x4<T> m_local;
+		TMatrix4x4<T> m_world;
+		TMatrix3x4<T> m_world3x4;
+
+		TVector3<T> m_translation;
+		TVector4<T> m_rotation;
+		TVector3<T> m_scale;
+
+		TTransformNode *m_parent = nullptr;
+
+		std::uint32_t m_generation = 0;
+		std::uint32_t m_seen = 0;
+		std::uint8_t m_dirty = dirty_local | dirty_world;
+	};
+
+	using TransformNode = TTransformNode<float>;
+}
+
+#endif
\ No newline at end of file
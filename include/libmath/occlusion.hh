@@ -0,0 +1,456 @@
+#ifndef MICRO_LIBMATH_OCCLUSION_HH__GUARD
+#define MICRO_LIBMATH_OCCLUSION_HH__GUARD
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "aabb.hh"
+#include "project.hh"
+
+//
+// The rasterisers spell every multiply-add out as fused where the target has
+// FMA, a contracting compiler (-ffp-contract=fast, the aarch64 default) then
+// has nothing left to fuse differently in the scalar and SIMD paths.
+//
+
+#if defined(__FMA__) || defined(__AVX2__) || defined(__ARM_FEATURE_FMA)
+#define MICRO_LIBMATH_OCCLUSION_FMA 1
+#endif
+
+namespace micro::math
+{
+	/**
+	 * @return a * b + c, rounded once with MICRO_LIBMATH_OCCLUSION_FMA
+	 */
+	template <class T>
+	inline T raster_madd(T a, T b, T c) noexcept
+	{
+#ifdef MICRO_LIBMATH_OCCLUSION_FMA
+		return std::fma(a, b, c);
+#else
+		return a * b + c;
+#endif
+	}
+
+	/**
+	 * @brief Depth-only occlusion buffer split into 8x8 pixel tiles
+	 *
+	 * Depth is NDC z (0 near, 1 far) stored tile by tile so that a tile is
+	 * 64 contiguous values. Every tile keeps the min and max depth of its
+	 * pixels and the list of occluder triangles overlapping it.
+	 */
+	template <class T>
+	struct TOcclusionBuffer
+	{
+		static constexpr std::size_t tile = 8;
+
+		//
+		//
+
+		TOcclusionBuffer(std::size_t w,
+				 std::size_t h)
+		{
+			width = w;
+			height = h;
+			tiles_x = (w + tile - 1) / tile;
+			tiles_y = (h + tile - 1) / tile;
+
+			depth.assign(tiles_x * tiles_y * tile * tile, T(1));
+			tile_min.assign(tiles_x * tiles_y, T(1));
+			tile_max.assign(tiles_x * tiles_y, T(1));
+			bins.resize(tiles_x * tiles_y);
+		}
+
+		TViewport<T> viewport() const noexcept { return TViewport<T>{T(0), T(0), T(width), T(height)}; }
+
+		std::size_t tiles() const noexcept { return tiles_x * tiles_y; }
+
+		std::size_t width = 0;
+		std::size_t height = 0;
+		std::size_t tiles_x = 0;
+		std::size_t tiles_y = 0;
+
+		std::vector<T> depth;
+		std::vector<T> tile_min;
+		std::vector<T> tile_max;
+		std::vector<TVector3<T>> triangles; // 3 screen space vertices each
+		std::vector<std::vector<std::uint32_t>> bins;
+	};
+
+	using OcclusionBuffer = TOcclusionBuffer<float>;
+
+	// ----------------------------------------------------------------- //
+
+	template <class T>
+	inline void clear(TOcclusionBuffer<T> &b) noexcept
+	{
+		std::fill(b.depth.begin(), b.depth.end(), T(1));
+		std::fill(b.tile_min.begin(), b.tile_min.end(), T(1));
+		std::fill(b.tile_max.begin(), b.tile_max.end(), T(1));
+
+		b.triangles.clear();
+
+		for (auto &bin : b.bins)
+		{
+			bin.clear();
+		}
+	}
+
+	/**
+	 * @brief Adds occluder triangles to the bins of the tiles they overlap
+	 *
+	 * screen and flags come from project_batch with b.viewport(). Triangles
+	 * with a vertex in front of the near plane are dropped, which can only
+	 * make the buffer less occluding; vertices beyond the viewport or the
+	 * far plane are kept, the tile clamp and edge tests cut them. Both
+	 * windings are accepted.
+	 *
+	 * @param indices 3 vertex indices per triangle
+	 */
+	template <class T>
+	inline void bin_triangles(TOcclusionBuffer<T> &b,
+				  TVector3<T> const *screen,
+				  std::uint8_t const *flags,
+				  std::uint32_t const *indices, std::size_t n)
+	{
+		auto const W = T(b.width);
+		auto const H = T(b.height);
+
+		for (std::size_t i = 0; i < n; i++)
+		{
+			auto const i0 = indices[i * 3 + 0];
+			auto const i1 = indices[i * 3 + 1];
+			auto const i2 = indices[i * 3 + 2];
+
+			if ((flags[i0] | flags[i1] | flags[i2]) & clip_near)
+			{
+				continue;
+			}
+
+			auto const &a = screen[i0];
+			auto const &c = screen[i1];
+			auto const &d = screen[i2];
+
+			auto const x = std::fmin(std::fmin(a.x(), c.x()), d.x());
+			auto const X = std::fmax(std::fmax(a.x(), c.x()), d.x());
+			auto const y = std::fmin(std::fmin(a.y(), c.y()), d.y());
+			auto const Y = std::fmax(std::fmax(a.y(), c.y()), d.y());
+
+			if (X < T(0) || Y < T(0) || x >= W || y >= H)
+			{
+				continue;
+			}
+
+			auto const tx = std::size_t(std::fmax(x, T(0))) / b.tile;
+			auto const ty = std::size_t(std::fmax(y, T(0))) / b.tile;
+			auto const TX = std::size_t(std::fmin(X, W - T(1))) / b.tile;
+			auto const TY = std::size_t(std::fmin(Y, H - T(1))) / b.tile;
+
+			auto const k = std::uint32_t(b.triangles.size() / 3);
+
+			b.triangles.push_back(a);
+			b.triangles.push_back(c);
+			b.triangles.push_back(d);
+
+			for (auto v = ty; v <= TY; v++)
+			{
+				for (auto u = tx; u <= TX; u++)
+				{
+					b.bins[v * b.tiles_x + u].push_back(k);
+				}
+			}
+		}
+	}
+
+	/**
+	 * @brief Edge function a x + (b y + c) of the edge p -> q, twice the
+	 *        signed area of the triangle (p, q, (x, y))
+	 *
+	 * The rasterisers evaluate row(y) once per pixel row and then a x on
+	 * top of it with raster_madd, the SIMD kernels do the same per lane.
+	 */
+	template <class T>
+	struct TEdge
+	{
+		constexpr TEdge() noexcept = default;
+
+		TEdge(TVector3<T> const &p,
+		      TVector3<T> const &q) noexcept
+		{
+			a = p.y() - q.y();
+			b = q.x() - p.x();
+			c = raster_madd(p.x(), q.y(), -(p.y() * q.x()));
+		}
+
+		T row(T y) const noexcept { return raster_madd(b, y, c); }
+
+		T operator()(T x, T y) const noexcept { return raster_madd(a, x, row(y)); }
+
+		T a = {};
+		T b = {};
+		T c = {};
+	};
+
+	/**
+	 * @brief Triangle setup shared by the tile rasterisers
+	 *
+	 * e[0..2] are the edges opposite to each vertex, scaled by 1 / area so
+	 * they evaluate to barycentric coordinates.
+	 *
+	 * @return false for degenerate triangles
+	 */
+	template <class T>
+	inline bool setup_triangle(TEdge<T> (&e)[3],
+				   T (&z)[3],
+				   TVector3<T> const *v) noexcept
+	{
+		auto p = v[0];
+		auto q = v[1];
+		auto r = v[2];
+
+		auto area = TEdge<T>{p, q}(r.x(), r.y());
+
+		if (area == T(0))
+		{
+			return false;
+		}
+
+		if (area < T(0))
+		{
+			std::swap(q, r);
+			area = -area;
+		}
+
+		e[0] = TEdge<T>{q, r};
+		e[1] = TEdge<T>{r, p};
+		e[2] = TEdge<T>{p, q};
+
+		for (auto &f : e)
+		{
+			f.a /= area;
+			f.b /= area;
+			f.c /= area;
+		}
+
+		z[0] = p.z();
+		z[1] = q.z() - p.z();
+		z[2] = r.z() - p.z();
+
+		return true;
+	}
+
+	template <class T>
+	inline void update_tile(TOcclusionBuffer<T> &b, std::size_t t) noexcept
+	{
+		auto const *d = b.depth.data() + t * b.tile * b.tile;
+
+		auto lo = d[0];
+		auto hi = d[0];
+
+		for (std::size_t i = 1; i < b.tile * b.tile; i++)
+		{
+			lo = d[i] < lo ? d[i] : lo;
+			hi = d[i] > hi ? d[i] : hi;
+		}
+
+		b.tile_min[t] = lo;
+		b.tile_max[t] = hi;
+	}
+
+	/**
+	 * @brief Rasterises the bins of tiles [first, last), distinct ranges can
+	 *        run concurrently
+	 *
+	 * Pixel centres on an edge are covered, depth is the minimum of the
+	 * interpolated z of the covering triangles.
+	 */
+	template <class T>
+	inline void rasterize_tiles(TOcclusionBuffer<T> &b,
+				    std::size_t first,
+				    std::size_t last) noexcept
+	{
+		for (auto t = first; t < last; t++)
+		{
+			auto const x0 = T((t % b.tiles_x) * b.tile) + T(.5);
+			auto const y0 = T((t / b.tiles_x) * b.tile) + T(.5);
+
+			auto *d = b.depth.data() + t * b.tile * b.tile;
+
+			for (auto k : b.bins[t])
+			{
+				TEdge<T> e[3];
+				T z[3];
+
+				if (!setup_triangle(e, z, b.triangles.data() + k * 3))
+				{
+					continue;
+				}
+
+				for (std::size_t y = 0; y < b.tile; y++)
+				{
+					auto const py = y0 + T(y);
+					auto const r0 = e[0].row(py);
+					auto const r1 = e[1].row(py);
+					auto const r2 = e[2].row(py);
+
+					for (std::size_t x = 0; x < b.tile; x++)
+					{
+						auto const px = x0 + T(x);
+						auto const l0 = raster_madd(e[0].a, px, r0);
+						auto const l1 = raster_madd(e[1].a, px, r1);
+						auto const l2 = raster_madd(e[2].a, px, r2);
+
+						if (l0 >= T(0) && l1 >= T(0) && l2 >= T(0))
+						{
+							auto const s = z[0] + raster_madd(l2, z[2], l1 * z[1]);
+							auto &o = d[y * b.tile + x];
+
+							o = s < o ? s : o;
+						}
+					}
+				}
+			}
+
+			update_tile(b, t);
+		}
+	}
+
+	/**
+	 * @brief Runs f(first, last) over chunks of n tiles on up to threads
+	 *        workers, the calling thread takes part in the work
+	 */
+	template <class F>
+	inline void parallel_tiles(std::size_t n, unsigned threads, F &&f)
+	{
+		constexpr std::size_t chunk = 4;
+
+		std::atomic<std::size_t> next{0};
+
+		auto const work = [&]()
+		{
+			for (auto i = next.fetch_add(chunk); i < n; i = next.fetch_add(chunk))
+			{
+				f(i, i + chunk < n ? i + chunk : n);
+			}
+		};
+
+		std::vector<std::thread> pool;
+
+		for (unsigned i = 1; i < threads; i++)
+		{
+			pool.emplace_back(work);
+		}
+
+		work();
+
+		for (auto &t : pool)
+		{
+			t.join();
+		}
+	}
+
+	template <class T>
+	inline void rasterize(TOcclusionBuffer<T> &b, unsigned threads = 1)
+	{
+		parallel_tiles(b.tiles(), threads, [&b](std::size_t first, std::size_t last)
+		{
+			rasterize_tiles(b, first, last);
+		});
+	}
+
+	// ---------------------------- Queries ---------------------------- //
+
+	/**
+	 * @brief Tests a box against the rasterised occluders
+	 *
+	 * The screen rectangle of the box is taken at its nearest depth, tiles
+	 * are rejected on their max depth and accepted on their min depth, the
+	 * pixels are only read in between. Boxes crossing the near plane or
+	 * lying outside the viewport are never reported as occluded.
+	 *
+	 * @param m view-projection matrix times the model matrix of the box
+	 */
+	template <class T>
+	inline bool occluded(TOcclusionBuffer<T> const &b,
+			     TMatrix4x4<T> const &m,
+			     TAABB<T> const &box) noexcept
+	{
+		auto x = std::numeric_limits<T>::max();
+		auto y = std::numeric_limits<T>::max();
+		auto z = std::numeric_limits<T>::max();
+		auto X = std::numeric_limits<T>::lowest();
+		auto Y = std::numeric_limits<T>::lowest();
+
+		for (auto i = 0; i < 8; i++)
+		{
+			auto const c = m * TVector4<T>{box.data[(i >> 0) & 1].x(),
+						       box.data[(i >> 1) & 1].y(),
+						       box.data[(i >> 2) & 1].z(), T(1)};
+
+			if (c.w() <= T(0) || c.z() < T(0))
+			{
+				return false;
+			}
+
+			auto const s = viewport(b.viewport(), TVector3<T>{c.x() / c.w(), c.y() / c.w(), c.z() / c.w()});
+
+			x = s.x() < x ? s.x() : x;
+			y = s.y() < y ? s.y() : y;
+			z = s.z() < z ? s.z() : z;
+			X = s.x() > X ? s.x() : X;
+			Y = s.y() > Y ? s.y() : Y;
+		}
+
+		auto const x0 = std::size_t(std::fmax(std::floor(x), T(0)));
+		auto const y0 = std::size_t(std::fmax(std::floor(y), T(0)));
+		auto const x1 = std::size_t(std::fmin(std::fmax(std::ceil(X), T(0)), T(b.width)));
+		auto const y1 = std::size_t(std::fmin(std::fmax(std::ceil(Y), T(0)), T(b.height)));
+
+		if (x0 >= x1 || y0 >= y1)
+		{
+			return false;
+		}
+
+		for (auto ty = y0 / b.tile; ty <= (y1 - 1) / b.tile; ty++)
+		{
+			for (auto tx = x0 / b.tile; tx <= (x1 - 1) / b.tile; tx++)
+			{
+				auto const t = ty * b.tiles_x + tx;
+
+				if (z <= b.tile_min[t])
+				{
+					return false;
+				}
+
+				if (z > b.tile_max[t])
+				{
+					continue;
+				}
+
+				auto const *d = b.depth.data() + t * b.tile * b.tile;
+
+				for (auto py = std::max(y0, ty * b.tile); py < std::min(y1, ty * b.tile + b.tile); py++)
+				{
+					for (auto px = std::max(x0, tx * b.tile); px < std::min(x1, tx * b.tile + b.tile); px++)
+					{
+						if (z <= d[(py % b.tile) * b.tile + px % b.tile])
+						{
+							return false;
+						}
+					}
+				}
+			}
+		}
+
+		return true;
+	}
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,118 @@
+#ifndef MICRO_LIBMATH_ORIGIN_HH__GUARD
+#define MICRO_LIBMATH_ORIGIN_HH__GUARD
+
+#include <cmath>
+#include <cstddef>
+
+#include "matrix3x4.hh"
+#include "matrix4x4.hh"
+#include "vector3.hh"
+
+//
+// Large worlds keep positions in double and rebase them once per frame
+// onto a floating origin near the camera. Everything downstream (model,
+// view, projection, culling) then runs in float on small coordinates,
+// which keeps float precision where the camera looks at half the cost.
+//
+
+namespace micro::math
+{
+	/**
+	 * @brief Snaps the eye position to a grid of the given cell size
+	 *
+	 * Moving the origin in discrete steps keeps rebased data valid while
+	 * the eye stays within a cell, it only has to be rebuilt when the
+	 * returned origin changes.
+	 */
+	template <class T>
+	inline TVector3<T> snap_origin(TVector3<T> const &eye, T cell) noexcept
+	{
+		return TVector3<T>{std::floor(eye.x() / cell) * cell,
+				   std::floor(eye.y() / cell) * cell,
+				   std::floor(eye.z() / cell) * cell};
+	}
+
+	/**
+	 * @brief Position relative to origin, subtracted at full precision and
+	 *        then narrowed
+	 */
+	template <class U, class T>
+	constexpr TVector3<U> rebase(TVector3<T> const &p, TVector3<T> const &origin) noexcept
+	{
+		return TVector3<U>{static_cast<U>(p.x() - origin.x()),
+				   static_cast<U>(p.y() - origin.y()),
+				   static_cast<U>(p.z() - origin.z())};
+	}
+
+	/**
+	 * @brief Affine transform with its translation relative to origin
+	 */
+	template <class U, class T>
+	constexpr TMatrix3x4<U> rebase(TMatrix3x4<T> const &m, TVector3<T> const &origin) noexcept
+	{
+		TMatrix3x4<U> r;
+
+		for (int i = 0; i < 3; i++)
+		{
+			r.data[i] = TVector4<U>{static_cast<U>(m.data[i].x()),
+						static_cast<U>(m.data[i].y()),
+						static_cast<U>(m.data[i].z()),
+						static_cast<U>(m.data[i].w() - origin.data[i])};
+		}
+
+		return r;
+	}
+
+	/**
+	 * @brief View matrix for rebased positions, view * translate(origin)
+	 *
+	 * Built from a full precision view matrix, the large translations of
+	 * the eye and the origin cancel before the single narrowing.
+	 */
+	template <class U, class T>
+	constexpr TMatrix4x4<U> rebase_view(TMatrix4x4<T> const &view, TVector3<T> const &origin) noexcept
+	{
+		TMatrix4x4<U> r;
+
+		for (int i = 0; i < 4; i++)
+		{
+			auto const &v = view.data[i];
+
+			r.data[i] = TVector4<U>{static_cast<U>(v.x()),
+						static_cast<U>(v.y()),
+						static_cast<U>(v.z()),
+						static_cast<U>(v.x() * origin.x() + v.y() * origin.y() + v.z() * origin.z() + v.w())};
+		}
+
+		return r;
+	}
+
+	// ----------------------------- Batch ----------------------------- //
+
+	/**
+	 * @brief dst[i] = rebase<U>(src[i], origin)
+	 */
+	template <class U, class T>
+	inline void rebase_batch(TVector3<U> *dst,
+				 TVector3<T> const *src,
+				 TVector3<T> const &origin, std::size_t n) noexcept
+	{
+		for (std::size_t i = 0; i < n; i++)
+		{
+			dst[i] = rebase<U>(src[i], origin);
+		}
+	}
+
+	template <class U, class T>
+	inline void rebase_batch(TMatrix3x4<U> *dst,
+				 TMatrix3x4<T> const *src,
+				 TVector3<T> const &origin, std::size_t n) noexcept
+	{
+		for (std::size_t i = 0; i < n; i++)
+		{
+			dst[i] = rebase<U>(src[i], origin);
+		}
+	}
+}
+
+#endif
\ No newline at end of file
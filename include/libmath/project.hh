@@ -0,0 +1,155 @@
+#ifndef MICRO_LIBMATH_PROJECT_HH__GUARD
+#define MICRO_LIBMATH_PROJECT_HH__GUARD
+
+#include <cstddef>
+#include <cstdint>
+
+#include "vector.hh"
+#include "matrix4x4.hh"
+
+namespace micro::math
+{
+	/**
+	 * @brief Screen rectangle in pixels, the origin is the top left corner
+	 */
+	template <class T,
+		  class F = std::enable_if_t<std::is_arithmetic_v<T>, int>>
+	struct TViewport
+	{
+		typedef std::remove_reference_t<std::remove_cv_t<T>> type;
+
+		//
+		//
+
+		constexpr TViewport(type x = {},
+				    type y = {},
+				    type w = {},
+				    type h = {}) noexcept
+		{
+			data[0] = x;
+			data[1] = y;
+			data[2] = w;
+			data[3] = h;
+		}
+
+		constexpr type &x() noexcept { return data[0]; }
+		constexpr type &y() noexcept { return data[1]; }
+		constexpr type &w() noexcept { return data[2]; }
+		constexpr type &h() noexcept { return data[3]; }
+		constexpr type const &x() const noexcept { return data[0]; }
+		constexpr type const &y() const noexcept { return data[1]; }
+		constexpr type const &w() const noexcept { return data[2]; }
+		constexpr type const &h() const noexcept { return data[3]; }
+
+		type data[4] = {};
+	};
+
+	using Viewport = TViewport<float>;
+
+	// ----------------------------------------------------------------- //
+
+	/**
+	 * @brief Outcodes against the clip volume -w <= x, y <= w, 0 <= z <= w
+	 *        (the depth range of persp_projection4x4)
+	 */
+	constexpr std::uint8_t clip_left   = 0x01;
+	constexpr std::uint8_t clip_right  = 0x02;
+	constexpr std::uint8_t clip_bottom = 0x04;
+	constexpr std::uint8_t clip_top    = 0x08;
+	constexpr std::uint8_t clip_near   = 0x10;
+	constexpr std::uint8_t clip_far    = 0x20;
+
+	template <class T>
+	constexpr std::uint8_t clip_flags(TVector4<T> const &c) noexcept
+	{
+		return std::uint8_t((c.x() < -c.w() ? clip_left   : 0) |
+				    (c.x() >  c.w() ? clip_right  : 0) |
+				    (c.y() < -c.w() ? clip_bottom : 0) |
+				    (c.y() >  c.w() ? clip_top    : 0) |
+				    (c.z() <  T(0)  ? clip_near   : 0) |
+				    (c.z() >  c.w() ? clip_far    : 0));
+	}
+
+	/**
+	 * @brief Maps NDC onto the viewport, y points down and z is kept as depth
+	 */
+	template <class T>
+	constexpr TVector3<T> viewport(TViewport<T> const &v, TVector3<T> const &ndc) noexcept
+	{
+		auto const w = v.w() / T(2);
+		auto const h = v.h() / T(2);
+
+		return TVector3<T>{v.x() + w + ndc.x() * w,
+				   v.y() + h - ndc.y() * h,
+				   ndc.z()};
+	}
+
+	// ----------------------------- Batch ----------------------------- //
+
+	/**
+	 * @brief Projects src through a view-projection matrix
+	 *
+	 * Any of clip, ndc, screen and flags may be null. Vertices outside the
+	 * side and far planes are projected like any other, only the NDC and
+	 * screen coordinates of a vertex flagged clip_near are unspecified (its
+	 * w may be zero or negative).
+	 *
+	 * @return Number of vertices inside the clip volume, their indices are
+	 *         written to visible in ascending order when it is not null
+	 *         (visible must have room for n indices)
+	 */
+	template <class T>
+	inline std::size_t project_batch(TVector4<T> *clip,
+					 TVector3<T> *ndc,
+					 TVector3<T> *screen,
+					 std::uint8_t *flags,
+					 TMatrix4x4<T> const &m,
+					 TViewport<T> const &v,
+					 TVector3<T> const *src, std::size_t n,
+					 std::uint32_t *visible = nullptr) noexcept
+	{
+		std::size_t k = 0;
+
+		for (std::size_t i = 0; i < n; i++)
+		{
+			auto const c = m * TVector4<T>{src[i].x(), src[i].y(), src[i].z(), T(1)};
+			auto const f = clip_flags(c);
+			auto const r = T(1) / c.w();
+			auto const d = TVector3<T>{c.x() * r, c.y() * r, c.z() * r};
+
+			if (clip)
+			{
+				clip[i] = c;
+			}
+
+			if (ndc)
+			{
+				ndc[i] = d;
+			}
+
+			if (screen)
+			{
+				screen[i] = viewport(v, d);
+			}
+
+			if (flags)
+			{
+				flags[i] = f;
+			}
+
+			if (f == 0)
+			{
+				if (visible)
+				{
+					visible[k] = std::uint32_t(i);
+				}
+
+				k++;
+			}
+		}
+
+		return k;
+	}
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,241 @@
+#ifndef MICRO_LIBMATH_QUANTIZE_HH__GUARD
+#define MICRO_LIBMATH_QUANTIZE_HH__GUARD
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+#include "aabb.hh"
+#include "vector.hh"
+#include "matrix3x3.hh"
+#include "matrix3xN_transform.hh"
+
+namespace micro::math
+{
+	/**
+	 * @brief Unit vector folded onto an octahedron, 2 x 16-bit snorm
+	 */
+	struct PackedNormal
+	{
+		std::int16_t data[2] = {};
+	};
+
+	/**
+	 * @brief Unit quaternion, smallest three components in 3 x 15 bits
+	 *
+	 * Bit 0 of data[0] and data[1] hold the index of the dropped (largest)
+	 * component, bits 1-15 of each word hold one remaining component.
+	 */
+	struct PackedQuaternion
+	{
+		std::uint16_t data[3] = {};
+	};
+
+	/**
+	 * @brief Position as 3 x 16-bit unorm inside a bounding box
+	 */
+	struct PackedPosition
+	{
+		std::uint16_t data[3] = {};
+	};
+
+	// ----------------------------------------------------------------- //
+
+	constexpr float quantize_snorm16 = 32767.f;
+	constexpr float quantize_unorm15 = 32767.f;
+	constexpr float quantize_unorm16 = 65535.f;
+
+	/**
+	 * @brief Range of the three smallest components of a unit quaternion
+	 */
+	constexpr float quantize_sqrt1_2 = 0.70710678118654752f;
+
+	// ----------------------------------------------------------------- //
+
+	/**
+	 * @brief Octahedral encoding, the zero vector encodes as (0, 0), +Z
+	 */
+	inline PackedNormal encode_normal(TVector3<float> const &n) noexcept
+	{
+		auto const s = std::abs(n.x()) + std::abs(n.y()) + std::abs(n.z());
+		auto x = s > 0.f ? n.x() / s : 0.f;
+		auto y = s > 0.f ? n.y() / s : 0.f;
+
+		if (n.z() < 0.f)
+		{
+			auto const u = (1.f - std::abs(y)) * (x < 0.f ? -1.f : 1.f);
+			auto const v = (1.f - std::abs(x)) * (y < 0.f ? -1.f : 1.f);
+
+			x = u;
+			y = v;
+		}
+
+		return PackedNormal{{static_cast<std::int16_t>(std::nearbyint(x * quantize_snorm16)),
+				     static_cast<std::int16_t>(std::nearbyint(y * quantize_snorm16))}};
+	}
+
+	inline TVector3<float> decode(PackedNormal const &e) noexcept
+	{
+		auto x = e.data[0] / quantize_snorm16;
+		auto y = e.data[1] / quantize_snorm16;
+		auto z = 1.f - std::abs(x) - std::abs(y);
+		auto t = z < 0.f ? -z : 0.f;
+
+		x = x - std::copysign(t, x);
+		y = y - std::copysign(t, y);
+
+		return normalize(TVector3<float>{x, y, z});
+	}
+
+	// ----------------------------------------------------------------- //
+
+	inline PackedQuaternion encode_quaternion(TVector4<float> const &q) noexcept
+	{
+		auto k = 0;
+
+		for (auto i = 1; i < 4; i++)
+		{
+			k = std::abs(q.data[i]) > std::abs(q.data[k]) ? i : k;
+		}
+
+		//
+		// q and -q are the same rotation, flip so that the dropped component is positive
+		//
+
+		auto const s = q.data[k] < 0.f ? -1.f : 1.f;
+
+		std::uint16_t o[3];
+
+		for (auto i = 0, j = 0; i < 4; i++)
+		{
+			if (i != k)
+			{
+				auto const v = (s * q.data[i] / quantize_sqrt1_2) * .5f + .5f;
+				auto const c = v < 0.f ? 0.f : v > 1.f ? 1.f : v;
+
+				o[j++] = static_cast<std::uint16_t>(std::nearbyint(c * quantize_unorm15));
+			}
+		}
+
+		return PackedQuaternion{{static_cast<std::uint16_t>(o[0] << 1 | k >> 1),
+					 static_cast<std::uint16_t>(o[1] << 1 | (k & 1)),
+					 static_cast<std::uint16_t>(o[2] << 1)}};
+	}
+
+	inline TVector4<float> decode(PackedQuaternion const &e) noexcept
+	{
+		auto const k = (e.data[0] & 1) << 1 | (e.data[1] & 1);
+		auto const a = ((e.data[0] >> 1) / quantize_unorm15 - .5f) * 2.f * quantize_sqrt1_2;
+		auto const b = ((e.data[1] >> 1) / quantize_unorm15 - .5f) * 2.f * quantize_sqrt1_2;
+		auto const c = ((e.data[2] >> 1) / quantize_unorm15 - .5f) * 2.f * quantize_sqrt1_2;
+		auto const d = 1.f - a * a - b * b - c * c;
+		auto const w = std::sqrt(d < 0.f ? 0.f : d);
+
+		switch (k)
+		{
+		case 0:
+			return TVector4<float>{w, a, b, c};
+		case 1:
+			return TVector4<float>{a, w, b, c};
+		case 2:
+			return TVector4<float>{a, b, w, c};
+		default:
+			return TVector4<float>{a, b, c, w};
+		}
+	}
+
+	// ----------------------------------------------------------------- //
+
+	inline PackedPosition encode_position(TVector3<float> const &p, TAABB<float> const &b) noexcept
+	{
+		auto const e = extent(b);
+
+		std::uint16_t o[3];
+
+		for (auto i = 0; i < 3; i++)
+		{
+			auto const v = e.data[i] > 0.f ? (p.data[i] - b.lower().data[i]) / e.data[i] : 0.f;
+			auto const c = v < 0.f ? 0.f : v > 1.f ? 1.f : v;
+
+			o[i] = static_cast<std::uint16_t>(std::nearbyint(c * quantize_unorm16));
+		}
+
+		return PackedPosition{{o[0], o[1], o[2]}};
+	}
+
+	inline TVector3<float> decode(PackedPosition const &e, TAABB<float> const &b) noexcept
+	{
+		auto const s = extent(b) / quantize_unorm16;
+
+		return TVector3<float>{b.lower().x() + e.data[0] * s.x(),
+				       b.lower().y() + e.data[1] * s.y(),
+				       b.lower().z() + e.data[2] * s.z()};
+	}
+
+	// ----------------------------- Batch ----------------------------- //
+
+	template <class T>
+	inline void encode_batch(PackedNormal *dst, TVector3<T> const *src, std::size_t n) noexcept
+	{
+		for (std::size_t i = 0; i < n; i++)
+		{
+			dst[i] = encode_normal(vector_cast<float>(src[i]));
+		}
+	}
+
+	template <class T>
+	inline void decode_batch(TVector3<T> *dst, PackedNormal const *src, std::size_t n) noexcept
+	{
+		for (std::size_t i = 0; i < n; i++)
+		{
+			dst[i] = vector_cast<T>(decode(src[i]));
+		}
+	}
+
+	template <class T>
+	inline void encode_batch(PackedQuaternion *dst, TVector4<T> const *src, std::size_t n) noexcept
+	{
+		for (std::size_t i = 0; i < n; i++)
+		{
+			dst[i] = encode_quaternion(vector_cast<float>(src[i]));
+		}
+	}
+
+	template <class T>
+	inline void decode_batch(TVector4<T> *dst, PackedQuaternion const *src, std::size_t n) noexcept
+	{
+		for (std::size_t i = 0; i < n; i++)
+		{
+			dst[i] = vector_cast<T>(decode(src[i]));
+		}
+	}
+
+	template <class T>
+	inline void decode_batch(TMatrix3x3<T> *dst, PackedQuaternion const *src, std::size_t n) noexcept
+	{
+		for (std::size_t i = 0; i < n; i++)
+		{
+			dst[i] = rotate3x3(vector_cast<T>(decode(src[i])));
+		}
+	}
+
+	template <class T>
+	inline void encode_batch(PackedPosition *dst, TVector3<T> const *src, std::size_t n, TAABB<float> const &b) noexcept
+	{
+		for (std::size_t i = 0; i < n; i++)
+		{
+			dst[i] = encode_position(vector_cast<float>(src[i]), b);
+		}
+	}
+
+	template <class T>
+	inline void decode_batch(TVector3<T> *dst, PackedPosition const *src, std::size_t n, TAABB<float> const &b) noexcept
+	{
+		for (std::size_t i = 0; i < n; i++)
+		{
+			dst[i] = vector_cast<T>(decode(src[i], b));
+		}
+	}
+}
+
+#endif
\ No newline at end of file
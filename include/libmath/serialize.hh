@@ -0,0 +1,289 @@
+#ifndef MICRO_LIBMATH_SERIALIZE_HH__GUARD
+#define MICRO_LIBMATH_SERIALIZE_HH__GUARD
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+//
+// Wire format: scalars in little-endian order, one element after the
+// other with no padding or header. Vectors and matrices are plain arrays
+// of their scalar type, a matrix keeps the order of its data (rows for
+// row-major, columns for column-major).
+//
+
+namespace micro::math
+{
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+	constexpr bool serial_native = false;
+#else
+	constexpr bool serial_native = true;
+#endif
+
+	/**
+	 * @brief Scalar type and scalar count of a vector, matrix or scalar
+	 */
+	template <class T, bool = std::is_arithmetic_v<T>>
+	struct TSerialShape
+	{
+		using type = T;
+
+		static constexpr std::size_t count = 1;
+	};
+
+	template <class T>
+	struct TSerialShape<T, false>
+	{
+		using type = typename T::type;
+
+		static constexpr std::size_t count = sizeof(T) / sizeof(type);
+
+		static_assert(sizeof(T) == count * sizeof(type), "padded types are not serializable");
+	};
+
+	/**
+	 * @return Scalar j of v, counted in the order of its data
+	 */
+	template <class T>
+	constexpr auto &serial_scalar(T &v, std::size_t j) noexcept
+	{
+		if constexpr (std::is_arithmetic_v<std::remove_const_t<T>>)
+		{
+			return v;
+		}
+		else
+		{
+			constexpr auto C = TSerialShape<std::remove_const_t<T>>::count / std::extent_v<decltype(v.data)>;
+
+			return serial_scalar(v.data[j / C], j % C);
+		}
+	}
+
+	template <class T>
+	constexpr std::size_t serialized_size(std::size_t n) noexcept
+	{
+		return n * sizeof(T);
+	}
+
+	/**
+	 * @brief Reverses the bytes of every scalar of size S
+	 */
+	template <std::size_t S>
+	inline void swap_bytes(std::uint8_t *dst, std::uint8_t const *src, std::size_t n) noexcept
+	{
+		for (std::size_t i = 0; i < n; i++)
+		{
+			for (std::size_t j = 0; j < S; j++)
+			{
+				dst[i * S + j] = src[i * S + S - 1 - j];
+			}
+		}
+	}
+
+	/**
+	 * @return Number of bytes written, serialized_size<T>(n)
+	 */
+	template <class T>
+	inline std::size_t serialize_batch(std::uint8_t *dst, T const *src, std::size_t n) noexcept
+	{
+		using S = typename TSerialShape<T>::type;
+
+		if constexpr (serial_native || sizeof(S) == 1)
+		{
+			std::memcpy(dst, src, serialized_size<T>(n));
+		}
+		else
+		{
+			swap_bytes<sizeof(S)>(dst, reinterpret_cast<std::uint8_t const *>(src), n * TSerialShape<T>::count);
+		}
+
+		return serialized_size<T>(n);
+	}
+
+	/**
+	 * @return Number of bytes read, serialized_size<T>(n)
+	 */
+	template <class T>
+	inline std::size_t deserialize_batch(T *dst, std::uint8_t const *src, std::size_t n) noexcept
+	{
+		using S = typename TSerialShape<T>::type;
+
+		if constexpr (serial_native || sizeof(S) == 1)
+		{
+			std::memcpy(dst, src, serialized_size<T>(n));
+		}
+		else
+		{
+			swap_bytes<sizeof(S)>(reinterpret_cast<std::uint8_t *>(dst), src, n * TSerialShape<T>::count);
+		}
+
+		return serialized_size<T>(n);
+	}
+
+	// --------------------------- Quantized --------------------------- //
+
+	/**
+	 * @brief Stores n scalars as 16-bit unorm of the range [lo, hi], values
+	 *        outside are clamped and the error is at most (hi - lo) / 131070
+	 *
+	 * Vectors and matrices have their own overload below.
+	 *
+	 * @return Number of bytes written, 2 n
+	 */
+	template <class T>
+	inline std::size_t serialize_quantized(std::uint8_t *dst, T const *src, std::size_t n, T lo, T hi) noexcept
+	{
+		auto const s = T(65535) / (hi - lo);
+
+		for (std::size_t i = 0; i < n; i++)
+		{
+			auto const x = (src[i] - lo) * s;
+			auto const q = unsigned(std::nearbyint(x < T(0) ? T(0) : x > T(65535) ? T(65535) : x));
+
+			dst[i * 2 + 0] = std::uint8_t(q);
+			dst[i * 2 + 1] = std::uint8_t(q >> 8);
+		}
+
+		return n * 2;
+	}
+
+	template <class T>
+	inline std::size_t deserialize_quantized(T *dst, std::uint8_t const *src, std::size_t n, T lo, T hi) noexcept
+	{
+		auto const s = (hi - lo) / T(65535);
+
+		for (std::size_t i = 0; i < n; i++)
+		{
+			dst[i] = T(src[i * 2] | src[i * 2 + 1] << 8) * s + lo;
+		}
+
+		return n * 2;
+	}
+
+	/**
+	 * @brief Vectors and matrices, quantized as one run of n times their
+	 *        scalar count in the order of their data, like serialize_batch
+	 *
+	 * @return Number of bytes written, 2 n times the scalar count of T
+	 */
+	template <class T, class F = std::enable_if_t<!std::is_arithmetic_v<T>, int>>
+	inline std::size_t serialize_quantized(std::uint8_t *dst, T const *src, std::size_t n,
+					       typename TSerialShape<T>::type lo,
+					       typename TSerialShape<T>::type hi) noexcept
+	{
+		using S = typename TSerialShape<T>::type;
+
+		static_assert(std::is_standard_layout_v<T>);
+
+		return serialize_quantized(dst, reinterpret_cast<S const *>(src), n * TSerialShape<T>::count, lo, hi);
+	}
+
+	template <class T, class F = std::enable_if_t<!std::is_arithmetic_v<T>, int>>
+	inline std::size_t deserialize_quantized(T *dst, std::uint8_t const *src, std::size_t n,
+						 typename TSerialShape<T>::type lo,
+						 typename TSerialShape<T>::type hi) noexcept
+	{
+		using S = typename TSerialShape<T>::type;
+
+		static_assert(std::is_standard_layout_v<T>);
+
+		return deserialize_quantized(reinterpret_cast<S *>(dst), src, n * TSerialShape<T>::count, lo, hi);
+	}
+
+	// ----------------------------- Delta ----------------------------- //
+
+	template <class T>
+	constexpr std::size_t delta_bound(std::size_t n) noexcept
+	{
+		return n * TSerialShape<T>::count * 10;
+	}
+
+	/**
+	 * @brief Delta mode for sequences of similar vectors or matrices
+	 *
+	 * Every scalar is rounded to a multiple of step and stored as the
+	 * difference to the same scalar of the previous element (the first
+	 * element to 0), zigzag folded in a LEB128 varint. Elements that only
+	 * moved a little take one byte per scalar.
+	 *
+	 * @return Number of bytes written, at most delta_bound<T>(n)
+	 */
+	template <class T>
+	inline std::size_t serialize_delta(std::uint8_t *dst, T const *src, std::size_t n,
+					   typename TSerialShape<T>::type step) noexcept
+	{
+		constexpr auto C = TSerialShape<T>::count;
+
+		std::int64_t prev[C] = {};
+		std::size_t k = 0;
+
+		for (std::size_t i = 0; i < n; i++)
+		{
+			for (std::size_t j = 0; j < C; j++)
+			{
+				auto const q = std::int64_t(std::llrint(serial_scalar(src[i], j) / step));
+				auto const d = q - prev[j];
+				auto z = (std::uint64_t(d) << 1) ^ std::uint64_t(d >> 63);
+
+				prev[j] = q;
+
+				for (; z >= 0x80; z >>= 7)
+				{
+					dst[k++] = std::uint8_t(z | 0x80);
+				}
+
+				dst[k++] = std::uint8_t(z);
+			}
+		}
+
+		return k;
+	}
+
+	/**
+	 * @param size bytes available at src
+	 *
+	 * @return Number of bytes read, 0 when src is truncated or malformed
+	 */
+	template <class T>
+	inline std::size_t deserialize_delta(T *dst, std::uint8_t const *src, std::size_t size, std::size_t n,
+					     typename TSerialShape<T>::type step) noexcept
+	{
+		using S = typename TSerialShape<T>::type;
+
+		constexpr auto C = TSerialShape<T>::count;
+
+		std::int64_t prev[C] = {};
+		std::size_t k = 0;
+
+		for (std::size_t i = 0; i < n * C; i++)
+		{
+			std::uint64_t z = 0;
+
+			for (unsigned shift = 0;; shift += 7)
+			{
+				if (k == size || shift > 63)
+				{
+					return 0;
+				}
+
+				auto const b = src[k++];
+
+				z |= std::uint64_t(b & 0x7f) << shift;
+
+				if (!(b & 0x80))
+				{
+					break;
+				}
+			}
+
+			prev[i % C] += std::int64_t(z >> 1) ^ -std::int64_t(z & 1);
+			serial_scalar(dst[i / C], i % C) = S(prev[i % C] * step);
+		}
+
+		return k;
+	}
+}
+
+#endif
\ No newline at end of file
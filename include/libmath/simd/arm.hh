@@ -1,158 +1,3542 @@
 #ifndef MICRO_LIBMATH_SIMD_ARM_INL__GUARD
 #define MICRO_LIBMATH_SIMD_ARM_INL__GUARD
 
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
 #include <arm_neon.h>
 
+#include <libmath/vector2.hh>
+#include <libmath/vector3.hh>
+#include <libmath/vector4.hh>
 #include <libmath/matrix2x2.hh>
 #include <libmath/matrix3x3.hh>
+#include <libmath/matrix3x4.hh>
 #include <libmath/matrix4x4.hh>
 
 #ifndef _MSC_VER
 #	define __vectorcall
 #endif
 
+namespace micro::math::simd
+{
+	inline TVector2<float> __vectorcall operator+(TVector2<float> const &a,
+						      TVector2<float> const &b) noexcept
+	{
+		TVector2<float> r;
+
+		auto const A = vld1_f32(a.data);
+		auto const B = vld1_f32(b.data);
+
+		vst1_f32(r.data, vadd_f32(A, B));
+
+		return r;
+	}
+
+	inline TVector2<float> __vectorcall operator-(TVector2<float> const &a,
+						      TVector2<float> const &b) noexcept
+	{
+		TVector2<float> r;
+
+		auto const A = vld1_f32(a.data);
+		auto const B = vld1_f32(b.data);
+
+		vst1_f32(r.data, vsub_f32(A, B));
+
+		return r;
+	}
+
+	inline TVector2<float> __vectorcall operator*(TVector2<float> const &a,
+						      TVector2<float> const &b) noexcept
+	{
+		TVector2<float> r;
+
+		auto const A = vld1_f32(a.data);
+		auto const B = vld1_f32(b.data);
+
+		vst1_f32(r.data, vmul_f32(A, B));
+
+		return r;
+	}
+
+	inline TVector2<float> __vectorcall operator/(TVector2<float> const &a,
+						      TVector2<float> const &b) noexcept
+	{
+		TVector2<float> r;
+
+		auto const A = vld1_f32(a.data);
+		auto const B = vld1_f32(b.data);
+
+		vst1_f32(r.data, vdiv_f32(A, B));
+
+		return r;
+	}
+
+	inline float __vectorcall dot(TVector2<float> const &a,
+				      TVector2<float> const &b) noexcept
+	{
+		return vaddv_f32(vmul_f32(vld1_f32(a.data), vld1_f32(b.data)));
+	}
+
+	inline float __vectorcall len(TVector2<float> const &a) noexcept
+	{
+		return std::sqrt(dot(a, a));
+	}
+
+	inline TVector2<float> __vectorcall normalize(TVector2<float> const &a) noexcept
+	{
+		TVector2<float> r;
+
+		auto const A = vld1_f32(a.data);
+
+		vst1_f32(r.data, vdiv_f32(A, vdup_n_f32(std::sqrt(vaddv_f32(vmul_f32(A, A))))));
+
+		return r;
+	}
+
+	inline TVector2<float> __vectorcall lerp(TVector2<float> const &a,
+						 TVector2<float> const &b, float f) noexcept
+	{
+		TVector2<float> r;
+
+		auto const A = vld1_f32(a.data);
+		auto const B = vld1_f32(b.data);
+
+		vst1_f32(r.data, vadd_f32(A, vmul_n_f32(vsub_f32(B, A), f)));
+
+		return r;
+	}
+
+	// ----------------------------------------------------------------- //
+
+	inline TVector2<double> __vectorcall operator+(TVector2<double> const &a,
+						       TVector2<double> const &b) noexcept
+	{
+		TVector2<double> r;
+
+		auto const A = vld1q_f64(a.data);
+		auto const B = vld1q_f64(b.data);
+
+		vst1q_f64(r.data, vaddq_f64(A, B));
+
+		return r;
+	}
+
+	inline TVector2<double> __vectorcall operator-(TVector2<double> const &a,
+						       TVector2<double> const &b) noexcept
+	{
+		TVector2<double> r;
+
+		auto const A = vld1q_f64(a.data);
+		auto const B = vld1q_f64(b.data);
+
+		vst1q_f64(r.data, vsubq_f64(A, B));
+
+		return r;
+	}
+
+	inline TVector2<double> __vectorcall operator*(TVector2<double> const &a,
+						       TVector2<double> const &b) noexcept
+	{
+		TVector2<double> r;
+
+		auto const A = vld1q_f64(a.data);
+		auto const B = vld1q_f64(b.data);
+
+		vst1q_f64(r.data, vmulq_f64(A, B));
+
+		return r;
+	}
+
+	inline TVector2<double> __vectorcall operator/(TVector2<double> const &a,
+						       TVector2<double> const &b) noexcept
+	{
+		TVector2<double> r;
+
+		auto const A = vld1q_f64(a.data);
+		auto const B = vld1q_f64(b.data);
+
+		vst1q_f64(r.data, vdivq_f64(A, B));
+
+		return r;
+	}
+
+	inline double __vectorcall dot(TVector2<double> const &a,
+				       TVector2<double> const &b) noexcept
+	{
+		return vaddvq_f64(vmulq_f64(vld1q_f64(a.data), vld1q_f64(b.data)));
+	}
+
+	inline double __vectorcall len(TVector2<double> const &a) noexcept
+	{
+		return std::sqrt(dot(a, a));
+	}
+
+	inline TVector2<double> __vectorcall normalize(TVector2<double> const &a) noexcept
+	{
+		TVector2<double> r;
+
+		auto const A = vld1q_f64(a.data);
+
+		vst1q_f64(r.data, vdivq_f64(A, vdupq_n_f64(std::sqrt(vaddvq_f64(vmulq_f64(A, A))))));
+
+		return r;
+	}
+
+	inline TVector2<double> __vectorcall lerp(TVector2<double> const &a,
+						  TVector2<double> const &b, double f) noexcept
+	{
+		TVector2<double> r;
+
+		auto const A = vld1q_f64(a.data);
+		auto const B = vld1q_f64(b.data);
+
+		vst1q_f64(r.data, vaddq_f64(A, vmulq_n_f64(vsubq_f64(B, A), f)));
+
+		return r;
+	}
+
+	// ----------------------------------------------------------------- //
+
+	/**
+	 * @brief Loads a TVector3<float> as xyz0 without reading past its end
+	 */
+	inline float32x4_t __vectorcall _load3_ps(TVector3<float> const &v) noexcept
+	{
+		return vcombine_f32(vld1_f32(v.data), vld1_lane_f32(v.data + 2, vdup_n_f32(0), 0));
+	}
+
+	/**
+	 * @brief Stores the xyz lanes of r into a TVector3<float>
+	 */
+	inline void __vectorcall _store3_ps(TVector3<float> &v, float32x4_t const r) noexcept
+	{
+		vst1_f32(v.data, vget_low_f32(r));
+		vst1q_lane_f32(v.data + 2, r, 2);
+	}
+
+	/**
+	 * @brief Rotates the xyz lanes to yzx, w is left undefined
+	 */
+	inline float32x4_t __vectorcall _yzx_ps(float32x4_t const v) noexcept
+	{
+		return vcopyq_laneq_f32(vextq_f32(v, v, 1), 2, v, 0);
+	}
+
+	inline TVector3<float> __vectorcall operator+(TVector3<float> const &a,
+						      TVector3<float> const &b) noexcept
+	{
+		TVector3<float> r;
+
+		auto const A = _load3_ps(a);
+		auto const B = _load3_ps(b);
+
+		_store3_ps(r, vaddq_f32(A, B));
+
+		return r;
+	}
+
+	inline TVector3<float> __vectorcall operator-(TVector3<float> const &a,
+						      TVector3<float> const &b) noexcept
+	{
+		TVector3<float> r;
+
+		auto const A = _load3_ps(a);
+		auto const B = _load3_ps(b);
+
+		_store3_ps(r, vsubq_f32(A, B));
+
+		return r;
+	}
+
+	inline TVector3<float> __vectorcall operator*(TVector3<float> const &a,
+						      TVector3<float> const &b) noexcept
+	{
+		TVector3<float> r;
+
+		auto const A = _load3_ps(a);
+		auto const B = _load3_ps(b);
+
+		_store3_ps(r, vmulq_f32(A, B));
+
+		return r;
+	}
+
+	inline TVector3<float> __vectorcall operator/(TVector3<float> const &a,
+						      TVector3<float> const &b) noexcept
+	{
+		TVector3<float> r;
+
+		auto const A = _load3_ps(a);
+		auto const B = vsetq_lane_f32(1.f, _load3_ps(b), 3); // keep the unused lane finite
+
+		_store3_ps(r, vdivq_f32(A, B));
+
+		return r;
+	}
+
+	inline TVector3<float> __vectorcall operator^(TVector3<float> const &a,
+						      TVector3<float> const &b) noexcept
+	{
+		TVector3<float> r;
+
+		auto const A = _load3_ps(a);
+		auto const B = _load3_ps(b);
+		auto const C = vsubq_f32(vmulq_f32(A, _yzx_ps(B)), vmulq_f32(_yzx_ps(A), B)); // (a ^ b).zxy
+
+		_store3_ps(r, _yzx_ps(C));
+
+		return r;
+	}
+
+	inline float __vectorcall dot(TVector3<float> const &a,
+				      TVector3<float> const &b) noexcept
+	{
+		return vaddvq_f32(vmulq_f32(_load3_ps(a), _load3_ps(b)));
+	}
+
+	inline float __vectorcall len(TVector3<float> const &a) noexcept
+	{
+		return std::sqrt(dot(a, a));
+	}
+
+	inline TVector3<float> __vectorcall normalize(TVector3<float> const &a) noexcept
+	{
+		TVector3<float> r;
+
+		auto const A = _load3_ps(a);
+
+		_store3_ps(r, vdivq_f32(A, vdupq_n_f32(std::sqrt(vaddvq_f32(vmulq_f32(A, A))))));
+
+		return r;
+	}
+
+	inline TVector3<float> __vectorcall lerp(TVector3<float> const &a,
+						 TVector3<float> const &b, float f) noexcept
+	{
+		TVector3<float> r;
+
+		auto const A = _load3_ps(a);
+		auto const B = _load3_ps(b);
+
+		_store3_ps(r, vaddq_f32(A, vmulq_n_f32(vsubq_f32(B, A), f)));
+
+		return r;
+	}
+
+	// ----------------------------------------------------------------- //
+
+	inline TVector3<double> __vectorcall operator+(TVector3<double> const &a,
+						       TVector3<double> const &b) noexcept
+	{
+		TVector3<double> r;
+
+		auto const A = vld1q_f64(a.data);
+		auto const B = vld1q_f64(b.data);
+
+		vst1q_f64(r.data, vaddq_f64(A, B));
+
+		r.data[2] = a.data[2] + b.data[2];
+
+		return r;
+	}
+
+	inline TVector3<double> __vectorcall operator-(TVector3<double> const &a,
+						       TVector3<double> const &b) noexcept
+	{
+		TVector3<double> r;
+
+		auto const A = vld1q_f64(a.data);
+		auto const B = vld1q_f64(b.data);
+
+		vst1q_f64(r.data, vsubq_f64(A, B));
+
+		r.data[2] = a.data[2] - b.data[2];
+
+		return r;
+	}
+
+	inline TVector3<double> __vectorcall operator*(TVector3<double> const &a,
+						       TVector3<double> const &b) noexcept
+	{
+		TVector3<double> r;
+
+		auto const A = vld1q_f64(a.data);
+		auto const B = vld1q_f64(b.data);
+
+		vst1q_f64(r.data, vmulq_f64(A, B));
+
+		r.data[2] = a.data[2] * b.data[2];
+
+		return r;
+	}
+
+	inline TVector3<double> __vectorcall operator/(TVector3<double> const &a,
+						       TVector3<double> const &b) noexcept
+	{
+		TVector3<double> r;
+
+		auto const A = vld1q_f64(a.data);
+		auto const B = vld1q_f64(b.data);
+
+		vst1q_f64(r.data, vdivq_f64(A, B));
+
+		r.data[2] = a.data[2] / b.data[2];
+
+		return r;
+	}
+
+	inline TVector3<double> __vectorcall operator^(TVector3<double> const &a,
+						       TVector3<double> const &b) noexcept
+	{
+		TVector3<double> r;
+
+		auto const A = vld1q_f64(a.data + 1);					 // a.y a.z
+		auto const B = vcombine_f64(vld1_f64(b.data + 2), vld1_f64(b.data + 0)); // b.z b.x
+		auto const C = vcombine_f64(vld1_f64(a.data + 2), vld1_f64(a.data + 0)); // a.z a.x
+		auto const D = vld1q_f64(b.data + 1);					 // b.y b.z
+
+		vst1q_f64(r.data, vsubq_f64(vmulq_f64(A, B), vmulq_f64(C, D)));
+
+		r.data[2] = a.data[0] * b.data[1] - a.data[1] * b.data[0];
+
+		return r;
+	}
+
+	inline double __vectorcall dot(TVector3<double> const &a,
+				       TVector3<double> const &b) noexcept
+	{
+		return vaddvq_f64(vmulq_f64(vld1q_f64(a.data), vld1q_f64(b.data))) + a.data[2] * b.data[2];
+	}
+
+	inline double __vectorcall len(TVector3<double> const &a) noexcept
+	{
+		return std::sqrt(dot(a, a));
+	}
+
+	inline TVector3<double> __vectorcall normalize(TVector3<double> const &a) noexcept
+	{
+		TVector3<double> r;
+
+		auto const l = len(a);
+
+		vst1q_f64(r.data, vdivq_f64(vld1q_f64(a.data), vdupq_n_f64(l)));
+
+		r.data[2] = a.data[2] / l;
+
+		return r;
+	}
+
+	inline TVector3<double> __vectorcall lerp(TVector3<double> const &a,
+						  TVector3<double> const &b, double f) noexcept
+	{
+		TVector3<double> r;
+
+		auto const A = vld1q_f64(a.data);
+		auto const B = vld1q_f64(b.data);
+
+		vst1q_f64(r.data, vaddq_f64(A, vmulq_n_f64(vsubq_f64(B, A), f)));
+
+		r.data[2] = a.data[2] + f * (b.data[2] - a.data[2]);
+
+		return r;
+	}
+
+	// ----------------------------------------------------------------- //
+
+	inline TVector4<float> __vectorcall operator+(TVector4<float> const &a,
+						      TVector4<float> const &b) noexcept
+	{
+		TVector4<float> r;
+
+		auto const A = vld1q_f32(a.data);
+		auto const B = vld1q_f32(b.data);
+
+		vst1q_f32(r.data, vaddq_f32(A, B));
+
+		return r;
+	}
+
+	inline TVector4<float> __vectorcall operator-(TVector4<float> const &a,
+						      TVector4<float> const &b) noexcept
+	{
+		TVector4<float> r;
+
+		auto const A = vld1q_f32(a.data);
+		auto const B = vld1q_f32(b.data);
+
+		vst1q_f32(r.data, vsubq_f32(A, B));
+
+		return r;
+	}
+
+	inline TVector4<float> __vectorcall operator*(TVector4<float> const &a,
+						      TVector4<float> const &b) noexcept
+	{
+		TVector4<float> r;
+
+		auto const A = vld1q_f32(a.data);
+		auto const B = vld1q_f32(b.data);
+
+		vst1q_f32(r.data, vmulq_f32(A, B));
+
+		return r;
+	}
+
+	inline TVector4<float> __vectorcall operator/(TVector4<float> const &a,
+						      TVector4<float> const &b) noexcept
+	{
+		TVector4<float> r;
+
+		auto const A = vld1q_f32(a.data);
+		auto const B = vld1q_f32(b.data);
+
+		vst1q_f32(r.data, vdivq_f32(A, B));
+
+		return r;
+	}
+
+	inline float __vectorcall dot(TVector4<float> const &a,
+				      TVector4<float> const &b) noexcept
+	{
+		return vaddvq_f32(vmulq_f32(vld1q_f32(a.data), vld1q_f32(b.data)));
+	}
+
+	inline float __vectorcall len(TVector4<float> const &a) noexcept
+	{
+		return std::sqrt(dot(a, a));
+	}
+
+	inline TVector4<float> __vectorcall normalize(TVector4<float> const &a) noexcept
+	{
+		TVector4<float> r;
+
+		auto const A = vld1q_f32(a.data);
+
+		vst1q_f32(r.data, vdivq_f32(A, vdupq_n_f32(std::sqrt(vaddvq_f32(vmulq_f32(A, A))))));
+
+		return r;
+	}
+
+	inline TVector4<float> __vectorcall lerp(TVector4<float> const &a,
+						 TVector4<float> const &b, float f) noexcept
+	{
+		TVector4<float> r;
+
+		auto const A = vld1q_f32(a.data);
+		auto const B = vld1q_f32(b.data);
+
+		vst1q_f32(r.data, vaddq_f32(A, vmulq_n_f32(vsubq_f32(B, A), f)));
+
+		return r;
+	}
+
+	// ----------------------------------------------------------------- //
+
+	inline TVector4<double> __vectorcall operator+(TVector4<double> const &a,
+						       TVector4<double> const &b) noexcept
+	{
+		TVector4<double> r;
+
+		auto const A = vld1q_f64(a.data + 0);
+		auto const B = vld1q_f64(b.data + 0);
+		auto const C = vld1q_f64(a.data + 2);
+		auto const D = vld1q_f64(b.data + 2);
+
+		vst1q_f64(r.data + 0, vaddq_f64(A, B));
+		vst1q_f64(r.data + 2, vaddq_f64(C, D));
+
+		return r;
+	}
+
+	inline TVector4<double> __vectorcall operator-(TVector4<double> const &a,
+						       TVector4<double> const &b) noexcept
+	{
+		TVector4<double> r;
+
+		auto const A = vld1q_f64(a.data + 0);
+		auto const B = vld1q_f64(b.data + 0);
+		auto const C = vld1q_f64(a.data + 2);
+		auto const D = vld1q_f64(b.data + 2);
+
+		vst1q_f64(r.data + 0, vsubq_f64(A, B));
+		vst1q_f64(r.data + 2, vsubq_f64(C, D));
+
+		return r;
+	}
+
+	inline TVector4<double> __vectorcall operator*(TVector4<double> const &a,
+						       TVector4<double> const &b) noexcept
+	{
+		TVector4<double> r;
+
+		auto const A = vld1q_f64(a.data + 0);
+		auto const B = vld1q_f64(b.data + 0);
+		auto const C = vld1q_f64(a.data + 2);
+		auto const D = vld1q_f64(b.data + 2);
+
+		vst1q_f64(r.data + 0, vmulq_f64(A, B));
+		vst1q_f64(r.data + 2, vmulq_f64(C, D));
+
+		return r;
+	}
+
+	inline TVector4<double> __vectorcall operator/(TVector4<double> const &a,
+						       TVector4<double> const &b) noexcept
+	{
+		TVector4<double> r;
+
+		auto const A = vld1q_f64(a.data + 0);
+		auto const B = vld1q_f64(b.data + 0);
+		auto const C = vld1q_f64(a.data + 2);
+		auto const D = vld1q_f64(b.data + 2);
+
+		vst1q_f64(r.data + 0, vdivq_f64(A, B));
+		vst1q_f64(r.data + 2, vdivq_f64(C, D));
+
+		return r;
+	}
+
+	inline double __vectorcall dot(TVector4<double> const &a,
+				       TVector4<double> const &b) noexcept
+	{
+		auto const A = vmulq_f64(vld1q_f64(a.data + 0), vld1q_f64(b.data + 0));
+		auto const B = vmulq_f64(vld1q_f64(a.data + 2), vld1q_f64(b.data + 2));
+
+		return vaddvq_f64(vaddq_f64(A, B));
+	}
+
+	inline double __vectorcall len(TVector4<double> const &a) noexcept
+	{
+		return std::sqrt(dot(a, a));
+	}
+
+	inline TVector4<double> __vectorcall normalize(TVector4<double> const &a) noexcept
+	{
+		TVector4<double> r;
+
+		auto const L = vdupq_n_f64(len(a));
+
+		vst1q_f64(r.data + 0, vdivq_f64(vld1q_f64(a.data + 0), L));
+		vst1q_f64(r.data + 2, vdivq_f64(vld1q_f64(a.data + 2), L));
+
+		return r;
+	}
+
+	inline TVector4<double> __vectorcall lerp(TVector4<double> const &a,
+						  TVector4<double> const &b, double f) noexcept
+	{
+		TVector4<double> r;
+
+		auto const A = vld1q_f64(a.data + 0);
+		auto const B = vld1q_f64(b.data + 0);
+		auto const C = vld1q_f64(a.data + 2);
+		auto const D = vld1q_f64(b.data + 2);
+
+		vst1q_f64(r.data + 0, vaddq_f64(A, vmulq_n_f64(vsubq_f64(B, A), f)));
+		vst1q_f64(r.data + 2, vaddq_f64(C, vmulq_n_f64(vsubq_f64(D, C), f)));
+
+		return r;
+	}
+
+	// ----------------------------------------------------------------- //
+
+	/**
+	 * @brief Multiply a row from A matrix with all rows of B matrix
+	 *
+	 * @param r A matrix row
+	 * @param a B matrix 1st-row
+	 * @param b B matrix 2nd-row
+	 * @param c B matrix 3rd-row
+	 *
+	 * @return r.x * a + r.y * b + r.z * c
+	 */
+	inline float32x4_t __vectorcall _m3x3_mul_ps(float32x4_t const r,
+						     float32x4_t const a,
+						     float32x4_t const b,
+						     float32x4_t const c) noexcept
+	{
+		const auto A = vmulq_laneq_f32(a, r, 0);
+		const auto B = vmulq_laneq_f32(b, r, 1);
+		const auto C = vmulq_laneq_f32(c, r, 2);
+		const auto E = vaddq_f32(A, C);
+		const auto F = vaddq_f32(E, B);
+
+		return F;
+	}
+
+	inline TMatrix3x3<float> operator*(TMatrix3x3<float> const &a,
+					   TMatrix3x3<float> const &b) noexcept
+	{
+		auto const nil = vdup_n_f32(0);
+
+		alignas(alignof(float32x4_t)) float _0[4];
+		alignas(alignof(float32x4_t)) float _1[4];
+		alignas(alignof(float32x4_t)) float _2[4];
+
+		auto const A0 = vcombine_f32(vld1_f32(a.data[0].data), vld1_lane_f32(a.data[0].data + 2, nil, 0));
+		auto const A1 = vcombine_f32(vld1_f32(a.data[1].data), vld1_lane_f32(a.data[1].data + 2, nil, 0));
+		auto const A2 = vcombine_f32(vld1_f32(a.data[2].data), vld1_lane_f32(a.data[2].data + 2, nil, 0));
+		auto const B0 = vcombine_f32(vld1_f32(b.data[0].data), vld1_lane_f32(b.data[0].data + 2, nil, 0));
+		auto const B1 = vcombine_f32(vld1_f32(b.data[1].data), vld1_lane_f32(b.data[1].data + 2, nil, 0));
+		auto const B2 = vcombine_f32(vld1_f32(b.data[2].data), vld1_lane_f32(b.data[2].data + 2, nil, 0));
+
+		vst1q_f32(_0, _m3x3_mul_ps(A0, B0, B1, B2));
+		vst1q_f32(_1, _m3x3_mul_ps(A1, B0, B1, B2));
+		vst1q_f32(_2, _m3x3_mul_ps(A2, B0, B1, B2));
+
+		return TMatrix3x3<float>{_0[0], _0[1], _0[2],
+					 _1[0], _1[1], _1[2],
+					 _2[0], _2[1], _2[2]};
+	}
+
+	/**
+	 * @brief Cross product of the xyz lanes, w is left undefined
+	 */
+	inline float32x4_t __vectorcall _cross_ps(float32x4_t const a,
+						  float32x4_t const b) noexcept
+	{
+		auto const C = vsubq_f32(vmulq_f32(a, _yzx_ps(b)), vmulq_f32(_yzx_ps(a), b)); // zxy of a ^ b
+
+		return _yzx_ps(C);
+	}
+
+	/**
+	 * @brief Dot product of the xyz lanes
+	 */
+	inline float __vectorcall _dot3_ps(float32x4_t const a,
+					   float32x4_t const b) noexcept
+	{
+		return vaddvq_f32(vsetq_lane_f32(0.f, vmulq_f32(a, b), 3));
+	}
+
+	/**
+	 * @brief Rows of the cofactor matrix of the 3x3 block with rows a, b, c
+	 *
+	 * The adjoint is the transpose of {b ^ c, c ^ a, a ^ b}, the determinant
+	 * is a . (b ^ c), so both come out of the same three cross products.
+	 */
+	inline float32x4x3_t __vectorcall _m3x3_cof_ps(float32x4_t const a,
+						       float32x4_t const b,
+						       float32x4_t const c) noexcept
+	{
+		return float32x4x3_t{{_cross_ps(b, c),
+				      _cross_ps(c, a),
+				      _cross_ps(a, b)}};
+	}
+
+	inline float __vectorcall det(TMatrix3x3<float> const &m) noexcept
+	{
+		auto const A = _load3_ps(m.data[0]);
+		auto const B = _load3_ps(m.data[1]);
+		auto const C = _load3_ps(m.data[2]);
+
+		return _dot3_ps(A, _cross_ps(B, C));
+	}
+
+	inline TMatrix3x3<float> __vectorcall adjoint(TMatrix3x3<float> const &m) noexcept
+	{
+		TMatrix3x3<float> r;
+
+		auto const C = _m3x3_cof_ps(_load3_ps(m.data[0]), _load3_ps(m.data[1]), _load3_ps(m.data[2]));
+
+		vst3q_lane_f32(r.data[0].data, C, 0);
+		vst3q_lane_f32(r.data[1].data, C, 1);
+		vst3q_lane_f32(r.data[2].data, C, 2);
+
+		return r;
+	}
+
+	inline TMatrix3x3<float> __vectorcall inverse(TMatrix3x3<float> const &m) noexcept
+	{
+		TMatrix3x3<float> r;
+
+		auto const A = _load3_ps(m.data[0]);
+		auto const C = _m3x3_cof_ps(A, _load3_ps(m.data[1]), _load3_ps(m.data[2]));
+		auto const D = vdupq_n_f32(_dot3_ps(A, C.val[0]));
+
+		float32x4x3_t const I = {{vdivq_f32(C.val[0], D),
+					  vdivq_f32(C.val[1], D),
+					  vdivq_f32(C.val[2], D)}};
+
+		vst3q_lane_f32(r.data[0].data, I, 0);
+		vst3q_lane_f32(r.data[1].data, I, 1);
+		vst3q_lane_f32(r.data[2].data, I, 2);
+
+		return r;
+	}
+
+	inline TMatrix3x3<float> __vectorcall normal_matrix(TMatrix4x4<float> const &m) noexcept
+	{
+		TMatrix3x3<float> r;
+
+		auto const A = vld1q_f32(m.data[0].data);
+		auto const C = _m3x3_cof_ps(A, vld1q_f32(m.data[1].data), vld1q_f32(m.data[2].data));
+		auto const D = vdupq_n_f32(_dot3_ps(A, C.val[0]));
+
+		_store3_ps(r.data[0], vdivq_f32(C.val[0], D));
+		_store3_ps(r.data[1], vdivq_f32(C.val[1], D));
+		_store3_ps(r.data[2], vdivq_f32(C.val[2], D));
+
+		return r;
+	}
+
+	/**
+	 * @brief Multiply a row from A matrix with all rows of B matrix
+	 *
+	 * @param r A matrix row
+	 * @param a B matrix 1st-row
+	 * @param b B matrix 2nd-row
+	 * @param c B matrix 3rd-row
+	 * @param d B matrix 4th-row
+	 *
+	 * @return r.x * a + r.y * b + r.z * c + r.w * d
+	 */
+	inline float32x4_t __vectorcall _m4x4_mul_ps(float32x4_t const r,
+						     float32x4_t const a,
+						     float32x4_t const b,
+						     float32x4_t const c,
+						     float32x4_t const d) noexcept
+	{
+		const auto A = vmulq_laneq_f32(a, r, 0);
+		const auto B = vmulq_laneq_f32(b, r, 1);
+		const auto C = vmulq_laneq_f32(c, r, 2);
+		const auto D = vmulq_laneq_f32(d, r, 3);
+		const auto E = vaddq_f32(A, C);
+		const auto F = vaddq_f32(B, D);
+		const auto G = vaddq_f32(E, F);
+
+		return G;
+	}
+
+	inline TMatrix4x4<float> operator*(TMatrix4x4<float> const &a,
+					   TMatrix4x4<float> const &b) noexcept
+	{
+		TVector4<float> _0;
+		TVector4<float> _1;
+		TVector4<float> _2;
+		TVector4<float> _3;
+
+		auto const A0 = vld1q_f32(a.data[0].data);
+		auto const A1 = vld1q_f32(a.data[1].data);
+		auto const A2 = vld1q_f32(a.data[2].data);
+		auto const A3 = vld1q_f32(a.data[3].data);
+		auto const B0 = vld1q_f32(b.data[0].data);
+		auto const B1 = vld1q_f32(b.data[1].data);
+		auto const B2 = vld1q_f32(b.data[2].data);
+		auto const B3 = vld1q_f32(b.data[3].data);
+
+		vst1q_f32(_0.data, _m4x4_mul_ps(A0, B0, B1, B2, B3));
+		vst1q_f32(_1.data, _m4x4_mul_ps(A1, B0, B1, B2, B3));
+		vst1q_f32(_2.data, _m4x4_mul_ps(A2, B0, B1, B2, B3));
+		vst1q_f32(_3.data, _m4x4_mul_ps(A3, B0, B1, B2, B3));
+
+		return {_0, _1, _2, _3};
+	}
+
+	inline TMatrix4x4A<float> operator*(TMatrix4x4A<float> const &a,
+					    TMatrix4x4A<float> const &b) noexcept
+	{
+		TMatrix4x4A<float> r;
+
+		auto const A0 = vld1q_f32(a.data[0].data);
+		auto const A1 = vld1q_f32(a.data[1].data);
+		auto const A2 = vld1q_f32(a.data[2].data);
+		auto const A3 = vld1q_f32(a.data[3].data);
+		auto const B0 = vld1q_f32(b.data[0].data);
+		auto const B1 = vld1q_f32(b.data[1].data);
+		auto const B2 = vld1q_f32(b.data[2].data);
+		auto const B3 = vld1q_f32(b.data[3].data);
+
+		vst1q_f32(r.data[0].data, _m4x4_mul_ps(A0, B0, B1, B2, B3));
+		vst1q_f32(r.data[1].data, _m4x4_mul_ps(A1, B0, B1, B2, B3));
+		vst1q_f32(r.data[2].data, _m4x4_mul_ps(A2, B0, B1, B2, B3));
+		vst1q_f32(r.data[3].data, _m4x4_mul_ps(A3, B0, B1, B2, B3));
+
+		return r;
+	}
+
+	inline TMatrix4x4<double> operator*(TMatrix4x4<double> const &a,
+					    TMatrix4x4<double> const &b) noexcept
+	{
+		TMatrix4x4<double> r;
+
+		float64x2_t const B[4][2] = {{vld1q_f64(b.data[0].data + 0), vld1q_f64(b.data[0].data + 2)},
+					     {vld1q_f64(b.data[1].data + 0), vld1q_f64(b.data[1].data + 2)},
+					     {vld1q_f64(b.data[2].data + 0), vld1q_f64(b.data[2].data + 2)},
+					     {vld1q_f64(b.data[3].data + 0), vld1q_f64(b.data[3].data + 2)}};
+
+		for (auto i = 0; i < 4; i++)
+		{
+			auto const L = vld1q_f64(a.data[i].data + 0); // a[i][0] a[i][1]
+			auto const H = vld1q_f64(a.data[i].data + 2); // a[i][2] a[i][3]
+
+			auto const X = vaddq_f64(vmulq_laneq_f64(B[0][0], L, 0), vmulq_laneq_f64(B[1][0], L, 1));
+			auto const Y = vaddq_f64(vmulq_laneq_f64(B[2][0], H, 0), vmulq_laneq_f64(B[3][0], H, 1));
+			auto const Z = vaddq_f64(vmulq_laneq_f64(B[0][1], L, 0), vmulq_laneq_f64(B[1][1], L, 1));
+			auto const W = vaddq_f64(vmulq_laneq_f64(B[2][1], H, 0), vmulq_laneq_f64(B[3][1], H, 1));
+
+			vst1q_f64(r.data[i].data + 0, vaddq_f64(X, Y));
+			vst1q_f64(r.data[i].data + 2, vaddq_f64(Z, W));
+		}
+
+		return r;
+	}
+
+	// ----------------------------------------------------------------- //
+
+	inline TMatrix4x4<float> __vectorcall transpose(TMatrix4x4<float> const &m) noexcept
+	{
+		TVector4<float> _0;
+		TVector4<float> _1;
+		TVector4<float> _2;
+		TVector4<float> _3;
+
+		float32x4x4_t const l_matrix = {vld1q_f32(m.data[0].data),
+						vld1q_f32(m.data[1].data),
+						vld1q_f32(m.data[2].data),
+						vld1q_f32(m.data[3].data)};
+
+		vst4q_lane_f32(_0.data, l_matrix, 0);
+		vst4q_lane_f32(_1.data, l_matrix, 1);
+		vst4q_lane_f32(_2.data, l_matrix, 2);
+		vst4q_lane_f32(_3.data, l_matrix, 3);
+
+		return {_0, _1, _2, _3};
+	}
+
+	// ----------------------------------------------------------------- //
+
+	inline void __vectorcall storea(float dst[4][4], TMatrix4x4<float> const &src) noexcept
+	{
+		float32x4x4_t const l_matrix = {vld1q_f32(src.data[0].data),
+						vld1q_f32(src.data[1].data),
+						vld1q_f32(src.data[2].data),
+						vld1q_f32(src.data[3].data)};
+
+		vst1q_f32_x4(dst[0], l_matrix);
+	}
+
+	// ---------------------------- Aliases ---------------------------- //
+
+	constexpr auto storeu = storea;
+	constexpr auto stream = storea;
+
+	// ----------------------------------------------------------------- //
+
+	/**
+	 * @brief Prefetches a line for a single read, NEON has no non-temporal
+	 *        store intrinsic so the batch writers rely on this alone to keep
+	 *        the source out of the outer cache levels
+	 */
+	inline void _prefetch_once(void const *p) noexcept
+	{
+#ifdef _MSC_VER
+		__prefetch(p);
+#else
+		__builtin_prefetch(p, 0, 0);
+#endif
+	}
+
+	inline void stream_batch(float (*dst)[4], TVector4<float> const *src, std::size_t n) noexcept
+	{
+		constexpr std::size_t ahead = 16;
+
+		for (std::size_t i = 0; i < n; i++)
+		{
+			if (i + ahead < n)
+			{
+				_prefetch_once(src + i + ahead);
+			}
+
+			vst1q_f32(dst[i], vld1q_f32(src[i].data));
+		}
+	}
+
+	inline void stream_batch(float (*dst)[3][4], TMatrix3x4<float> const *src, std::size_t n) noexcept
+	{
+		constexpr std::size_t ahead = 4;
+
+		for (std::size_t i = 0; i < n; i++)
+		{
+			if (i + ahead < n)
+			{
+				_prefetch_once(reinterpret_cast<char const *>(src + i + ahead) + 0x00);
+				_prefetch_once(reinterpret_cast<char const *>(src + i + ahead) + sizeof(TMatrix3x4<float>) - 1);
+			}
+
+			float32x4x3_t const l_matrix = {vld1q_f32(src[i].data[0].data),
+							vld1q_f32(src[i].data[1].data),
+							vld1q_f32(src[i].data[2].data)};
+
+			vst1q_f32_x3(dst[i][0], l_matrix);
+		}
+	}
+
+	inline void stream_batch(float (*dst)[4][4], TMatrix4x4<float> const *src, std::size_t n) noexcept
+	{
+		constexpr std::size_t ahead = 4;
+
+		for (std::size_t i = 0; i < n; i++)
+		{
+			if (i + ahead < n)
+			{
+				_prefetch_once(reinterpret_cast<char const *>(src + i + ahead) + 0x00);
+				_prefetch_once(reinterpret_cast<char const *>(src + i + ahead) + sizeof(TMatrix4x4<float>) - 1);
+			}
+
+			storea(dst[i], src[i]);
+		}
+	}
+}
+
+// ------------------------------------------------------------------------- //
+
+#include <libmath/half.hh>
+
+namespace micro::math::simd
+{
+	inline void pack_batch(half *dst, float const *src, std::size_t n) noexcept
+	{
+		std::size_t i = 0;
+
+		for (; i + 4 <= n; i += 4)
+		{
+			vst1_u16(&dst[i].bits, vreinterpret_u16_f16(vcvt_f16_f32(vld1q_f32(src + i))));
+		}
+
+		for (; i < n; i++)
+		{
+			dst[i] = pack<half>(src[i]);
+		}
+	}
+
+	inline void unpack_batch(float *dst, half const *src, std::size_t n) noexcept
+	{
+		std::size_t i = 0;
+
+		for (; i + 4 <= n; i += 4)
+		{
+			vst1q_f32(dst + i, vcvt_f32_f16(vreinterpret_f16_u16(vld1_u16(&src[i].bits))));
+		}
+
+		for (; i < n; i++)
+		{
+			dst[i] = unpack(src[i]);
+		}
+	}
+
+	/**
+	 * @brief Rounds 4 floats to bfloat16, ties to even, NaNs stay quiet
+	 */
+	inline uint16x4_t __vectorcall _bf16_pack_ps(float32x4_t const f) noexcept
+	{
+		auto const X = vreinterpretq_u32_f32(f);
+		auto const A = vandq_u32(vshrq_n_u32(X, 16), vdupq_n_u32(1)); // LSB of the kept bits
+		auto const B = vaddq_u32(vaddq_u32(X, vdupq_n_u32(0x7FFF)), A);
+		auto const C = vorrq_u32(X, vdupq_n_u32(0x400000));	      // quiet NaN
+		auto const N = vceqq_f32(f, f);				      // false on NaN
+
+		return vshrn_n_u32(vbslq_u32(N, B, C), 16);
+	}
+
+	inline void pack_batch(bfloat16 *dst, float const *src, std::size_t n) noexcept
+	{
+		std::size_t i = 0;
+
+		for (; i + 4 <= n; i += 4)
+		{
+			vst1_u16(&dst[i].bits, _bf16_pack_ps(vld1q_f32(src + i)));
+		}
+
+		for (; i < n; i++)
+		{
+			dst[i] = pack<bfloat16>(src[i]);
+		}
+	}
+
+	inline void unpack_batch(float *dst, bfloat16 const *src, std::size_t n) noexcept
+	{
+		std::size_t i = 0;
+
+		for (; i + 4 <= n; i += 4)
+		{
+			vst1q_f32(dst + i, vreinterpretq_f32_u32(vshll_n_u16(vld1_u16(&src[i].bits), 16)));
+		}
+
+		for (; i < n; i++)
+		{
+			dst[i] = unpack(src[i]);
+		}
+	}
+
+	inline void transform_batch(TPackedVector4<half> *dst,
+				    TMatrix4x4<float> const &m,
+				    TPackedVector4<half> const *src, std::size_t n) noexcept
+	{
+		auto const C = vld4q_f32(m.data[0].data); // de-interleaving load, C.val[j] is the j-th column
+
+		for (std::size_t i = 0; i < n; i++)
+		{
+			auto const A = vcvt_f32_f16(vreinterpret_f16_u16(vld1_u16(&src[i].data[0].bits)));
+			auto const B = _m4x4_mul_ps(A, C.val[0], C.val[1], C.val[2], C.val[3]);
+
+			vst1_u16(&dst[i].data[0].bits, vreinterpret_u16_f16(vcvt_f16_f32(B)));
+		}
+	}
+
+	inline void transform_batch(TPackedVector4<bfloat16> *dst,
+				    TMatrix4x4<float> const &m,
+				    TPackedVector4<bfloat16> const *src, std::size_t n) noexcept
+	{
+		auto const C = vld4q_f32(m.data[0].data); // de-interleaving load, C.val[j] is the j-th column
+
+		for (std::size_t i = 0; i < n; i++)
+		{
+			auto const A = vreinterpretq_f32_u32(vshll_n_u16(vld1_u16(&src[i].data[0].bits), 16));
+			auto const B = _m4x4_mul_ps(A, C.val[0], C.val[1], C.val[2], C.val[3]);
+
+			vst1_u16(&dst[i].data[0].bits, _bf16_pack_ps(B));
+		}
+	}
+}
+
+// ------------------------------------------------------------------------- //
+
+#include <libmath/quantize.hh>
+
+namespace micro::math::simd
+{
+	inline void encode_batch(PackedNormal *dst, TVector3<float> const *src, std::size_t n) noexcept
+	{
+		auto const nil = vdupq_n_f32(0.f);
+		auto const one = vdupq_n_f32(1.f);
+		auto const neg = vdupq_n_f32(-1.f);
+
+		std::size_t i = 0;
+
+		for (; i + 4 <= n; i += 4)
+		{
+			auto const P = vld3q_f32(src[i].data); // x, y, z of 4 vectors
+
+			auto const S = vaddq_f32(vaddq_f32(vabsq_f32(P.val[0]), vabsq_f32(P.val[1])), vabsq_f32(P.val[2]));
+			auto const G = vcgtq_f32(S, nil); // the zero vector encodes as +Z
+			auto const X = vbslq_f32(G, vdivq_f32(P.val[0], S), nil);
+			auto const Y = vbslq_f32(G, vdivq_f32(P.val[1], S), nil);
+
+			//
+			// fold the lower hemisphere, sign(0) is taken as positive
+			//
+
+			auto const N = vcltq_f32(P.val[2], nil);
+			auto const U = vmulq_f32(vsubq_f32(one, vabsq_f32(Y)), vbslq_f32(vcltq_f32(X, nil), neg, one));
+			auto const V = vmulq_f32(vsubq_f32(one, vabsq_f32(X)), vbslq_f32(vcltq_f32(Y, nil), neg, one));
+
+			int16x4x2_t O;
+
+			O.val[0] = vmovn_s32(vcvtnq_s32_f32(vmulq_n_f32(vbslq_f32(N, U, X), quantize_snorm16)));
+			O.val[1] = vmovn_s32(vcvtnq_s32_f32(vmulq_n_f32(vbslq_f32(N, V, Y), quantize_snorm16)));
+
+			vst2_s16(dst[i].data, O);
+		}
+
+		for (; i < n; i++)
+		{
+			dst[i] = encode_normal(src[i]);
+		}
+	}
+
+	inline void decode_batch(TVector3<float> *dst, PackedNormal const *src, std::size_t n) noexcept
+	{
+		auto const nil = vdupq_n_f32(0.f);
+		auto const one = vdupq_n_f32(1.f);
+		auto const bit = vdupq_n_u32(0x80000000u);
+		auto const max = vdupq_n_f32(quantize_snorm16);
+
+		std::size_t i = 0;
+
+		for (; i + 4 <= n; i += 4)
+		{
+			auto const A = vld2_s16(src[i].data); // x0..x3, y0..y3
+
+			auto const X = vdivq_f32(vcvtq_f32_s32(vmovl_s16(A.val[0])), max);
+			auto const Y = vdivq_f32(vcvtq_f32_s32(vmovl_s16(A.val[1])), max);
+			auto const Z = vsubq_f32(vsubq_f32(one, vabsq_f32(X)), vabsq_f32(Y));
+			auto const T = vmaxq_f32(vnegq_f32(Z), nil);
+			auto const U = vsubq_f32(X, vbslq_f32(bit, X, T)); // x - copysign(t, x)
+			auto const V = vsubq_f32(Y, vbslq_f32(bit, Y, T)); // y - copysign(t, y)
+			auto const L = vmlaq_f32(vmlaq_f32(vmulq_f32(U, U), V, V), Z, Z);
+			auto const R = vsqrtq_f32(L);
+
+			float32x4x3_t O;
+
+			O.val[0] = vdivq_f32(U, R);
+			O.val[1] = vdivq_f32(V, R);
+			O.val[2] = vdivq_f32(Z, R);
+
+			vst3q_f32(dst[i].data, O);
+		}
+
+		for (; i < n; i++)
+		{
+			dst[i] = decode(src[i]);
+		}
+	}
+
+	inline void decode_batch(TVector3<float> *dst, PackedPosition const *src, std::size_t n, TAABB<float> const &b) noexcept
+	{
+		auto const s = extent(b) / quantize_unorm16;
+
+		auto const SX = vdupq_n_f32(s.x());
+		auto const SY = vdupq_n_f32(s.y());
+		auto const SZ = vdupq_n_f32(s.z());
+
+		std::size_t i = 0;
+
+		for (; i + 4 <= n; i += 4)
+		{
+			auto const A = vld3_u16(src[i].data); // x, y, z of 4 positions
+
+			float32x4x3_t O;
+
+			O.val[0] = vmlaq_f32(vdupq_n_f32(b.lower().x()), vcvtq_f32_u32(vmovl_u16(A.val[0])), SX);
+			O.val[1] = vmlaq_f32(vdupq_n_f32(b.lower().y()), vcvtq_f32_u32(vmovl_u16(A.val[1])), SY);
+			O.val[2] = vmlaq_f32(vdupq_n_f32(b.lower().z()), vcvtq_f32_u32(vmovl_u16(A.val[2])), SZ);
+
+			vst3q_f32(dst[i].data, O);
+		}
+
+		for (; i < n; i++)
+		{
+			dst[i] = decode(src[i], b);
+		}
+	}
+}
+
+// ------------------------------------------------------------------------- //
+
+#include <libmath/batch.hh>
+
+namespace micro::math::simd
+{
+	/**
+	 * @brief Multiply a row from A matrix with the same half of all rows of B matrix
+	 *
+	 * @param r A matrix row
+	 *
+	 * @return r[0] * a + r[1] * b + r[2] * c
+	 */
+	inline float64x2_t __vectorcall _m3_mul_pd(double const *r,
+						   float64x2_t const a,
+						   float64x2_t const b,
+						   float64x2_t const c) noexcept
+	{
+		auto const A = vmulq_n_f64(a, r[0]);
+		auto const B = vmulq_n_f64(b, r[1]);
+		auto const C = vmulq_n_f64(c, r[2]);
+
+		return vaddq_f64(vaddq_f64(A, C), B);
+	}
+
+	/**
+	 * @return r[0] * a + r[1] * b + r[2] * c + r[3] * d
+	 */
+	inline float64x2_t __vectorcall _m4_mul_pd(double const *r,
+						   float64x2_t const a,
+						   float64x2_t const b,
+						   float64x2_t const c,
+						   float64x2_t const d) noexcept
+	{
+		auto const A = vmulq_n_f64(a, r[0]);
+		auto const B = vmulq_n_f64(b, r[1]);
+		auto const C = vmulq_n_f64(c, r[2]);
+		auto const D = vmulq_n_f64(d, r[3]);
+
+		return vaddq_f64(vaddq_f64(A, C), vaddq_f64(B, D));
+	}
+
+	//
+	// SoA transposes: m[k] holds element k (row by row) of 4 consecutive
+	// matrices, one per lane. The loads take the distance s between those
+	// matrices, a stride of 0 broadcasts src[0] to every lane.
+	//
+
+	inline void _load2x2_soa_ps(TMatrix2x2<float> const *src, float32x4_t m[4], std::size_t s = 1) noexcept
+	{
+		float32x4x4_t R = {vdupq_n_f32(0), vdupq_n_f32(0), vdupq_n_f32(0), vdupq_n_f32(0)};
+
+		R = vld4q_lane_f32(reinterpret_cast<float const *>(src + 0 * s), R, 0);
+		R = vld4q_lane_f32(reinterpret_cast<float const *>(src + 1 * s), R, 1);
+		R = vld4q_lane_f32(reinterpret_cast<float const *>(src + 2 * s), R, 2);
+		R = vld4q_lane_f32(reinterpret_cast<float const *>(src + 3 * s), R, 3);
+
+		m[0] = R.val[0];
+		m[1] = R.val[1];
+		m[2] = R.val[2];
+		m[3] = R.val[3];
+	}
+
+	inline void _store2x2_soa_ps(TMatrix2x2<float> *dst, float32x4_t const m[4]) noexcept
+	{
+		float32x4x4_t const R = {m[0], m[1], m[2], m[3]};
+
+		vst4q_f32(reinterpret_cast<float *>(dst), R);
+	}
+
+	inline void _load3x3_soa_ps(TMatrix3x3<float> const *src, float32x4_t m[9], std::size_t s = 1) noexcept
+	{
+		for (auto r = 0; r < 3; r++)
+		{
+			float32x4x3_t R = {vdupq_n_f32(0), vdupq_n_f32(0), vdupq_n_f32(0)};
+
+			R = vld3q_lane_f32(src[0 * s].data[r].data, R, 0);
+			R = vld3q_lane_f32(src[1 * s].data[r].data, R, 1);
+			R = vld3q_lane_f32(src[2 * s].data[r].data, R, 2);
+			R = vld3q_lane_f32(src[3 * s].data[r].data, R, 3);
+
+			m[r * 3 + 0] = R.val[0];
+			m[r * 3 + 1] = R.val[1];
+			m[r * 3 + 2] = R.val[2];
+		}
+	}
+
+	inline void _store3x3_soa_ps(TMatrix3x3<float> *dst, float32x4_t const m[9]) noexcept
+	{
+		for (auto r = 0; r < 3; r++)
+		{
+			float32x4x3_t const R = {m[r * 3 + 0], m[r * 3 + 1], m[r * 3 + 2]};
+
+			vst3q_lane_f32(dst[0].data[r].data, R, 0);
+			vst3q_lane_f32(dst[1].data[r].data, R, 1);
+			vst3q_lane_f32(dst[2].data[r].data, R, 2);
+			vst3q_lane_f32(dst[3].data[r].data, R, 3);
+		}
+	}
+
+	inline void _load3x4_soa_ps(TMatrix3x4<float> const *src, float32x4_t m[12], std::size_t s = 1) noexcept
+	{
+		for (auto r = 0; r < 3; r++)
+		{
+			float32x4x4_t R = {vdupq_n_f32(0), vdupq_n_f32(0), vdupq_n_f32(0), vdupq_n_f32(0)};
+
+			R = vld4q_lane_f32(src[0 * s].data[r].data, R, 0);
+			R = vld4q_lane_f32(src[1 * s].data[r].data, R, 1);
+			R = vld4q_lane_f32(src[2 * s].data[r].data, R, 2);
+			R = vld4q_lane_f32(src[3 * s].data[r].data, R, 3);
+
+			m[r * 4 + 0] = R.val[0];
+			m[r * 4 + 1] = R.val[1];
+			m[r * 4 + 2] = R.val[2];
+			m[r * 4 + 3] = R.val[3];
+		}
+	}
+
+	inline void _store3x4_soa_ps(TMatrix3x4<float> *dst, float32x4_t const m[12]) noexcept
+	{
+		for (auto r = 0; r < 3; r++)
+		{
+			float32x4x4_t const R = {m[r * 4 + 0], m[r * 4 + 1], m[r * 4 + 2], m[r * 4 + 3]};
+
+			vst4q_lane_f32(dst[0].data[r].data, R, 0);
+			vst4q_lane_f32(dst[1].data[r].data, R, 1);
+			vst4q_lane_f32(dst[2].data[r].data, R, 2);
+			vst4q_lane_f32(dst[3].data[r].data, R, 3);
+		}
+	}
+
+	inline void _load4x4_soa_ps(TMatrix4x4<float> const *src, float32x4_t m[16], std::size_t s = 1) noexcept
+	{
+		for (auto r = 0; r < 4; r++)
+		{
+			float32x4x4_t R = {vdupq_n_f32(0), vdupq_n_f32(0), vdupq_n_f32(0), vdupq_n_f32(0)};
+
+			R = vld4q_lane_f32(src[0 * s].data[r].data, R, 0);
+			R = vld4q_lane_f32(src[1 * s].data[r].data, R, 1);
+			R = vld4q_lane_f32(src[2 * s].data[r].data, R, 2);
+			R = vld4q_lane_f32(src[3 * s].data[r].data, R, 3);
+
+			m[r * 4 + 0] = R.val[0];
+			m[r * 4 + 1] = R.val[1];
+			m[r * 4 + 2] = R.val[2];
+			m[r * 4 + 3] = R.val[3];
+		}
+	}
+
+	inline void _store4x4_soa_ps(TMatrix4x4<float> *dst, float32x4_t const m[16]) noexcept
+	{
+		for (auto r = 0; r < 4; r++)
+		{
+			float32x4x4_t const R = {m[r * 4 + 0], m[r * 4 + 1], m[r * 4 + 2], m[r * 4 + 3]};
+
+			vst4q_lane_f32(dst[0].data[r].data, R, 0);
+			vst4q_lane_f32(dst[1].data[r].data, R, 1);
+			vst4q_lane_f32(dst[2].data[r].data, R, 2);
+			vst4q_lane_f32(dst[3].data[r].data, R, 3);
+		}
+	}
+
+	/**
+	 * @brief c = a * b lane by lane, a is R x K with rows S registers apart
+	 *        and b is K x C, one register per element
+	 */
+	template <int R, int K, int C, int S = K>
+	inline void _multiply_soa(float32x4_t const *a, float32x4_t const *b, float32x4_t *c) noexcept
+	{
+		for (auto r = 0; r < R; r++)
+		{
+			for (auto j = 0; j < C; j++)
+			{
+				auto x = vmulq_f32(a[r * S], b[j]);
+
+				for (auto k = 1; k < K; k++)
+				{
+					x = vmlaq_f32(x, a[r * S + k], b[k * C + j]);
+				}
+
+				c[r * C + j] = x;
+			}
+		}
+	}
+
+	//
+	// Shared loops of the multiply_batch forms, a stride of 0 repeats the
+	// same matrix for every product. 4 products at a time run transposed
+	// to SoA, the rest one by one. Both operands are fully loaded before
+	// anything is stored, so dst may be the same array as a or b.
+	//
+
+	inline void _multiply_batch(TMatrix2x2<float> *dst,
+				    TMatrix2x2<float> const *a, std::size_t sa,
+				    TMatrix2x2<float> const *b, std::size_t sb, std::size_t n) noexcept
+	{
+		float32x4_t X[4];
+		float32x4_t Y[4];
+		float32x4_t Z[4];
+		std::size_t i = 0;
+
+		if (n >= 4 && !sa)
+		{
+			_load2x2_soa_ps(a, X, 0);
+		}
+
+		if (n >= 4 && !sb)
+		{
+			_load2x2_soa_ps(b, Y, 0);
+		}
+
+		for (; i + 4 <= n; i += 4)
+		{
+			if (sa)
+			{
+				_load2x2_soa_ps(a + i, X);
+			}
+
+			if (sb)
+			{
+				_load2x2_soa_ps(b + i, Y);
+			}
+
+			_multiply_soa<2, 2, 2>(X, Y, Z);
+
+			_store2x2_soa_ps(dst + i, Z);
+		}
+
+		for (; i < n; i++)
+		{
+			auto const A = vld1q_f32(reinterpret_cast<float const *>(a + i * sa)); // abcd
+			auto const B = vld1q_f32(reinterpret_cast<float const *>(b + i * sb)); // efgh
+
+			//
+			// the whole product in one register, aacc * efef + bbdd * ghgh
+			//
+
+			auto const L = vcombine_f32(vget_low_f32(B), vget_low_f32(B));
+			auto const H = vcombine_f32(vget_high_f32(B), vget_high_f32(B));
+			auto const C = vmulq_f32(vtrn1q_f32(A, A), L);
+			auto const D = vmulq_f32(vtrn2q_f32(A, A), H);
+
+			vst1q_f32(reinterpret_cast<float *>(dst + i), vaddq_f32(C, D));
+		}
+	}
+
+	inline void _multiply_batch(TMatrix2x2<double> *dst,
+				    TMatrix2x2<double> const *a, std::size_t sa,
+				    TMatrix2x2<double> const *b, std::size_t sb, std::size_t n) noexcept
+	{
+		for (std::size_t i = 0; i < n; i++)
+		{
+			auto const A0 = vld1q_f64(a[i * sa].data[0].data); // ab
+			auto const A1 = vld1q_f64(a[i * sa].data[1].data); // cd
+			auto const B0 = vld1q_f64(b[i * sb].data[0].data); // ef
+			auto const B1 = vld1q_f64(b[i * sb].data[1].data); // gh
+
+			auto const C0 = vaddq_f64(vmulq_laneq_f64(B0, A0, 0), vmulq_laneq_f64(B1, A0, 1));
+			auto const C1 = vaddq_f64(vmulq_laneq_f64(B0, A1, 0), vmulq_laneq_f64(B1, A1, 1));
+
+			vst1q_f64(dst[i].data[0].data, C0);
+			vst1q_f64(dst[i].data[1].data, C1);
+		}
+	}
+
+	inline void _multiply_batch(TMatrix3x3<float> *dst,
+				    TMatrix3x3<float> const *a, std::size_t sa,
+				    TMatrix3x3<float> const *b, std::size_t sb, std::size_t n) noexcept
+	{
+		float32x4_t X[9];
+		float32x4_t Y[9];
+		float32x4_t Z[9];
+		std::size_t i = 0;
+
+		if (n >= 4 && !sa)
+		{
+			_load3x3_soa_ps(a, X, 0);
+		}
+
+		if (n >= 4 && !sb)
+		{
+			_load3x3_soa_ps(b, Y, 0);
+		}
+
+		for (; i + 4 <= n; i += 4)
+		{
+			if (sa)
+			{
+				_load3x3_soa_ps(a + i, X);
+			}
+
+			if (sb)
+			{
+				_load3x3_soa_ps(b + i, Y);
+			}
+
+			_multiply_soa<3, 3, 3>(X, Y, Z);
+
+			_store3x3_soa_ps(dst + i, Z);
+		}
+
+		for (; i < n; i++)
+		{
+			auto const A0 = _load3_ps(a[i * sa].data[0]);
+			auto const A1 = _load3_ps(a[i * sa].data[1]);
+			auto const A2 = _load3_ps(a[i * sa].data[2]);
+			auto const B0 = _load3_ps(b[i * sb].data[0]);
+			auto const B1 = _load3_ps(b[i * sb].data[1]);
+			auto const B2 = _load3_ps(b[i * sb].data[2]);
+
+			_store3_ps(dst[i].data[0], _m3x3_mul_ps(A0, B0, B1, B2));
+			_store3_ps(dst[i].data[1], _m3x3_mul_ps(A1, B0, B1, B2));
+			_store3_ps(dst[i].data[2], _m3x3_mul_ps(A2, B0, B1, B2));
+		}
+	}
+
+	inline void _multiply_batch(TMatrix3x3<double> *dst,
+				    TMatrix3x3<double> const *a, std::size_t sa,
+				    TMatrix3x3<double> const *b, std::size_t sb, std::size_t n) noexcept
+	{
+		for (std::size_t i = 0; i < n; i++)
+		{
+			auto const l = a[i * sa];
+
+			auto const B0 = vld1q_f64(b[i * sb].data[0].data); // xy
+			auto const B1 = vld1q_f64(b[i * sb].data[1].data); // xy
+			auto const B2 = vld1q_f64(b[i * sb].data[2].data); // xy
+			auto const D0 = vld1_f64(b[i * sb].data[0].data + 2); // z
+			auto const D1 = vld1_f64(b[i * sb].data[1].data + 2); // z
+			auto const D2 = vld1_f64(b[i * sb].data[2].data + 2); // z
+
+			for (auto j = 0; j < 3; j++)
+			{
+				auto const r = l.data[j].data;
+				auto const Z = vadd_f64(vadd_f64(vmul_n_f64(D0, r[0]), vmul_n_f64(D2, r[2])), vmul_n_f64(D1, r[1]));
+
+				vst1q_f64(dst[i].data[j].data, _m3_mul_pd(r, B0, B1, B2));
+				vst1_f64(dst[i].data[j].data + 2, Z);
+			}
+		}
+	}
+
+	inline void _multiply_batch(TMatrix3x4<float> *dst,
+				    TMatrix3x4<float> const *a, std::size_t sa,
+				    TMatrix3x4<float> const *b, std::size_t sb, std::size_t n) noexcept
+	{
+		float32x4_t X[12];
+		float32x4_t Y[12];
+		float32x4_t Z[12];
+		std::size_t i = 0;
+
+		if (n >= 4 && !sa)
+		{
+			_load3x4_soa_ps(a, X, 0);
+		}
+
+		if (n >= 4 && !sb)
+		{
+			_load3x4_soa_ps(b, Y, 0);
+		}
+
+		for (; i + 4 <= n; i += 4)
+		{
+			if (sa)
+			{
+				_load3x4_soa_ps(a + i, X);
+			}
+
+			if (sb)
+			{
+				_load3x4_soa_ps(b + i, Y);
+			}
+
+			_multiply_soa<3, 3, 4, 4>(X, Y, Z);
+
+			for (auto r = 0; r < 3; r++)
+			{
+				Z[r * 4 + 3] = vaddq_f32(Z[r * 4 + 3], X[r * 4 + 3]); // translation
+			}
+
+			_store3x4_soa_ps(dst + i, Z);
+		}
+
+		auto const nil = vdupq_n_f32(0);
+
+		for (; i < n; i++)
+		{
+			auto const A0 = vld1q_f32(a[i * sa].data[0].data);
+			auto const A1 = vld1q_f32(a[i * sa].data[1].data);
+			auto const A2 = vld1q_f32(a[i * sa].data[2].data);
+			auto const B0 = vld1q_f32(b[i * sb].data[0].data);
+			auto const B1 = vld1q_f32(b[i * sb].data[1].data);
+			auto const B2 = vld1q_f32(b[i * sb].data[2].data);
+
+			//
+			// the implied row (0, 0, 0, 1) of b only picks up the translation of a
+			//
+
+			vst1q_f32(dst[i].data[0].data, vaddq_f32(_m3x3_mul_ps(A0, B0, B1, B2), vcopyq_laneq_f32(nil, 3, A0, 3)));
+			vst1q_f32(dst[i].data[1].data, vaddq_f32(_m3x3_mul_ps(A1, B0, B1, B2), vcopyq_laneq_f32(nil, 3, A1, 3)));
+			vst1q_f32(dst[i].data[2].data, vaddq_f32(_m3x3_mul_ps(A2, B0, B1, B2), vcopyq_laneq_f32(nil, 3, A2, 3)));
+		}
+	}
+
+	inline void _multiply_batch(TMatrix3x4<double> *dst,
+				    TMatrix3x4<double> const *a, std::size_t sa,
+				    TMatrix3x4<double> const *b, std::size_t sb, std::size_t n) noexcept
+	{
+		for (std::size_t i = 0; i < n; i++)
+		{
+			auto const l = a[i * sa];
+
+			auto const B0 = vld1q_f64(b[i * sb].data[0].data + 0); // xy
+			auto const B1 = vld1q_f64(b[i * sb].data[1].data + 0); // xy
+			auto const B2 = vld1q_f64(b[i * sb].data[2].data + 0); // xy
+			auto const D0 = vld1q_f64(b[i * sb].data[0].data + 2); // zw
+			auto const D1 = vld1q_f64(b[i * sb].data[1].data + 2); // zw
+			auto const D2 = vld1q_f64(b[i * sb].data[2].data + 2); // zw
+
+			for (auto j = 0; j < 3; j++)
+			{
+				auto const T = vsetq_lane_f64(0., vld1q_f64(l.data[j].data + 2), 0); // translation, 0w
+
+				vst1q_f64(dst[i].data[j].data + 0, _m3_mul_pd(l.data[j].data, B0, B1, B2));
+				vst1q_f64(dst[i].data[j].data + 2, vaddq_f64(_m3_mul_pd(l.data[j].data, D0, D1, D2), T));
+			}
+		}
+	}
+
+	inline void _multiply_batch(TMatrix4x4<float> *dst,
+				    TMatrix4x4<float> const *a, std::size_t sa,
+				    TMatrix4x4<float> const *b, std::size_t sb, std::size_t n) noexcept
+	{
+		float32x4_t X[16];
+		float32x4_t Y[16];
+		float32x4_t Z[16];
+		std::size_t i = 0;
+
+		if (n >= 4 && !sa)
+		{
+			_load4x4_soa_ps(a, X, 0);
+		}
+
+		if (n >= 4 && !sb)
+		{
+			_load4x4_soa_ps(b, Y, 0);
+		}
+
+		for (; i + 4 <= n; i += 4)
+		{
+			if (sa)
+			{
+				_load4x4_soa_ps(a + i, X);
+			}
+
+			if (sb)
+			{
+				_load4x4_soa_ps(b + i, Y);
+			}
+
+			_multiply_soa<4, 4, 4>(X, Y, Z);
+
+			_store4x4_soa_ps(dst + i, Z);
+		}
+
+		for (; i < n; i++)
+		{
+			auto const A0 = vld1q_f32(a[i * sa].data[0].data);
+			auto const A1 = vld1q_f32(a[i * sa].data[1].data);
+			auto const A2 = vld1q_f32(a[i * sa].data[2].data);
+			auto const A3 = vld1q_f32(a[i * sa].data[3].data);
+			auto const B0 = vld1q_f32(b[i * sb].data[0].data);
+			auto const B1 = vld1q_f32(b[i * sb].data[1].data);
+			auto const B2 = vld1q_f32(b[i * sb].data[2].data);
+			auto const B3 = vld1q_f32(b[i * sb].data[3].data);
+
+			vst1q_f32(dst[i].data[0].data, _m4x4_mul_ps(A0, B0, B1, B2, B3));
+			vst1q_f32(dst[i].data[1].data, _m4x4_mul_ps(A1, B0, B1, B2, B3));
+			vst1q_f32(dst[i].data[2].data, _m4x4_mul_ps(A2, B0, B1, B2, B3));
+			vst1q_f32(dst[i].data[3].data, _m4x4_mul_ps(A3, B0, B1, B2, B3));
+		}
+	}
+
+	inline void _multiply_batch(TMatrix4x4<double> *dst,
+				    TMatrix4x4<double> const *a, std::size_t sa,
+				    TMatrix4x4<double> const *b, std::size_t sb, std::size_t n) noexcept
+	{
+		for (std::size_t i = 0; i < n; i++)
+		{
+			auto const l = a[i * sa];
+
+			auto const B0 = vld1q_f64(b[i * sb].data[0].data + 0); // xy
+			auto const B1 = vld1q_f64(b[i * sb].data[1].data + 0); // xy
+			auto const B2 = vld1q_f64(b[i * sb].data[2].data + 0); // xy
+			auto const B3 = vld1q_f64(b[i * sb].data[3].data + 0); // xy
+			auto const D0 = vld1q_f64(b[i * sb].data[0].data + 2); // zw
+			auto const D1 = vld1q_f64(b[i * sb].data[1].data + 2); // zw
+			auto const D2 = vld1q_f64(b[i * sb].data[2].data + 2); // zw
+			auto const D3 = vld1q_f64(b[i * sb].data[3].data + 2); // zw
+
+			for (auto j = 0; j < 4; j++)
+			{
+				vst1q_f64(dst[i].data[j].data + 0, _m4_mul_pd(l.data[j].data, B0, B1, B2, B3));
+				vst1q_f64(dst[i].data[j].data + 2, _m4_mul_pd(l.data[j].data, D0, D1, D2, D3));
+			}
+		}
+	}
+
+	// ----------------------------------------------------------------- //
+
+	inline void multiply_batch(TMatrix2x2<float> *dst,
+				   TMatrix2x2<float> const *a,
+				   TMatrix2x2<float> const *b, std::size_t n) noexcept
+	{
+		_multiply_batch(dst, a, 1, b, 1, n);
+	}
+
+	inline void multiply_batch(TMatrix2x2<float> *dst,
+				   TMatrix2x2<float> const &a,
+				   TMatrix2x2<float> const *b, std::size_t n) noexcept
+	{
+		_multiply_batch(dst, &a, 0, b, 1, n);
+	}
+
+	inline void multiply_batch(TMatrix2x2<float> *dst,
+				   TMatrix2x2<float> const *a,
+				   TMatrix2x2<float> const &b, std::size_t n) noexcept
+	{
+		_multiply_batch(dst, a, 1, &b, 0, n);
+	}
+
+	inline void multiply_batch(TMatrix2x2<double> *dst,
+				   TMatrix2x2<double> const *a,
+				   TMatrix2x2<double> const *b, std::size_t n) noexcept
+	{
+		_multiply_batch(dst, a, 1, b, 1, n);
+	}
+
+	inline void multiply_batch(TMatrix2x2<double> *dst,
+				   TMatrix2x2<double> const &a,
+				   TMatrix2x2<double> const *b, std::size_t n) noexcept
+	{
+		_multiply_batch(dst, &a, 0, b, 1, n);
+	}
+
+	inline void multiply_batch(TMatrix2x2<double> *dst,
+				   TMatrix2x2<double> const *a,
+				   TMatrix2x2<double> const &b, std::size_t n) noexcept
+	{
+		_multiply_batch(dst, a, 1, &b, 0, n);
+	}
+
+	inline void multiply_batch(TMatrix3x3<float> *dst,
+				   TMatrix3x3<float> const *a,
+				   TMatrix3x3<float> const *b, std::size_t n) noexcept
+	{
+		_multiply_batch(dst, a, 1, b, 1, n);
+	}
+
+	inline void multiply_batch(TMatrix3x3<float> *dst,
+				   TMatrix3x3<float> const &a,
+				   TMatrix3x3<float> const *b, std::size_t n) noexcept
+	{
+		_multiply_batch(dst, &a, 0, b, 1, n);
+	}
+
+	inline void multiply_batch(TMatrix3x3<float> *dst,
+				   TMatrix3x3<float> const *a,
+				   TMatrix3x3<float> const &b, std::size_t n) noexcept
+	{
+		_multiply_batch(dst, a, 1, &b, 0, n);
+	}
+
+	inline void multiply_batch(TMatrix3x3<double> *dst,
+				   TMatrix3x3<double> const *a,
+				   TMatrix3x3<double> const *b, std::size_t n) noexcept
+	{
+		_multiply_batch(dst, a, 1, b, 1, n);
+	}
+
+	inline void multiply_batch(TMatrix3x3<double> *dst,
+				   TMatrix3x3<double> const &a,
+				   TMatrix3x3<double> const *b, std::size_t n) noexcept
+	{
+		_multiply_batch(dst, &a, 0, b, 1, n);
+	}
+
+	inline void multiply_batch(TMatrix3x3<double> *dst,
+				   TMatrix3x3<double> const *a,
+				   TMatrix3x3<double> const &b, std::size_t n) noexcept
+	{
+		_multiply_batch(dst, a, 1, &b, 0, n);
+	}
+
+	inline void multiply_batch(TMatrix3x4<float> *dst,
+				   TMatrix3x4<float> const *a,
+				   TMatrix3x4<float> const *b, std::size_t n) noexcept
+	{
+		_multiply_batch(dst, a, 1, b, 1, n);
+	}
+
+	inline void multiply_batch(TMatrix3x4<float> *dst,
+				   TMatrix3x4<float> const &a,
+				   TMatrix3x4<float> const *b, std::size_t n) noexcept
+	{
+		_multiply_batch(dst, &a, 0, b, 1, n);
+	}
+
+	inline void multiply_batch(TMatrix3x4<float> *dst,
+				   TMatrix3x4<float> const *a,
+				   TMatrix3x4<float> const &b, std::size_t n) noexcept
+	{
+		_multiply_batch(dst, a, 1, &b, 0, n);
+	}
+
+	inline void multiply_batch(TMatrix3x4<double> *dst,
+				   TMatrix3x4<double> const *a,
+				   TMatrix3x4<double> const *b, std::size_t n) noexcept
+	{
+		_multiply_batch(dst, a, 1, b, 1, n);
+	}
+
+	inline void multiply_batch(TMatrix3x4<double> *dst,
+				   TMatrix3x4<double> const &a,
+				   TMatrix3x4<double> const *b, std::size_t n) noexcept
+	{
+		_multiply_batch(dst, &a, 0, b, 1, n);
+	}
+
+	inline void multiply_batch(TMatrix3x4<double> *dst,
+				   TMatrix3x4<double> const *a,
+				   TMatrix3x4<double> const &b, std::size_t n) noexcept
+	{
+		_multiply_batch(dst, a, 1, &b, 0, n);
+	}
+
+	//
+	// with SVE the 4x4 pair forms come from sve.hh
+	//
+
+#ifndef __ARM_FEATURE_SVE
+	inline void multiply_batch(TMatrix4x4<float> *dst,
+				   TMatrix4x4<float> const *a,
+				   TMatrix4x4<float> const *b, std::size_t n) noexcept
+	{
+		_multiply_batch(dst, a, 1, b, 1, n);
+	}
+#endif
+
+	inline void multiply_batch(TMatrix4x4<float> *dst,
+				   TMatrix4x4<float> const &a,
+				   TMatrix4x4<float> const *b, std::size_t n) noexcept
+	{
+		_multiply_batch(dst, &a, 0, b, 1, n);
+	}
+
+	inline void multiply_batch(TMatrix4x4<float> *dst,
+				   TMatrix4x4<float> const *a,
+				   TMatrix4x4<float> const &b, std::size_t n) noexcept
+	{
+		_multiply_batch(dst, a, 1, &b, 0, n);
+	}
+
+#ifndef __ARM_FEATURE_SVE
+	inline void multiply_batch(TMatrix4x4<double> *dst,
+				   TMatrix4x4<double> const *a,
+				   TMatrix4x4<double> const *b, std::size_t n) noexcept
+	{
+		_multiply_batch(dst, a, 1, b, 1, n);
+	}
+#endif
+
+	inline void multiply_batch(TMatrix4x4<double> *dst,
+				   TMatrix4x4<double> const &a,
+				   TMatrix4x4<double> const *b, std::size_t n) noexcept
+	{
+		_multiply_batch(dst, &a, 0, b, 1, n);
+	}
+
+	inline void multiply_batch(TMatrix4x4<double> *dst,
+				   TMatrix4x4<double> const *a,
+				   TMatrix4x4<double> const &b, std::size_t n) noexcept
+	{
+		_multiply_batch(dst, a, 1, &b, 0, n);
+	}
+}
+
+// ------------------------------------------------------------------------- //
+
+namespace micro::math::simd
+{
+	//
+	// The batched inverses work on four matrices at a time in SoA form, m[k]
+	// holds element k of the four matrices, one per lane, so the scalar
+	// cofactor expansion runs unchanged across the lanes.
+	//
+
+	inline float32x4_t __vectorcall _fms_ps(float32x4_t const a,
+						float32x4_t const b,
+						float32x4_t const c,
+						float32x4_t const d) noexcept
+	{
+		return vmlsq_f32(vmulq_f32(a, b), c, d);
+	}
+
+	/**
+	 * @return a * x - b * y + c * z
+	 */
+	inline float32x4_t __vectorcall _m3_ps(float32x4_t const a, float32x4_t const x,
+					       float32x4_t const b, float32x4_t const y,
+					       float32x4_t const c, float32x4_t const z) noexcept
+	{
+		return vmlaq_f32(vmlsq_f32(vmulq_f32(a, x), b, y), c, z);
+	}
+
+	/**
+	 * @brief Writes det(src[i]) == 0 of four lanes
+	 */
+	inline void __vectorcall _singular_ps(bool *dst, float32x4_t const d) noexcept
+	{
+		auto const mask = vceqzq_f32(d);
+
+		dst[0] = vgetq_lane_u32(mask, 0) != 0;
+		dst[1] = vgetq_lane_u32(mask, 1) != 0;
+		dst[2] = vgetq_lane_u32(mask, 2) != 0;
+		dst[3] = vgetq_lane_u32(mask, 3) != 0;
+	}
+
+	// ----------------------------- 2 x 2 ----------------------------- //
+
+	inline void det_batch(float *dst,
+			      TMatrix2x2<float> const *src, std::size_t n) noexcept
+	{
+		std::size_t i = 0;
+
+		for (; i + 4 <= n; i += 4)
+		{
+			auto const m = vld4q_f32(reinterpret_cast<float const *>(src + i)); // a, b, c, d of 4 matrices
+
+			vst1q_f32(dst + i, _fms_ps(m.val[0], m.val[3], m.val[1], m.val[2]));
+		}
+
+		micro::math::det_batch<float>(dst + i, src + i, n - i);
+	}
+
+	inline void inverse_batch(TMatrix2x2<float> *dst,
+				  TMatrix2x2<float> const *src, std::size_t n, bool *singular = nullptr) noexcept
+	{
+		std::size_t i = 0;
+
+		for (; i + 4 <= n; i += 4)
+		{
+			auto const m = vld4q_f32(reinterpret_cast<float const *>(src + i)); // a, b, c, d of 4 matrices
+
+			auto const D = _fms_ps(m.val[0], m.val[3], m.val[1], m.val[2]);
+			auto const R = vdivq_f32(vdupq_n_f32(1.f), D);
+			auto const N = vnegq_f32(R);
+
+			if (singular)
+			{
+				_singular_ps(singular + i, D);
+			}
+
+			float32x4x4_t r;
+
+			r.val[0] = vmulq_f32(m.val[3], R);
+			r.val[1] = vmulq_f32(m.val[1], N);
+			r.val[2] = vmulq_f32(m.val[2], N);
+			r.val[3] = vmulq_f32(m.val[0], R);
+
+			vst4q_f32(reinterpret_cast<float *>(dst + i), r);
+		}
+
+		micro::math::inverse_batch<float>(dst + i, src + i, n - i, singular ? singular + i : nullptr);
+	}
+
+	// ----------------------------- 3 x 3 ----------------------------- //
+
+	inline void det_batch(float *dst,
+			      TMatrix3x3<float> const *src, std::size_t n) noexcept
+	{
+		std::size_t i = 0;
+
+		for (; i + 4 <= n; i += 4)
+		{
+			float32x4_t m[9];
+
+			_load3x3_soa_ps(src + i, m);
+
+			auto const A = _fms_ps(m[4], m[8], m[5], m[7]);
+			auto const B = _fms_ps(m[5], m[6], m[3], m[8]);
+			auto const C = _fms_ps(m[3], m[7], m[4], m[6]);
+
+			vst1q_f32(dst + i, vmlaq_f32(vmlaq_f32(vmulq_f32(m[0], A), m[1], B), m[2], C));
+		}
+
+		micro::math::det_batch<float>(dst + i, src + i, n - i);
+	}
+
+	inline void inverse_batch(TMatrix3x3<float> *dst,
+				  TMatrix3x3<float> const *src, std::size_t n, bool *singular = nullptr) noexcept
+	{
+		std::size_t i = 0;
+
+		for (; i + 4 <= n; i += 4)
+		{
+			float32x4_t m[9];
+			float32x4_t r[9];
+
+			_load3x3_soa_ps(src + i, m);
+
+			r[0] = _fms_ps(m[4], m[8], m[5], m[7]);
+			r[1] = _fms_ps(m[2], m[7], m[1], m[8]);
+			r[2] = _fms_ps(m[1], m[5], m[2], m[4]);
+			r[3] = _fms_ps(m[5], m[6], m[3], m[8]);
+			r[4] = _fms_ps(m[0], m[8], m[2], m[6]);
+			r[5] = _fms_ps(m[2], m[3], m[0], m[5]);
+			r[6] = _fms_ps(m[3], m[7], m[4], m[6]);
+			r[7] = _fms_ps(m[1], m[6], m[0], m[7]);
+			r[8] = _fms_ps(m[0], m[4], m[1], m[3]);
+
+			auto const D = vmlaq_f32(vmlaq_f32(vmulq_f32(m[0], r[0]), m[1], r[3]), m[2], r[6]);
+			auto const R = vdivq_f32(vdupq_n_f32(1.f), D);
+
+			if (singular)
+			{
+				_singular_ps(singular + i, D);
+			}
+
+			for (auto k = 0; k < 9; k++)
+			{
+				r[k] = vmulq_f32(r[k], R);
+			}
+
+			_store3x3_soa_ps(dst + i, r);
+		}
+
+		micro::math::inverse_batch<float>(dst + i, src + i, n - i, singular ? singular + i : nullptr);
+	}
+
+	// ----------------------------- 4 x 4 ----------------------------- //
+
+	/**
+	 * @brief 2x2 minors of the upper (s) and lower (c) two rows of a 4x4 matrix
+	 *
+	 * @return the determinant expanded over the minors
+	 */
+	inline float32x4_t _m4x4_minors_ps(float32x4_t const m[16], float32x4_t s[6], float32x4_t c[6]) noexcept
+	{
+		s[0] = _fms_ps(m[0], m[5], m[4], m[1]);
+		s[1] = _fms_ps(m[0], m[6], m[4], m[2]);
+		s[2] = _fms_ps(m[0], m[7], m[4], m[3]);
+		s[3] = _fms_ps(m[1], m[6], m[5], m[2]);
+		s[4] = _fms_ps(m[1], m[7], m[5], m[3]);
+		s[5] = _fms_ps(m[2], m[7], m[6], m[3]);
+		c[0] = _fms_ps(m[8], m[13], m[12], m[9]);
+		c[1] = _fms_ps(m[8], m[14], m[12], m[10]);
+		c[2] = _fms_ps(m[8], m[15], m[12], m[11]);
+		c[3] = _fms_ps(m[9], m[14], m[13], m[10]);
+		c[4] = _fms_ps(m[9], m[15], m[13], m[11]);
+		c[5] = _fms_ps(m[10], m[15], m[14], m[11]);
+
+		auto const A = _fms_ps(s[0], c[5], s[1], c[4]);
+		auto const B = vmlaq_f32(vmulq_f32(s[2], c[3]), s[3], c[2]);
+		auto const C = _fms_ps(s[5], c[0], s[4], c[1]);
+
+		return vaddq_f32(vaddq_f32(A, C), B);
+	}
+
+	inline void det_batch(float *dst,
+			      TMatrix4x4<float> const *src, std::size_t n) noexcept
+	{
+		std::size_t i = 0;
+
+		for (; i + 4 <= n; i += 4)
+		{
+			float32x4_t m[16];
+			float32x4_t s[6];
+			float32x4_t c[6];
+
+			_load4x4_soa_ps(src + i, m);
+			vst1q_f32(dst + i, _m4x4_minors_ps(m, s, c));
+		}
+
+		micro::math::det_batch<float>(dst + i, src + i, n - i);
+	}
+
+	inline void inverse_batch(TMatrix4x4<float> *dst,
+				  TMatrix4x4<float> const *src, std::size_t n, bool *singular = nullptr) noexcept
+	{
+		std::size_t i = 0;
+
+		for (; i + 4 <= n; i += 4)
+		{
+			float32x4_t m[16];
+			float32x4_t r[16];
+			float32x4_t s[6];
+			float32x4_t c[6];
+
+			_load4x4_soa_ps(src + i, m);
+
+			auto const D = _m4x4_minors_ps(m, s, c);
+			auto const R = vdivq_f32(vdupq_n_f32(1.f), D);
+			auto const N = vnegq_f32(R);
+
+			if (singular)
+			{
+				_singular_ps(singular + i, D);
+			}
+
+			r[0] = vmulq_f32(_m3_ps(m[5], c[5], m[6], c[4], m[7], c[3]), R);
+			r[1] = vmulq_f32(_m3_ps(m[1], c[5], m[2], c[4], m[3], c[3]), N);
+			r[2] = vmulq_f32(_m3_ps(m[13], s[5], m[14], s[4], m[15], s[3]), R);
+			r[3] = vmulq_f32(_m3_ps(m[9], s[5], m[10], s[4], m[11], s[3]), N);
+			r[4] = vmulq_f32(_m3_ps(m[4], c[5], m[6], c[2], m[7], c[1]), N);
+			r[5] = vmulq_f32(_m3_ps(m[0], c[5], m[2], c[2], m[3], c[1]), R);
+			r[6] = vmulq_f32(_m3_ps(m[12], s[5], m[14], s[2], m[15], s[1]), N);
+			r[7] = vmulq_f32(_m3_ps(m[8], s[5], m[10], s[2], m[11], s[1]), R);
+			r[8] = vmulq_f32(_m3_ps(m[4], c[4], m[5], c[2], m[7], c[0]), R);
+			r[9] = vmulq_f32(_m3_ps(m[0], c[4], m[1], c[2], m[3], c[0]), N);
+			r[10] = vmulq_f32(_m3_ps(m[12], s[4], m[13], s[2], m[15], s[0]), R);
+			r[11] = vmulq_f32(_m3_ps(m[8], s[4], m[9], s[2], m[11], s[0]), N);
+			r[12] = vmulq_f32(_m3_ps(m[4], c[3], m[5], c[1], m[6], c[0]), N);
+			r[13] = vmulq_f32(_m3_ps(m[0], c[3], m[1], c[1], m[2], c[0]), R);
+			r[14] = vmulq_f32(_m3_ps(m[12], s[3], m[13], s[1], m[14], s[0]), N);
+			r[15] = vmulq_f32(_m3_ps(m[8], s[3], m[9], s[1], m[10], s[0]), R);
+
+			_store4x4_soa_ps(dst + i, r);
+		}
+
+		micro::math::inverse_batch<float>(dst + i, src + i, n - i, singular ? singular + i : nullptr);
+	}
+}
+
+// ------------------------------------------------------------------------- //
+
+namespace micro::math::simd
+{
+	//
+	// Rows are loaded whole and written back one column at a time with the
+	// interleaving lane stores, vstNq_lane writes lane c of N rows to row c
+	// of the result.
+	//
+
+	inline TMatrix2x2<float> __vectorcall transpose(TMatrix2x2<float> const &m) noexcept
+	{
+		TMatrix2x2<float> r;
+
+		float32x4x2_t const l_matrix = {vcombine_f32(vld1_f32(m.data[0].data), vdup_n_f32(0)),
+						vcombine_f32(vld1_f32(m.data[1].data), vdup_n_f32(0))};
+
+		vst2q_lane_f32(r.data[0].data, l_matrix, 0);
+		vst2q_lane_f32(r.data[1].data, l_matrix, 1);
+
+		return r;
+	}
+
+	inline TMatrix3x2<float> __vectorcall transpose(TMatrix2x3<float> const &m) noexcept
+	{
+		TMatrix3x2<float> r;
+
+		float32x4x2_t const l_matrix = {_load3_ps(m.data[0]),
+						_load3_ps(m.data[1])};
+
+		vst2q_lane_f32(r.data[0].data, l_matrix, 0);
+		vst2q_lane_f32(r.data[1].data, l_matrix, 1);
+		vst2q_lane_f32(r.data[2].data, l_matrix, 2);
+
+		return r;
+	}
+
+	inline TMatrix4x2<float> __vectorcall transpose(TMatrix2x4<float> const &m) noexcept
+	{
+		TMatrix4x2<float> r;
+
+		float32x4x2_t const l_matrix = {vld1q_f32(m.data[0].data),
+						vld1q_f32(m.data[1].data)};
+
+		vst2q_lane_f32(r.data[0].data, l_matrix, 0);
+		vst2q_lane_f32(r.data[1].data, l_matrix, 1);
+		vst2q_lane_f32(r.data[2].data, l_matrix, 2);
+		vst2q_lane_f32(r.data[3].data, l_matrix, 3);
+
+		return r;
+	}
+
+	inline TMatrix2x3<float> __vectorcall transpose(TMatrix3x2<float> const &m) noexcept
+	{
+		TMatrix2x3<float> r;
+
+		float32x4x3_t const l_matrix = {vcombine_f32(vld1_f32(m.data[0].data), vdup_n_f32(0)),
+						vcombine_f32(vld1_f32(m.data[1].data), vdup_n_f32(0)),
+						vcombine_f32(vld1_f32(m.data[2].data), vdup_n_f32(0))};
+
+		vst3q_lane_f32(r.data[0].data, l_matrix, 0);
+		vst3q_lane_f32(r.data[1].data, l_matrix, 1);
+
+		return r;
+	}
+
+	inline TMatrix3x3<float> __vectorcall transpose(TMatrix3x3<float> const &m) noexcept
+	{
+		TMatrix3x3<float> r;
+
+		float32x4x3_t const l_matrix = {_load3_ps(m.data[0]),
+						_load3_ps(m.data[1]),
+						_load3_ps(m.data[2])};
+
+		vst3q_lane_f32(r.data[0].data, l_matrix, 0);
+		vst3q_lane_f32(r.data[1].data, l_matrix, 1);
+		vst3q_lane_f32(r.data[2].data, l_matrix, 2);
+
+		return r;
+	}
+
+	inline TMatrix4x3<float> __vectorcall transpose(TMatrix3x4<float> const &m) noexcept
+	{
+		TMatrix4x3<float> r;
+
+		float32x4x3_t const l_matrix = {vld1q_f32(m.data[0].data),
+						vld1q_f32(m.data[1].data),
+						vld1q_f32(m.data[2].data)};
+
+		vst3q_lane_f32(r.data[0].data, l_matrix, 0);
+		vst3q_lane_f32(r.data[1].data, l_matrix, 1);
+		vst3q_lane_f32(r.data[2].data, l_matrix, 2);
+		vst3q_lane_f32(r.data[3].data, l_matrix, 3);
+
+		return r;
+	}
+
+	inline TMatrix2x4<float> __vectorcall transpose(TMatrix4x2<float> const &m) noexcept
+	{
+		TMatrix2x4<float> r;
+
+		float32x4x4_t const l_matrix = {vcombine_f32(vld1_f32(m.data[0].data), vdup_n_f32(0)),
+						vcombine_f32(vld1_f32(m.data[1].data), vdup_n_f32(0)),
+						vcombine_f32(vld1_f32(m.data[2].data), vdup_n_f32(0)),
+						vcombine_f32(vld1_f32(m.data[3].data), vdup_n_f32(0))};
+
+		vst4q_lane_f32(r.data[0].data, l_matrix, 0);
+		vst4q_lane_f32(r.data[1].data, l_matrix, 1);
+
+		return r;
+	}
+
+	inline TMatrix3x4<float> __vectorcall transpose(TMatrix4x3<float> const &m) noexcept
+	{
+		TMatrix3x4<float> r;
+
+		float32x4x4_t const l_matrix = {_load3_ps(m.data[0]),
+						_load3_ps(m.data[1]),
+						_load3_ps(m.data[2]),
+						_load3_ps(m.data[3])};
+
+		vst4q_lane_f32(r.data[0].data, l_matrix, 0);
+		vst4q_lane_f32(r.data[1].data, l_matrix, 1);
+		vst4q_lane_f32(r.data[2].data, l_matrix, 2);
+
+		return r;
+	}
+
+	// ----------------------------------------------------------------- //
+
+	inline TMatrix2x2<double> __vectorcall transpose(TMatrix2x2<double> const &m) noexcept
+	{
+		TMatrix2x2<double> r;
+
+		auto const A = vld1q_f64(m.data[0].data);
+		auto const C = vld1q_f64(m.data[1].data);
+
+		float64x2x2_t const l = {A, C};
+
+		vst2q_lane_f64(r.data[0].data, l, 0);
+		vst2q_lane_f64(r.data[1].data, l, 1);
+
+		return r;
+	}
+
+	inline TMatrix3x2<double> __vectorcall transpose(TMatrix2x3<double> const &m) noexcept
+	{
+		TMatrix3x2<double> r;
+
+		auto const A = vld1q_f64(m.data[0].data); // xy
+		auto const B = vcombine_f64(vld1_f64(m.data[0].data + 2), vdup_n_f64(0)); // z0
+		auto const C = vld1q_f64(m.data[1].data); // xy
+		auto const D = vcombine_f64(vld1_f64(m.data[1].data + 2), vdup_n_f64(0)); // z0
+
+		float64x2x2_t const l = {A, C};
+		float64x2x2_t const h = {B, D};
+
+		vst2q_lane_f64(r.data[0].data, l, 0);
+		vst2q_lane_f64(r.data[1].data, l, 1);
+		vst2q_lane_f64(r.data[2].data, h, 0);
+
+		return r;
+	}
+
+	inline TMatrix4x2<double> __vectorcall transpose(TMatrix2x4<double> const &m) noexcept
+	{
+		TMatrix4x2<double> r;
+
+		auto const A = vld1q_f64(m.data[0].data); // xy
+		auto const B = vld1q_f64(m.data[0].data + 2); // zw
+		auto const C = vld1q_f64(m.data[1].data); // xy
+		auto const D = vld1q_f64(m.data[1].data + 2); // zw
+
+		float64x2x2_t const l = {A, C};
+		float64x2x2_t const h = {B, D};
+
+		vst2q_lane_f64(r.data[0].data, l, 0);
+		vst2q_lane_f64(r.data[1].data, l, 1);
+		vst2q_lane_f64(r.data[2].data, h, 0);
+		vst2q_lane_f64(r.data[3].data, h, 1);
+
+		return r;
+	}
+
+	inline TMatrix2x3<double> __vectorcall transpose(TMatrix3x2<double> const &m) noexcept
+	{
+		TMatrix2x3<double> r;
+
+		auto const A = vld1q_f64(m.data[0].data);
+		auto const C = vld1q_f64(m.data[1].data);
+		auto const E = vld1q_f64(m.data[2].data);
+
+		float64x2x3_t const l = {A, C, E};
+
+		vst3q_lane_f64(r.data[0].data, l, 0);
+		vst3q_lane_f64(r.data[1].data, l, 1);
+
+		return r;
+	}
+
+	inline TMatrix3x3<double> __vectorcall transpose(TMatrix3x3<double> const &m) noexcept
+	{
+		TMatrix3x3<double> r;
+
+		auto const A = vld1q_f64(m.data[0].data); // xy
+		auto const B = vcombine_f64(vld1_f64(m.data[0].data + 2), vdup_n_f64(0)); // z0
+		auto const C = vld1q_f64(m.data[1].data); // xy
+		auto const D = vcombine_f64(vld1_f64(m.data[1].data + 2), vdup_n_f64(0)); // z0
+		auto const E = vld1q_f64(m.data[2].data); // xy
+		auto const F = vcombine_f64(vld1_f64(m.data[2].data + 2), vdup_n_f64(0)); // z0
+
+		float64x2x3_t const l = {A, C, E};
+		float64x2x3_t const h = {B, D, F};
+
+		vst3q_lane_f64(r.data[0].data, l, 0);
+		vst3q_lane_f64(r.data[1].data, l, 1);
+		vst3q_lane_f64(r.data[2].data, h, 0);
+
+		return r;
+	}
+
+	inline TMatrix4x3<double> __vectorcall transpose(TMatrix3x4<double> const &m) noexcept
+	{
+		TMatrix4x3<double> r;
+
+		auto const A = vld1q_f64(m.data[0].data); // xy
+		auto const B = vld1q_f64(m.data[0].data + 2); // zw
+		auto const C = vld1q_f64(m.data[1].data); // xy
+		auto const D = vld1q_f64(m.data[1].data + 2); // zw
+		auto const E = vld1q_f64(m.data[2].data); // xy
+		auto const F = vld1q_f64(m.data[2].data + 2); // zw
+
+		float64x2x3_t const l = {A, C, E};
+		float64x2x3_t const h = {B, D, F};
+
+		vst3q_lane_f64(r.data[0].data, l, 0);
+		vst3q_lane_f64(r.data[1].data, l, 1);
+		vst3q_lane_f64(r.data[2].data, h, 0);
+		vst3q_lane_f64(r.data[3].data, h, 1);
+
+		return r;
+	}
+
+	inline TMatrix2x4<double> __vectorcall transpose(TMatrix4x2<double> const &m) noexcept
+	{
+		TMatrix2x4<double> r;
+
+		auto const A = vld1q_f64(m.data[0].data);
+		auto const C = vld1q_f64(m.data[1].data);
+		auto const E = vld1q_f64(m.data[2].data);
+		auto const G = vld1q_f64(m.data[3].data);
+
+		float64x2x4_t const l = {A, C, E, G};
+
+		vst4q_lane_f64(r.data[0].data, l, 0);
+		vst4q_lane_f64(r.data[1].data, l, 1);
+
+		return r;
+	}
+
+	inline TMatrix3x4<double> __vectorcall transpose(TMatrix4x3<double> const &m) noexcept
+	{
+		TMatrix3x4<double> r;
+
+		auto const A = vld1q_f64(m.data[0].data); // xy
+		auto const B = vcombine_f64(vld1_f64(m.data[0].data + 2), vdup_n_f64(0)); // z0
+		auto const C = vld1q_f64(m.data[1].data); // xy
+		auto const D = vcombine_f64(vld1_f64(m.data[1].data + 2), vdup_n_f64(0)); // z0
+		auto const E = vld1q_f64(m.data[2].data); // xy
+		auto const F = vcombine_f64(vld1_f64(m.data[2].data + 2), vdup_n_f64(0)); // z0
+		auto const G = vld1q_f64(m.data[3].data); // xy
+		auto const H = vcombine_f64(vld1_f64(m.data[3].data + 2), vdup_n_f64(0)); // z0
+
+		float64x2x4_t const l = {A, C, E, G};
+		float64x2x4_t const h = {B, D, F, H};
+
+		vst4q_lane_f64(r.data[0].data, l, 0);
+		vst4q_lane_f64(r.data[1].data, l, 1);
+		vst4q_lane_f64(r.data[2].data, h, 0);
+
+		return r;
+	}
+
+	inline TMatrix4x4<double> __vectorcall transpose(TMatrix4x4<double> const &m) noexcept
+	{
+		TMatrix4x4<double> r;
+
+		auto const A = vld1q_f64(m.data[0].data); // xy
+		auto const B = vld1q_f64(m.data[0].data + 2); // zw
+		auto const C = vld1q_f64(m.data[1].data); // xy
+		auto const D = vld1q_f64(m.data[1].data + 2); // zw
+		auto const E = vld1q_f64(m.data[2].data); // xy
+		auto const F = vld1q_f64(m.data[2].data + 2); // zw
+		auto const G = vld1q_f64(m.data[3].data); // xy
+		auto const H = vld1q_f64(m.data[3].data + 2); // zw
+
+		float64x2x4_t const l = {A, C, E, G};
+		float64x2x4_t const h = {B, D, F, H};
+
+		vst4q_lane_f64(r.data[0].data, l, 0);
+		vst4q_lane_f64(r.data[1].data, l, 1);
+		vst4q_lane_f64(r.data[2].data, h, 0);
+		vst4q_lane_f64(r.data[3].data, h, 1);
+
+		return r;
+	}
+
+	// ----------------------------------------------------------------- //
+
+	inline void transpose_batch(TMatrix2x2<float> *dst,
+				    TMatrix2x2<float> const *src, std::size_t n) noexcept
+	{
+		for (std::size_t i = 0; i < n; i++)
+		{
+			dst[i] = transpose(src[i]);
+		}
+	}
+
+	inline void transpose_batch(TMatrix3x2<float> *dst,
+				    TMatrix2x3<float> const *src, std::size_t n) noexcept
+	{
+		for (std::size_t i = 0; i < n; i++)
+		{
+			dst[i] = transpose(src[i]);
+		}
+	}
+
+	inline void transpose_batch(TMatrix4x2<float> *dst,
+				    TMatrix2x4<float> const *src, std::size_t n) noexcept
+	{
+		for (std::size_t i = 0; i < n; i++)
+		{
+			dst[i] = transpose(src[i]);
+		}
+	}
+
+	inline void transpose_batch(TMatrix2x3<float> *dst,
+				    TMatrix3x2<float> const *src, std::size_t n) noexcept
+	{
+		for (std::size_t i = 0; i < n; i++)
+		{
+			dst[i] = transpose(src[i]);
+		}
+	}
+
+	inline void transpose_batch(TMatrix3x3<float> *dst,
+				    TMatrix3x3<float> const *src, std::size_t n) noexcept
+	{
+		for (std::size_t i = 0; i < n; i++)
+		{
+			dst[i] = transpose(src[i]);
+		}
+	}
+
+	inline void transpose_batch(TMatrix4x3<float> *dst,
+				    TMatrix3x4<float> const *src, std::size_t n) noexcept
+	{
+		for (std::size_t i = 0; i < n; i++)
+		{
+			dst[i] = transpose(src[i]);
+		}
+	}
+
+	inline void transpose_batch(TMatrix2x4<float> *dst,
+				    TMatrix4x2<float> const *src, std::size_t n) noexcept
+	{
+		for (std::size_t i = 0; i < n; i++)
+		{
+			dst[i] = transpose(src[i]);
+		}
+	}
+
+	inline void transpose_batch(TMatrix3x4<float> *dst,
+				    TMatrix4x3<float> const *src, std::size_t n) noexcept
+	{
+		for (std::size_t i = 0; i < n; i++)
+		{
+			dst[i] = transpose(src[i]);
+		}
+	}
+
+	inline void transpose_batch(TMatrix4x4<float> *dst,
+				    TMatrix4x4<float> const *src, std::size_t n) noexcept
+	{
+		for (std::size_t i = 0; i < n; i++)
+		{
+			dst[i] = transpose(src[i]);
+		}
+	}
+
+	inline void transpose_batch(TMatrix2x2<double> *dst,
+				    TMatrix2x2<double> const *src, std::size_t n) noexcept
+	{
+		for (std::size_t i = 0; i < n; i++)
+		{
+			dst[i] = transpose(src[i]);
+		}
+	}
+
+	inline void transpose_batch(TMatrix3x2<double> *dst,
+				    TMatrix2x3<double> const *src, std::size_t n) noexcept
+	{
+		for (std::size_t i = 0; i < n; i++)
+		{
+			dst[i] = transpose(src[i]);
+		}
+	}
+
+	inline void transpose_batch(TMatrix4x2<double> *dst,
+				    TMatrix2x4<double> const *src, std::size_t n) noexcept
+	{
+		for (std::size_t i = 0; i < n; i++)
+		{
+			dst[i] = transpose(src[i]);
+		}
+	}
+
+	inline void transpose_batch(TMatrix2x3<double> *dst,
+				    TMatrix3x2<double> const *src, std::size_t n) noexcept
+	{
+		for (std::size_t i = 0; i < n; i++)
+		{
+			dst[i] = transpose(src[i]);
+		}
+	}
+
+	inline void transpose_batch(TMatrix3x3<double> *dst,
+				    TMatrix3x3<double> const *src, std::size_t n) noexcept
+	{
+		for (std::size_t i = 0; i < n; i++)
+		{
+			dst[i] = transpose(src[i]);
+		}
+	}
+
+	inline void transpose_batch(TMatrix4x3<double> *dst,
+				    TMatrix3x4<double> const *src, std::size_t n) noexcept
+	{
+		for (std::size_t i = 0; i < n; i++)
+		{
+			dst[i] = transpose(src[i]);
+		}
+	}
+
+	inline void transpose_batch(TMatrix2x4<double> *dst,
+				    TMatrix4x2<double> const *src, std::size_t n) noexcept
+	{
+		for (std::size_t i = 0; i < n; i++)
+		{
+			dst[i] = transpose(src[i]);
+		}
+	}
+
+	inline void transpose_batch(TMatrix3x4<double> *dst,
+				    TMatrix4x3<double> const *src, std::size_t n) noexcept
+	{
+		for (std::size_t i = 0; i < n; i++)
+		{
+			dst[i] = transpose(src[i]);
+		}
+	}
+
+	inline void transpose_batch(TMatrix4x4<double> *dst,
+				    TMatrix4x4<double> const *src, std::size_t n) noexcept
+	{
+		for (std::size_t i = 0; i < n; i++)
+		{
+			dst[i] = transpose(src[i]);
+		}
+	}
+
+	inline void transpose_batch(TMatrix4x4SoA<float> const &dst,
+				    TMatrix4x4<float> const *src, std::size_t n) noexcept
+	{
+		std::size_t i = 0;
+
+		for (; i + 4 <= n; i += 4)
+		{
+			float32x4_t m[16];
+
+			_load4x4_soa_ps(src + i, m);
+
+			for (auto k = 0; k < 16; k++)
+			{
+				vst1q_f32(dst.data[k] + i, m[k]);
+			}
+		}
+
+		for (; i < n; i++)
+		{
+			for (auto k = 0; k < 16; k++)
+			{
+				dst.data[k][i] = src[i].data[k / 4].data[k % 4];
+			}
+		}
+	}
+
+	inline void transpose_batch(TMatrix4x4<float> *dst,
+				    TMatrix4x4SoA<float const> const &src, std::size_t n) noexcept
+	{
+		std::size_t i = 0;
+
+		for (; i + 4 <= n; i += 4)
+		{
+			float32x4_t m[16];
+
+			for (auto k = 0; k < 16; k++)
+			{
+				m[k] = vld1q_f32(src.data[k] + i);
+			}
+
+			_store4x4_soa_ps(dst + i, m);
+		}
+
+		for (; i < n; i++)
+		{
+			for (auto k = 0; k < 16; k++)
+			{
+				dst[i].data[k / 4].data[k % 4] = src.data[k][i];
+			}
+		}
+	}
+}
+
+// ------------------------------------------------------------------------- //
+
+namespace micro::math::simd
+{
+	//
+	// Column-major matrices multiply a vector by broadcasting its components
+	// against the columns, no horizontal adds are needed.
+	//
+
+	inline TVector4<float> __vectorcall operator*(TMatrix4x4<float, ColumnMajor> const &m,
+						      TVector4<float> const &v) noexcept
+	{
+		TVector4<float> r;
+
+		auto const A = vld1q_f32(m.data[0].data);
+		auto const B = vld1q_f32(m.data[1].data);
+		auto const C = vld1q_f32(m.data[2].data);
+		auto const D = vld1q_f32(m.data[3].data);
+
+		vst1q_f32(r.data, _m4x4_mul_ps(vld1q_f32(v.data), A, B, C, D));
+
+		return r;
+	}
+
+	inline TMatrix4x4<float, ColumnMajor> operator*(TMatrix4x4<float, ColumnMajor> const &a,
+							TMatrix4x4<float, ColumnMajor> const &b) noexcept
+	{
+		TMatrix4x4<float, ColumnMajor> r;
+
+		auto const A0 = vld1q_f32(a.data[0].data);
+		auto const A1 = vld1q_f32(a.data[1].data);
+		auto const A2 = vld1q_f32(a.data[2].data);
+		auto const A3 = vld1q_f32(a.data[3].data);
+		auto const B0 = vld1q_f32(b.data[0].data);
+		auto const B1 = vld1q_f32(b.data[1].data);
+		auto const B2 = vld1q_f32(b.data[2].data);
+		auto const B3 = vld1q_f32(b.data[3].data);
+
+		vst1q_f32(r.data[0].data, _m4x4_mul_ps(B0, A0, A1, A2, A3));
+		vst1q_f32(r.data[1].data, _m4x4_mul_ps(B1, A0, A1, A2, A3));
+		vst1q_f32(r.data[2].data, _m4x4_mul_ps(B2, A0, A1, A2, A3));
+		vst1q_f32(r.data[3].data, _m4x4_mul_ps(B3, A0, A1, A2, A3));
+
+		return r;
+	}
+
+	inline void transform_batch(TVector4<float> *dst,
+				    TMatrix4x4<float, ColumnMajor> const &m,
+				    TVector4<float> const *src, std::size_t n) noexcept
+	{
+		auto const A = vld1q_f32(m.data[0].data);
+		auto const B = vld1q_f32(m.data[1].data);
+		auto const C = vld1q_f32(m.data[2].data);
+		auto const D = vld1q_f32(m.data[3].data);
+
+		for (std::size_t i = 0; i < n; i++)
+		{
+			vst1q_f32(dst[i].data, _m4x4_mul_ps(vld1q_f32(src[i].data), A, B, C, D));
+		}
+	}
+
+	// ----------------------------------------------------------------- //
+
+	inline TVector4<double> __vectorcall operator*(TMatrix4x4<double, ColumnMajor> const &m,
+						       TVector4<double> const &v) noexcept
+	{
+		TVector4<double> r;
+
+		auto const A = vld1q_f64(m.data[0].data + 0); // xy
+		auto const B = vld1q_f64(m.data[1].data + 0); // xy
+		auto const C = vld1q_f64(m.data[2].data + 0); // xy
+		auto const D = vld1q_f64(m.data[3].data + 0); // xy
+		auto const E = vld1q_f64(m.data[0].data + 2); // zw
+		auto const F = vld1q_f64(m.data[1].data + 2); // zw
+		auto const G = vld1q_f64(m.data[2].data + 2); // zw
+		auto const H = vld1q_f64(m.data[3].data + 2); // zw
+
+		vst1q_f64(r.data + 0, _m4_mul_pd(v.data, A, B, C, D));
+		vst1q_f64(r.data + 2, _m4_mul_pd(v.data, E, F, G, H));
+
+		return r;
+	}
+
+	inline TMatrix4x4<double, ColumnMajor> operator*(TMatrix4x4<double, ColumnMajor> const &a,
+							 TMatrix4x4<double, ColumnMajor> const &b) noexcept
+	{
+		TMatrix4x4<double, ColumnMajor> r;
+
+		for (auto j = 0; j < 4; j++)
+		{
+			r.data[j] = a * b.data[j];
+		}
+
+		return r;
+	}
+
+	inline void transform_batch(TVector4<double> *dst,
+				    TMatrix4x4<double, ColumnMajor> const &m,
+				    TVector4<double> const *src, std::size_t n) noexcept
+	{
+		auto const A = vld1q_f64(m.data[0].data + 0); // xy
+		auto const B = vld1q_f64(m.data[1].data + 0); // xy
+		auto const C = vld1q_f64(m.data[2].data + 0); // xy
+		auto const D = vld1q_f64(m.data[3].data + 0); // xy
+		auto const E = vld1q_f64(m.data[0].data + 2); // zw
+		auto const F = vld1q_f64(m.data[1].data + 2); // zw
+		auto const G = vld1q_f64(m.data[2].data + 2); // zw
+		auto const H = vld1q_f64(m.data[3].data + 2); // zw
+
+		for (std::size_t i = 0; i < n; i++)
+		{
+			auto const v = src[i];
+
+			vst1q_f64(dst[i].data + 0, _m4_mul_pd(v.data, A, B, C, D));
+			vst1q_f64(dst[i].data + 2, _m4_mul_pd(v.data, E, F, G, H));
+		}
+	}
+}
+
+// ------------------------------------------------------------------------- //
+
+namespace micro::math::simd
+{
+	//
+	// Row-major matrix x vector, the de-interleaving loads hand back the
+	// columns directly and the product is x * c0 + y * c1 + z * c2 + w * c3,
+	// so there are no horizontal sums. The batch forms load the columns
+	// once for the whole array.
+	//
+
+	inline TVector2<float> __vectorcall operator*(TMatrix2x2<float> const &m,
+						      TVector2<float> const &v) noexcept
+	{
+		TVector2<float> r;
+
+		auto const A = vld2_f32(m.data[0].data); // ac, bd
+		auto const V = vld1_f32(v.data);
+
+		vst1_f32(r.data, vmla_lane_f32(vmul_lane_f32(A.val[0], V, 0), A.val[1], V, 1));
+
+		return r;
+	}
+
+	/**
+	 * @brief Columns of a 3 x 3 matrix, lane 3 is 0
+	 */
+	inline float32x4x3_t _m3x3_cols_ps(TMatrix3x3<float> const &m) noexcept
+	{
+		float32x4x3_t r = {vdupq_n_f32(0), vdupq_n_f32(0), vdupq_n_f32(0)};
+
+		r = vld3q_lane_f32(m.data[0].data, r, 0);
+		r = vld3q_lane_f32(m.data[1].data, r, 1);
+		r = vld3q_lane_f32(m.data[2].data, r, 2);
+
+		return r;
+	}
+
+	inline TVector3<float> __vectorcall operator*(TMatrix3x3<float> const &m,
+						      TVector3<float> const &v) noexcept
+	{
+		TVector3<float> r;
+
+		auto const C = _m3x3_cols_ps(m);
+
+		_store3_ps(r, _m3x3_mul_ps(_load3_ps(v), C.val[0], C.val[1], C.val[2]));
+
+		return r;
+	}
+
+	inline TVector3<float> __vectorcall operator*(TMatrix3x4<float> const &m,
+						      TVector4<float> const &v) noexcept
+	{
+		TVector3<float> r;
+
+		float32x4x4_t C = {vdupq_n_f32(0), vdupq_n_f32(0), vdupq_n_f32(0), vdupq_n_f32(0)};
+
+		C = vld4q_lane_f32(m.data[0].data, C, 0);
+		C = vld4q_lane_f32(m.data[1].data, C, 1);
+		C = vld4q_lane_f32(m.data[2].data, C, 2);
+
+		_store3_ps(r, _m4x4_mul_ps(vld1q_f32(v.data), C.val[0], C.val[1], C.val[2], C.val[3]));
+
+		return r;
+	}
+
+	inline TVector4<float> __vectorcall operator*(TMatrix4x4<float> const &m,
+						      TVector4<float> const &v) noexcept
+	{
+		TVector4<float> r;
+
+		auto const C = vld4q_f32(m.data[0].data); // columns
+
+		vst1q_f32(r.data, _m4x4_mul_ps(vld1q_f32(v.data), C.val[0], C.val[1], C.val[2], C.val[3]));
+
+		return r;
+	}
+
+	inline TVector2<double> __vectorcall operator*(TMatrix2x2<double> const &m,
+						       TVector2<double> const &v) noexcept
+	{
+		TVector2<double> r;
+
+		auto const A = vld2q_f64(m.data[0].data); // ac, bd
+
+		vst1q_f64(r.data, vaddq_f64(vmulq_n_f64(A.val[0], v.x()), vmulq_n_f64(A.val[1], v.y())));
+
+		return r;
+	}
+
+	inline TVector4<double> __vectorcall operator*(TMatrix4x4<double> const &m,
+						       TVector4<double> const &v) noexcept
+	{
+		TVector4<double> r;
+
+		auto const U = vld4q_f64(m.data[0].data); // columns, rows 1-2
+		auto const L = vld4q_f64(m.data[2].data); // columns, rows 3-4
+
+		vst1q_f64(r.data + 0, _m4_mul_pd(v.data, U.val[0], U.val[1], U.val[2], U.val[3]));
+		vst1q_f64(r.data + 2, _m4_mul_pd(v.data, L.val[0], L.val[1], L.val[2], L.val[3]));
+
+		return r;
+	}
+
+	//
+	// with SVE the row-major transform_batch forms come from sve.hh
+	//
+
+#ifndef __ARM_FEATURE_SVE
+	inline void transform_batch(TVector4<float> *dst,
+				    TMatrix4x4<float> const &m,
+				    TVector4<float> const *src, std::size_t n) noexcept
+	{
+		auto const C = vld4q_f32(m.data[0].data);
+
+		for (std::size_t i = 0; i < n; i++)
+		{
+			vst1q_f32(dst[i].data, _m4x4_mul_ps(vld1q_f32(src[i].data), C.val[0], C.val[1], C.val[2], C.val[3]));
+		}
+	}
+
+	inline void transform_batch(TVector3<float> *dst,
+				    TMatrix3x3<float> const &m,
+				    TVector3<float> const *src, std::size_t n) noexcept
+	{
+		auto const C = _m3x3_cols_ps(m);
+
+		for (std::size_t i = 0; i < n; i++)
+		{
+			_store3_ps(dst[i], _m3x3_mul_ps(_load3_ps(src[i]), C.val[0], C.val[1], C.val[2]));
+		}
+	}
+
+	inline void transform_batch(TVector4<double> *dst,
+				    TMatrix4x4<double> const &m,
+				    TVector4<double> const *src, std::size_t n) noexcept
+	{
+		auto const U = vld4q_f64(m.data[0].data);
+		auto const L = vld4q_f64(m.data[2].data);
+
+		for (std::size_t i = 0; i < n; i++)
+		{
+			auto const v = src[i];
+
+			vst1q_f64(dst[i].data + 0, _m4_mul_pd(v.data, U.val[0], U.val[1], U.val[2], U.val[3]));
+			vst1q_f64(dst[i].data + 2, _m4_mul_pd(v.data, L.val[0], L.val[1], L.val[2], L.val[3]));
+		}
+	}
+#endif
+}
+
+// ------------------------------------------------------------------------- //
+
+namespace micro::math::simd
+{
+	inline TVector4<float> __vectorcall operator*(PreparedTransform<TMatrix4x4<float>> const &p,
+						      TVector4<float> const &v) noexcept
+	{
+		TVector4<float> r;
+
+		auto const C = vld1q_f32_x4(p.data[0].data); // columns
+
+		vst1q_f32(r.data, _m4x4_mul_ps(vld1q_f32(v.data), C.val[0], C.val[1], C.val[2], C.val[3]));
+
+		return r;
+	}
+
+	inline void transform_batch(TVector4<float> *dst,
+				    PreparedTransform<TMatrix4x4<float>> const &m,
+				    TVector4<float> const *src, std::size_t n) noexcept
+	{
+		auto const C = vld1q_f32_x4(m.data[0].data);
+
+		for (std::size_t i = 0; i < n; i++)
+		{
+			vst1q_f32(dst[i].data, _m4x4_mul_ps(vld1q_f32(src[i].data), C.val[0], C.val[1], C.val[2], C.val[3]));
+		}
+	}
+
+	inline TVector4<double> __vectorcall operator*(PreparedTransform<TMatrix4x4<double>> const &p,
+						       TVector4<double> const &v) noexcept
+	{
+		TVector4<double> r;
+
+		auto const U = vld1q_f64_x4(p.data[0].data); // xy, zw of columns 1-2
+		auto const L = vld1q_f64_x4(p.data[2].data); // xy, zw of columns 3-4
+
+		vst1q_f64(r.data + 0, _m4_mul_pd(v.data, U.val[0], U.val[2], L.val[0], L.val[2]));
+		vst1q_f64(r.data + 2, _m4_mul_pd(v.data, U.val[1], U.val[3], L.val[1], L.val[3]));
+
+		return r;
+	}
+
+	inline void transform_batch(TVector4<double> *dst,
+				    PreparedTransform<TMatrix4x4<double>> const &m,
+				    TVector4<double> const *src, std::size_t n) noexcept
+	{
+		auto const U = vld1q_f64_x4(m.data[0].data);
+		auto const L = vld1q_f64_x4(m.data[2].data);
+
+		for (std::size_t i = 0; i < n; i++)
+		{
+			auto const v = src[i];
+
+			vst1q_f64(dst[i].data + 0, _m4_mul_pd(v.data, U.val[0], U.val[2], L.val[0], L.val[2]));
+			vst1q_f64(dst[i].data + 2, _m4_mul_pd(v.data, U.val[1], U.val[3], L.val[1], L.val[3]));
+		}
+	}
+}
+
+// ------------------------------------------------------------------------- //
+
+#include <libmath/project.hh>
+
 namespace micro::math::simd
 {
 	/**
-	 * @brief Multiply a row from A matrix with all rows of B matrix
-	 *
-	 * @param r A matrix row
-	 * @param a B matrix 1st-row
-	 * @param b B matrix 2nd-row
-	 * @param c B matrix 3rd-row
-	 *
-	 * @return r.x * a + r.y * b + r.z * c
+	 * @brief 1 / a refined with two Newton-Raphson steps
 	 */
-	inline float32x4_t __vectorcall _m3x3_mul_ps(float32x4_t const r,
-						     float32x4_t const a,
-						     float32x4_t const b,
-						     float32x4_t const c) noexcept
+	inline float32x4_t __vectorcall _rcp_nr_ps(float32x4_t const a) noexcept
 	{
-		const auto A = vmulq_laneq_f32(a, r, 0);
-		const auto B = vmulq_laneq_f32(b, r, 1);
-		const auto C = vmulq_laneq_f32(c, r, 2);
-		const auto E = vaddq_f32(A, C);
-		const auto F = vaddq_f32(E, B);
+		auto R = vrecpeq_f32(a);
 
-		return F;
+		R = vmulq_f32(vrecpsq_f32(a, R), R);
+		R = vmulq_f32(vrecpsq_f32(a, R), R);
+
+		return R;
 	}
 
-	inline TMatrix3x3<float> operator*(TMatrix3x3<float> const &a,
-					   TMatrix3x3<float> const &b) noexcept
+	/**
+	 * @brief Projects four points at a time, vld3q de-interleaves the
+	 *        positions and vst3q / vst4q write the results back
+	 */
+	inline std::size_t project_batch(TVector4<float> *clip,
+					 TVector3<float> *ndc,
+					 TVector3<float> *screen,
+					 std::uint8_t *flags,
+					 TMatrix4x4<float> const &m,
+					 TViewport<float> const &v,
+					 TVector3<float> const *src, std::size_t n,
+					 std::uint32_t *visible = nullptr) noexcept
 	{
-		auto const nil = vdup_n_f32(0);
+		auto const M0 = vld1q_f32(m.data[0].data);
+		auto const M1 = vld1q_f32(m.data[1].data);
+		auto const M2 = vld1q_f32(m.data[2].data);
+		auto const M3 = vld1q_f32(m.data[3].data);
 
-		alignas(alignof(float32x4_t)) float _0[4];
-		alignas(alignof(float32x4_t)) float _1[4];
-		alignas(alignof(float32x4_t)) float _2[4];
+		auto const nil = vdupq_n_f32(0.f);
+		auto const hw = vdupq_n_f32(v.w() / 2.f);
+		auto const hh = vdupq_n_f32(v.h() / 2.f);
+		auto const ox = vdupq_n_f32(v.x() + v.w() / 2.f);
+		auto const oy = vdupq_n_f32(v.y() + v.h() / 2.f);
 
-		auto const A0 = vcombine_f32(vld1_f32(a.data[0].data), vld1_lane_f32(a.data[0].data + 2, nil, 0));
-		auto const A1 = vcombine_f32(vld1_f32(a.data[1].data), vld1_lane_f32(a.data[1].data + 2, nil, 0));
-		auto const A2 = vcombine_f32(vld1_f32(a.data[2].data), vld1_lane_f32(a.data[2].data + 2, nil, 0));
-		auto const B0 = vcombine_f32(vld1_f32(b.data[0].data), vld1_lane_f32(b.data[0].data + 2, nil, 0));
-		auto const B1 = vcombine_f32(vld1_f32(b.data[1].data), vld1_lane_f32(b.data[1].data + 2, nil, 0));
-		auto const B2 = vcombine_f32(vld1_f32(b.data[2].data), vld1_lane_f32(b.data[2].data + 2, nil, 0));
+		alignas(16) static constexpr std::uint32_t lane[4] = {1, 2, 4, 8};
 
-		vst1q_f32(_0, _m3x3_mul_ps(A0, B0, B1, B2));
-		vst1q_f32(_1, _m3x3_mul_ps(A1, B0, B1, B2));
-		vst1q_f32(_2, _m3x3_mul_ps(A2, B0, B1, B2));
+		auto const bit = vld1q_u32(lane);
 
-		return TMatrix3x3<float>{_0[0], _0[1], _0[2],
-					 _1[0], _1[1], _1[2],
-					 _2[0], _2[1], _2[2]};
+		std::size_t i = 0;
+		std::size_t k = 0;
+
+		for (; i + 4 <= n; i += 4)
+		{
+			auto const P = vld3q_f32(src[i].data);
+
+			auto const X = vfmaq_laneq_f32(vfmaq_laneq_f32(vfmaq_laneq_f32(vdupq_laneq_f32(M0, 3), P.val[0], M0, 0), P.val[1], M0, 1), P.val[2], M0, 2);
+			auto const Y = vfmaq_laneq_f32(vfmaq_laneq_f32(vfmaq_laneq_f32(vdupq_laneq_f32(M1, 3), P.val[0], M1, 0), P.val[1], M1, 1), P.val[2], M1, 2);
+			auto const Z = vfmaq_laneq_f32(vfmaq_laneq_f32(vfmaq_laneq_f32(vdupq_laneq_f32(M2, 3), P.val[0], M2, 0), P.val[1], M2, 1), P.val[2], M2, 2);
+			auto const W = vfmaq_laneq_f32(vfmaq_laneq_f32(vfmaq_laneq_f32(vdupq_laneq_f32(M3, 3), P.val[0], M3, 0), P.val[1], M3, 1), P.val[2], M3, 2);
+
+			//
+			// outcodes
+			//
+
+			auto const V = vnegq_f32(W);
+			auto const C = vorrq_u32(vorrq_u32(vorrq_u32(vandq_u32(vcltq_f32(X, V), vdupq_n_u32(clip_left)),
+								     vandq_u32(vcgtq_f32(X, W), vdupq_n_u32(clip_right))),
+							   vorrq_u32(vandq_u32(vcltq_f32(Y, V), vdupq_n_u32(clip_bottom)),
+								     vandq_u32(vcgtq_f32(Y, W), vdupq_n_u32(clip_top)))),
+						 vorrq_u32(vandq_u32(vcltq_f32(Z, nil), vdupq_n_u32(clip_near)),
+							   vandq_u32(vcgtq_f32(Z, W), vdupq_n_u32(clip_far))));
+
+			if (flags)
+			{
+				auto const B = vmovn_u16(vcombine_u16(vmovn_u32(C), vmovn_u32(C)));
+
+				vst1_lane_u32(reinterpret_cast<std::uint32_t *>(flags + i), vreinterpret_u32_u8(B), 0);
+			}
+
+			auto const bits = vaddvq_u32(vandq_u32(vceqzq_u32(C), bit));
+
+			for (auto l = 0; l < 4; l++)
+			{
+				if (visible)
+				{
+					visible[k] = std::uint32_t(i + l);
+				}
+
+				k += (bits >> l) & 1;
+			}
+
+			if (clip)
+			{
+				vst4q_f32(clip[i].data, (float32x4x4_t{{X, Y, Z, W}}));
+			}
+
+			if (ndc || screen)
+			{
+				auto const Q = _rcp_nr_ps(W);
+				auto const a = vmulq_f32(X, Q);
+				auto const b = vmulq_f32(Y, Q);
+				auto const c = vmulq_f32(Z, Q);
+
+				if (screen)
+				{
+					vst3q_f32(screen[i].data, (float32x4x3_t{{vfmaq_f32(ox, a, hw), vfmsq_f32(oy, b, hh), c}}));
+				}
+
+				if (ndc)
+				{
+					vst3q_f32(ndc[i].data, (float32x4x3_t{{a, b, c}}));
+				}
+			}
+		}
+
+		if (i < n)
+		{
+			auto const j = k;
+
+			k += micro::math::project_batch<float>(clip ? clip + i : nullptr,
+							       ndc ? ndc + i : nullptr,
+							       screen ? screen + i : nullptr,
+							       flags ? flags + i : nullptr,
+							       m, v, src + i, n - i,
+							       visible ? visible + j : nullptr);
+
+			for (auto l = j; visible && l < k; l++)
+			{
+				visible[l] += std::uint32_t(i);
+			}
+		}
+
+		return k;
 	}
+}
 
+// ------------------------------------------------------------------------- //
+
+namespace micro::math::simd
+{
 	/**
-	 * @brief Multiply a row from A matrix with all rows of B matrix
-	 *
-	 * @param r A matrix row
-	 * @param a B matrix 1st-row
-	 * @param b B matrix 2nd-row
-	 * @param c B matrix 3rd-row
-	 * @param d B matrix 4th-row
-	 *
-	 * @return r.x * a + r.y * b + r.z * c + r.w * d
+	 * @brief Rotation-scale part of four TRS matrices in SoA form, m[r * 4 + c]
+	 *        holds element (r, c), column 3 is left to the caller
 	 */
-	inline float32x4_t __vectorcall _m4x4_mul_ps(float32x4_t const r,
-						     float32x4_t const a,
-						     float32x4_t const b,
-						     float32x4_t const c,
-						     float32x4_t const d) noexcept
+	inline void __vectorcall _trs_soa_ps(float32x4_t m[16],
+					     float32x4_t const qx, float32x4_t const qy, float32x4_t const qz, float32x4_t const qw,
+					     float32x4_t const sx, float32x4_t const sy, float32x4_t const sz) noexcept
 	{
-		const auto A = vmulq_laneq_f32(a, r, 0);
-		const auto B = vmulq_laneq_f32(b, r, 1);
-		const auto C = vmulq_laneq_f32(c, r, 2);
-		const auto D = vmulq_laneq_f32(d, r, 3);
-		const auto E = vaddq_f32(A, C);
-		const auto F = vaddq_f32(B, D);
-		const auto G = vaddq_f32(E, F);
+		auto const one = vdupq_n_f32(1.f);
 
-		return G;
+		auto const x = vaddq_f32(qx, qx);
+		auto const y = vaddq_f32(qy, qy);
+		auto const z = vaddq_f32(qz, qz);
+		auto const a = vmulq_f32(qx, x);
+		auto const b = vmulq_f32(qy, y);
+		auto const c = vmulq_f32(qz, z);
+		auto const d = vmulq_f32(qx, y);
+		auto const e = vmulq_f32(qx, z);
+		auto const f = vmulq_f32(qy, z);
+		auto const g = vmulq_f32(qw, x);
+		auto const h = vmulq_f32(qw, y);
+		auto const i = vmulq_f32(qw, z);
+
+		m[0] = vmulq_f32(vsubq_f32(vsubq_f32(one, b), c), sx);
+		m[1] = vmulq_f32(vsubq_f32(d, i), sy);
+		m[2] = vmulq_f32(vaddq_f32(e, h), sz);
+		m[4] = vmulq_f32(vaddq_f32(d, i), sx);
+		m[5] = vmulq_f32(vsubq_f32(vsubq_f32(one, a), c), sy);
+		m[6] = vmulq_f32(vsubq_f32(f, g), sz);
+		m[8] = vmulq_f32(vsubq_f32(e, h), sx);
+		m[9] = vmulq_f32(vaddq_f32(f, g), sy);
+		m[10] = vmulq_f32(vsubq_f32(vsubq_f32(one, a), b), sz);
 	}
 
-	inline TMatrix4x4<float> operator*(TMatrix4x4<float> const &a,
-					   TMatrix4x4<float> const &b) noexcept
+	inline void trs_batch(TMatrix4x4<float> *dst,
+			      TVector3SoA<float const> const &t,
+			      TVector4SoA<float const> const &q,
+			      TVector3SoA<float const> const &s, std::size_t n) noexcept
 	{
-		TVector4<float> _0;
-		TVector4<float> _1;
-		TVector4<float> _2;
-		TVector4<float> _3;
+		std::size_t i = 0;
 
-		auto const A0 = vld1q_f32(a.data[0].data);
-		auto const A1 = vld1q_f32(a.data[1].data);
-		auto const A2 = vld1q_f32(a.data[2].data);
-		auto const A3 = vld1q_f32(a.data[3].data);
-		auto const B0 = vld1q_f32(b.data[0].data);
-		auto const B1 = vld1q_f32(b.data[1].data);
-		auto const B2 = vld1q_f32(b.data[2].data);
-		auto const B3 = vld1q_f32(b.data[3].data);
+		for (; i + 4 <= n; i += 4)
+		{
+			float32x4_t m[16];
 
-		vst1q_f32(_0.data, _m4x4_mul_ps(A0, B0, B1, B2, B3));
-		vst1q_f32(_1.data, _m4x4_mul_ps(A1, B0, B1, B2, B3));
-		vst1q_f32(_2.data, _m4x4_mul_ps(A2, B0, B1, B2, B3));
-		vst1q_f32(_3.data, _m4x4_mul_ps(A3, B0, B1, B2, B3));
+			_trs_soa_ps(m,
+				    vld1q_f32(q.x() + i), vld1q_f32(q.y() + i), vld1q_f32(q.z() + i), vld1q_f32(q.w() + i),
+				    vld1q_f32(s.x() + i), vld1q_f32(s.y() + i), vld1q_f32(s.z() + i));
 
-		return {_0, _1, _2, _3};
+			m[3] = vld1q_f32(t.x() + i);
+			m[7] = vld1q_f32(t.y() + i);
+			m[11] = vld1q_f32(t.z() + i);
+			m[12] = vdupq_n_f32(0.f);
+			m[13] = vdupq_n_f32(0.f);
+			m[14] = vdupq_n_f32(0.f);
+			m[15] = vdupq_n_f32(1.f);
+
+			_store4x4_soa_ps(dst + i, m);
+		}
+
+		if (i < n)
+		{
+			micro::math::trs_batch<float>(dst + i,
+						      TVector3SoA<float const>{{t.x() + i, t.y() + i, t.z() + i}},
+						      TVector4SoA<float const>{{q.x() + i, q.y() + i, q.z() + i, q.w() + i}},
+						      TVector3SoA<float const>{{s.x() + i, s.y() + i, s.z() + i}}, n - i);
+		}
 	}
 
-	// ----------------------------------------------------------------- //
+	inline void trs_batch(TMatrix3x4<float> *dst,
+			      TVector3SoA<float const> const &t,
+			      TVector4SoA<float const> const &q,
+			      TVector3SoA<float const> const &s, std::size_t n) noexcept
+	{
+		std::size_t i = 0;
 
-	inline TMatrix4x4<float> __vectorcall transpose(TMatrix4x4<float> const &m) noexcept
+		for (; i + 4 <= n; i += 4)
+		{
+			float32x4_t m[16];
+
+			_trs_soa_ps(m,
+				    vld1q_f32(q.x() + i), vld1q_f32(q.y() + i), vld1q_f32(q.z() + i), vld1q_f32(q.w() + i),
+				    vld1q_f32(s.x() + i), vld1q_f32(s.y() + i), vld1q_f32(s.z() + i));
+
+			m[3] = vld1q_f32(t.x() + i);
+			m[7] = vld1q_f32(t.y() + i);
+			m[11] = vld1q_f32(t.z() + i);
+
+			for (auto r = 0; r < 3; r++)
+			{
+				float32x4x4_t const R = {m[r * 4 + 0], m[r * 4 + 1], m[r * 4 + 2], m[r * 4 + 3]};
+
+				vst4q_lane_f32(dst[i + 0].data[r].data, R, 0);
+				vst4q_lane_f32(dst[i + 1].data[r].data, R, 1);
+				vst4q_lane_f32(dst[i + 2].data[r].data, R, 2);
+				vst4q_lane_f32(dst[i + 3].data[r].data, R, 3);
+			}
+		}
+
+		if (i < n)
+		{
+			micro::math::trs_batch<float>(dst + i,
+						      TVector3SoA<float const>{{t.x() + i, t.y() + i, t.z() + i}},
+						      TVector4SoA<float const>{{q.x() + i, q.y() + i, q.z() + i, q.w() + i}},
+						      TVector3SoA<float const>{{s.x() + i, s.y() + i, s.z() + i}}, n - i);
+		}
+	}
+}
+
+// ------------------------------------------------------------------------- //
+
+#include <libmath/origin.hh>
+
+namespace micro::math::simd
+{
+	inline void rebase_batch(TVector3<float> *dst,
+				 TVector3<double> const *src,
+				 TVector3<double> const &origin, std::size_t n) noexcept
 	{
-		TVector4<float> _0;
-		TVector4<float> _1;
-		TVector4<float> _2;
-		TVector4<float> _3;
+		float64x2_t const O0 = {origin.x(), origin.y()};
+		float64x2_t const O1 = {origin.z(), 0.};
 
-		float32x4x4_t const l_matrix = {vld1q_f32(m.data[0].data),
-						vld1q_f32(m.data[1].data),
-						vld1q_f32(m.data[2].data),
-						vld1q_f32(m.data[3].data)};
+		for (std::size_t i = 0; i < n; i++)
+		{
+			auto const A = vcvt_f32_f64(vsubq_f64(vld1q_f64(src[i].data), O0));		   // xy
+			auto const Z = vcombine_f64(vld1_f64(src[i].data + 2), vdup_n_f64(0.)); // z0
 
-		vst4q_lane_f32(_0.data, l_matrix, 0);
-		vst4q_lane_f32(_1.data, l_matrix, 1);
-		vst4q_lane_f32(_2.data, l_matrix, 2);
-		vst4q_lane_f32(_3.data, l_matrix, 3);
+			_store3_ps(dst[i], vcvt_high_f32_f64(A, vsubq_f64(Z, O1)));
+		}
+	}
 
-		return {_0, _1, _2, _3};
+	inline void rebase_batch(TMatrix3x4<float> *dst,
+				 TMatrix3x4<double> const *src,
+				 TVector3<double> const &origin, std::size_t n) noexcept
+	{
+		float64x2_t const O[3] = {{0., origin.x()},
+					  {0., origin.y()},
+					  {0., origin.z()}};
+
+		for (std::size_t i = 0; i < n; i++)
+		{
+			for (int r = 0; r < 3; r++)
+			{
+				auto const A = vcvt_f32_f64(vld1q_f64(src[i].data[r].data + 0));
+				auto const B = vcvt_high_f32_f64(A, vsubq_f64(vld1q_f64(src[i].data[r].data + 2), O[r]));
+
+				vst1q_f32(dst[i].data[r].data, B);
+			}
+		}
 	}
+}
 
-	// ----------------------------------------------------------------- //
+// ------------------------------------------------------------------------- //
 
-	inline void __vectorcall storea(float dst[4][4], TMatrix4x4<float> const &src) noexcept
+namespace micro::math::simd
+{
+	inline void cast_batch(double *dst, float const *src, std::size_t n) noexcept
 	{
-		float32x4x4_t const l_matrix = {vld1q_f32(src.data[0].data),
-						vld1q_f32(src.data[1].data),
-						vld1q_f32(src.data[2].data),
-						vld1q_f32(src.data[3].data)};
+		std::size_t i = 0;
 
-		vst1q_f32_x4(dst[0], l_matrix);
+		for (; i + 4 <= n; i += 4)
+		{
+			auto const A = vld1q_f32(src + i);
+
+			vst1q_f64(dst + i + 0, vcvt_f64_f32(vget_low_f32(A)));
+			vst1q_f64(dst + i + 2, vcvt_high_f64_f32(A));
+		}
+
+		micro::math::cast_batch(dst + i, src + i, n - i);
 	}
 
-	// ---------------------------- Aliases ---------------------------- //
+	inline void cast_batch(float *dst, double const *src, std::size_t n) noexcept
+	{
+		std::size_t i = 0;
 
-	constexpr auto storeu = storea;
-	constexpr auto stream = storea;
+		for (; i + 4 <= n; i += 4)
+		{
+			auto const A = vcvt_f32_f64(vld1q_f64(src + i + 0));
+
+			vst1q_f32(dst + i, vcvt_high_f32_f64(A, vld1q_f64(src + i + 2)));
+		}
+
+		micro::math::cast_batch(dst + i, src + i, n - i);
+	}
+
+	inline void cast_batch(float *dst, std::int32_t const *src, std::size_t n) noexcept
+	{
+		std::size_t i = 0;
+
+		for (; i + 4 <= n; i += 4)
+		{
+			vst1q_f32(dst + i, vcvtq_f32_s32(vld1q_s32(src + i)));
+		}
+
+		micro::math::cast_batch(dst + i, src + i, n - i);
+	}
+
+	inline void cast_batch(std::int32_t *dst, float const *src, std::size_t n) noexcept
+	{
+		std::size_t i = 0;
+
+		for (; i + 4 <= n; i += 4)
+		{
+			vst1q_s32(dst + i, vcvtq_s32_f32(vld1q_f32(src + i)));
+		}
+
+		micro::math::cast_batch(dst + i, src + i, n - i);
+	}
+
+	/**
+	 * @brief Vector and matrix spans, converted as one run of scalars
+	 *        through the kernels above (or the generic one for the other
+	 *        type pairs), @see micro::math::cast_batch
+	 */
+	template <template <class, class...> class S, class U, class T, class... A>
+	inline void cast_batch(S<U, A...> *dst, S<T, A...> const *src, std::size_t n) noexcept
+	{
+		using micro::math::cast_batch;
+		using micro::math::simd::cast_batch;
+
+		constexpr auto N = sizeof(S<U, A...>) / sizeof(U);
+
+		static_assert(sizeof(S<U, A...>) == N * sizeof(U) && sizeof(S<T, A...>) == N * sizeof(T), "padded types");
+		static_assert(std::is_standard_layout_v<S<U, A...>> && std::is_standard_layout_v<S<T, A...>>);
+
+		cast_batch(reinterpret_cast<U *>(dst), reinterpret_cast<T const *>(src), n * N);
+	}
+}
+
+// ------------------------------------------------------------------------- //
+
+#include <libmath/serialize.hh>
+
+namespace micro::math::simd
+{
+	inline std::size_t serialize_quantized(std::uint8_t *dst, float const *src, std::size_t n, float lo, float hi) noexcept
+	{
+		auto const L = vdupq_n_f32(lo);
+		auto const S = vdupq_n_f32(65535.f / (hi - lo));
+		auto const M = vdupq_n_f32(65535.f);
+		auto const nil = vdupq_n_f32(0.f);
+
+		std::size_t i = 0;
+
+		for (; i + 8 <= n; i += 8)
+		{
+			auto const X = vmulq_f32(vsubq_f32(vld1q_f32(src + i + 0), L), S);
+			auto const Y = vmulq_f32(vsubq_f32(vld1q_f32(src + i + 4), L), S);
+			auto const A = vqmovn_u32(vcvtnq_u32_f32(vminq_f32(vmaxq_f32(X, nil), M)));
+			auto const C = vqmovn_u32(vcvtnq_u32_f32(vminq_f32(vmaxq_f32(Y, nil), M)));
+
+			vst1q_u8(dst + i * 2, vreinterpretq_u8_u16(vcombine_u16(A, C)));
+		}
+
+		if (i + 4 <= n)
+		{
+			auto const X = vmulq_f32(vsubq_f32(vld1q_f32(src + i), L), S);
+
+			vst1_u8(dst + i * 2, vreinterpret_u8_u16(vqmovn_u32(vcvtnq_u32_f32(vminq_f32(vmaxq_f32(X, nil), M)))));
+
+			i += 4;
+		}
+
+		return micro::math::serialize_quantized(dst + i * 2, src + i, n - i, lo, hi) + i * 2;
+	}
+
+	inline std::size_t deserialize_quantized(float *dst, std::uint8_t const *src, std::size_t n, float lo, float hi) noexcept
+	{
+		auto const L = vdupq_n_f32(lo);
+		auto const S = vdupq_n_f32((hi - lo) / 65535.f);
+
+		std::size_t i = 0;
+
+		for (; i + 8 <= n; i += 8)
+		{
+			auto const Q = vreinterpretq_u16_u8(vld1q_u8(src + i * 2));
+			auto const A = vcvtq_f32_u32(vmovl_u16(vget_low_u16(Q)));
+			auto const B = vcvtq_f32_u32(vmovl_u16(vget_high_u16(Q)));
+
+			vst1q_f32(dst + i + 0, vaddq_f32(vmulq_f32(A, S), L));
+			vst1q_f32(dst + i + 4, vaddq_f32(vmulq_f32(B, S), L));
+		}
+
+		if (i + 4 <= n)
+		{
+			auto const Q = vreinterpret_u16_u8(vld1_u8(src + i * 2));
+
+			vst1q_f32(dst + i, vaddq_f32(vmulq_f32(vcvtq_f32_u32(vmovl_u16(Q)), S), L));
+
+			i += 4;
+		}
+
+		return micro::math::deserialize_quantized(dst + i, src + i * 2, n - i, lo, hi) + i * 2;
+	}
+
+	/**
+	 * @brief Vectors and matrices, one run of n times their scalar count
+	 *        through the kernels above, @see micro::math::serialize_quantized
+	 */
+	template <template <class, class...> class S, class... A>
+	inline std::size_t serialize_quantized(std::uint8_t *dst, S<float, A...> const *src, std::size_t n, float lo, float hi) noexcept
+	{
+		static_assert(std::is_standard_layout_v<S<float, A...>>);
+
+		return serialize_quantized(dst, reinterpret_cast<float const *>(src), n * TSerialShape<S<float, A...>>::count, lo, hi);
+	}
+
+	template <template <class, class...> class S, class... A>
+	inline std::size_t deserialize_quantized(S<float, A...> *dst, std::uint8_t const *src, std::size_t n, float lo, float hi) noexcept
+	{
+		static_assert(std::is_standard_layout_v<S<float, A...>>);
+
+		return deserialize_quantized(reinterpret_cast<float *>(dst), src, n * TSerialShape<S<float, A...>>::count, lo, hi);
+	}
+}
+// ------------------------------------------------------------------------- //
+
+#include <libmath/animation.hh>
+
+namespace micro::math::simd
+{
+	inline void interpolate_batch(TVector3SoA<float> const &dst,
+				      TAnimationKeys<float> const &k, float t, std::size_t n) noexcept
+	{
+		auto const x = vdupq_n_f32(t);
+		auto const nil = vdupq_n_f32(0.f);
+		auto const one = vdupq_n_f32(1.f);
+
+		std::size_t i = 0;
+
+		for (; i + 4 <= n; i += 4)
+		{
+			auto const a = vminq_f32(vmaxq_f32(vmulq_f32(vsubq_f32(x, vld1q_f32(k.time + i)), vld1q_f32(k.rate + i)), nil), one);
+
+			for (auto j = 0; j < 3; j++)
+			{
+				vst1q_f32(dst.data[j] + i, vaddq_f32(vld1q_f32(k.value[j] + i), vmulq_f32(vld1q_f32(k.delta[j] + i), a)));
+			}
+		}
+
+		if (i < n)
+		{
+			micro::math::interpolate_batch<float>(TVector3SoA<float>{{dst.x() + i, dst.y() + i, dst.z() + i}}, k + i, t, n - i);
+		}
+	}
+
+	inline void nlerp_batch(TVector4SoA<float> const &dst,
+				TAnimationKeys<float> const &k, float t, std::size_t n) noexcept
+	{
+		auto const x = vdupq_n_f32(t);
+		auto const nil = vdupq_n_f32(0.f);
+		auto const one = vdupq_n_f32(1.f);
+
+		std::size_t i = 0;
+
+		for (; i + 4 <= n; i += 4)
+		{
+			auto const a = vminq_f32(vmaxq_f32(vmulq_f32(vsubq_f32(x, vld1q_f32(k.time + i)), vld1q_f32(k.rate + i)), nil), one);
+
+			float32x4_t q[4];
+
+			for (auto j = 0; j < 4; j++)
+			{
+				q[j] = vaddq_f32(vld1q_f32(k.value[j] + i), vmulq_f32(vld1q_f32(k.delta[j] + i), a));
+			}
+
+			auto const l = vsqrtq_f32(vaddq_f32(vaddq_f32(vmulq_f32(q[0], q[0]), vmulq_f32(q[1], q[1])),
+							    vaddq_f32(vmulq_f32(q[2], q[2]), vmulq_f32(q[3], q[3]))));
+
+			for (auto j = 0; j < 4; j++)
+			{
+				vst1q_f32(dst.data[j] + i, vdivq_f32(q[j], l));
+			}
+		}
+
+		if (i < n)
+		{
+			micro::math::nlerp_batch<float>(TVector4SoA<float>{{dst.x() + i, dst.y() + i, dst.z() + i, dst.w() + i}}, k + i, t, n - i);
+		}
+	}
+
+	/**
+	 * @brief sample_clip over the kernels above and trs_batch
+	 */
+	template <class M>
+	inline void sample_clip(M *dst, TAnimationCursor<float> &c, float t) noexcept
+	{
+		auto const n = c.bones();
+		auto const &p = c;
+
+		c.seek(t);
+
+		interpolate_batch(c.translation(), c.keys(animation_translation), t, n);
+		nlerp_batch(c.rotation(), c.keys(animation_rotation), t, n);
+		interpolate_batch(c.scale(), c.keys(animation_scale), t, n);
+
+		trs_batch(dst, p.translation(), p.rotation(), p.scale(), n);
+	}
 }
 
 #endif
\ No newline at end of file
@@ -1,288 +1,535 @@
-#ifndef MICRO_LIBMATH_SIMD_SSE_HH__GUARD
-#define MICRO_LIBMATH_SIMD_SSE_HH__GUARD
+#ifndef MICRO_LIBMATH_SIMD_AVX_HH__GUARD
+#define MICRO_LIBMATH_SIMD_AVX_HH__GUARD
 
+#include <cmath>
+#include <cstddef>
 #include <immintrin.h>
 
-#include <libmath/vector2.hh>
-#include <libmath/vector3.hh>
-#include <libmath/vector4.hh>
+#include <libmath/batch.hh>
+#include <libmath/simd/sse.hh>
 
 #ifndef _MSC_VER
 #	define __vectorcall
 #endif
 
+//
+// 256-bit kernels on top of sse.hh, which includes this header by itself
+// when __AVX__ is defined. Doubles get one register per TVector3/TVector4
+// and float SoA batches run 8 lanes wide.
+//
+
 namespace micro::math::simd
 {
-	inline TVector2<double> __vectorcall operator+(TVector2<double> const &a,
-						       TVector2<double> const &b) noexcept
+	/**
+	 * @brief Loads the xyz components of a TVector3<double>, w is 0
+	 */
+	inline __m256d __vectorcall _load3_pd(TVector3<double> const &v) noexcept
 	{
-		alignas(alignof(__m128)) TVector2<double> r;
+		auto const A = _mm_loadu_pd(v.data);	// xy
+		auto const B = _mm_load_sd(v.data + 2); // z0
 
-		auto const A = _mm_loadu_pd(a.data);
-		auto const B = _mm_loadu_pd(b.data);
+		return _mm256_insertf128_pd(_mm256_castpd128_pd256(A), B, 1);
+	}
 
-		_mm_store_pd(r.data, _mm_add_pd(A, B));
+	inline void __vectorcall _store3_pd(TVector3<double> &v, __m256d const r) noexcept
+	{
+		_mm_storeu_pd(v.data, _mm256_castpd256_pd128(r));
+		_mm_store_sd(v.data + 2, _mm256_extractf128_pd(r, 1));
+	}
 
-		return r;
+	/**
+	 * @return (z, x, y, w), AVX has no single cross-lane permute for doubles
+	 */
+	inline __m256d __vectorcall _zxy_pd(__m256d const v) noexcept
+	{
+		auto const T = _mm256_permute2f128_pd(v, v, 0x01); // z w x y
+
+		return _mm256_shuffle_pd(T, v, 0b1100);
 	}
 
-	inline TVector2<double> __vectorcall operator-(TVector2<double> const &a,
-						       TVector2<double> const &b) noexcept
+	/**
+	 * @brief Cross product of the xyz lanes, a ^ b = (a.zxy * b - a * b.zxy).zxy
+	 *
+	 * @return a ^ b, w is 0
+	 */
+	inline __m256d __vectorcall _cross_pd(__m256d const a,
+					      __m256d const b) noexcept
 	{
-		alignas(alignof(__m128)) TVector2<double> r;
+		auto const A = _mm256_mul_pd(_zxy_pd(a), b);
+		auto const B = _mm256_mul_pd(a, _zxy_pd(b));
+
+		return _zxy_pd(_mm256_sub_pd(A, B));
+	}
+
+	/**
+	 * @return the sum of the four lanes of a * b in every lane
+	 */
+	inline __m256d __vectorcall _dot4_pd(__m256d const a,
+					     __m256d const b) noexcept
+	{
+		auto const P = _mm256_mul_pd(a, b);
+		auto const H = _mm256_hadd_pd(P, P); // x+y x+y z+w z+w
+
+		return _mm256_add_pd(H, _mm256_permute2f128_pd(H, H, 0x01));
+	}
+
+	/**
+	 * @return the lane sums of a, b, c and d, in that order
+	 */
+	inline __m256d __vectorcall _hsum4_pd(__m256d const a,
+					      __m256d const b,
+					      __m256d const c,
+					      __m256d const d) noexcept
+	{
+		auto const A = _mm256_hadd_pd(a, b); // a01 b01 a23 b23
+		auto const B = _mm256_hadd_pd(c, d); // c01 d01 c23 d23
+		auto const C = _mm256_permute2f128_pd(A, B, 0x21);
+		auto const D = _mm256_blend_pd(A, B, 0b1100);
+
+		return _mm256_add_pd(C, D);
+	}
+
+	// ----------------------------------------------------------------- //
 
-		auto const A = _mm_loadu_pd(a.data);
-		auto const B = _mm_loadu_pd(b.data);
+	inline TVector3<double> __vectorcall operator+(TVector3<double> const &a,
+						       TVector3<double> const &b) noexcept
+	{
+		TVector3<double> r;
 
-		_mm_store_pd(r.data, _mm_sub_pd(A, B));
+		_store3_pd(r, _mm256_add_pd(_load3_pd(a), _load3_pd(b)));
 
 		return r;
 	}
 
-	inline TVector2<double> __vectorcall operator*(TVector2<double> const &a,
-						       TVector2<double> const &b) noexcept
+	inline TVector3<double> __vectorcall operator-(TVector3<double> const &a,
+						       TVector3<double> const &b) noexcept
 	{
-		alignas(alignof(__m128)) TVector2<double> r;
+		TVector3<double> r;
+
+		_store3_pd(r, _mm256_sub_pd(_load3_pd(a), _load3_pd(b)));
+
+		return r;
+	}
 
-		auto const A = _mm_loadu_pd(a.data);
-		auto const B = _mm_loadu_pd(b.data);
+	inline TVector3<double> __vectorcall operator*(TVector3<double> const &a,
+						       TVector3<double> const &b) noexcept
+	{
+		TVector3<double> r;
 
-		_mm_store_pd(r.data, _mm_mul_pd(A, B));
+		_store3_pd(r, _mm256_mul_pd(_load3_pd(a), _load3_pd(b)));
 
 		return r;
 	}
 
-	inline TVector2<double> __vectorcall operator/(TVector2<double> a,
-						       TVector2<double> b) noexcept
+	inline TVector3<double> __vectorcall operator/(TVector3<double> const &a,
+						       TVector3<double> const &b) noexcept
 	{
-		alignas(alignof(__m128)) TVector2<double> r;
+		TVector3<double> r;
 
-		auto const A = _mm_loadu_pd(a.data);
-		auto const B = _mm_loadu_pd(b.data);
+		auto const A = _load3_pd(a);
+		auto const B = _mm256_blend_pd(_load3_pd(b), _mm256_set1_pd(1.), 0b1000); // no 0 / 0 in w
 
-		_mm_store_pd(r.data, _mm_div_pd(A, B));
+		_store3_pd(r, _mm256_div_pd(A, B));
 
 		return r;
 	}
 
-	inline TVector3<float> __vectorcall operator^(TVector3<float> const &a,
-						      TVector3<float> const &b) noexcept
+	inline TVector3<double> __vectorcall operator^(TVector3<double> const &a,
+						       TVector3<double> const &b) noexcept
 	{
-		alignas(alignof(__m128)) float l[4] = {a.y(), a.z(), a.x(), a.x()};
-		alignas(alignof(__m128)) float r[4] = {b.x(), b.y(), b.z(), b.z()};
-		alignas(alignof(__m128)) float o[4];
+		TVector3<double> r;
 
-		auto const A = _mm_load_ps(l);
-		auto const B = _mm_load_ps(r);
-		auto const D = _mm_shuffle_ps(B, B, _MM_SHUFFLE(1, 1, 0, 2));
-		auto const E = _mm_mul_ps(A, B);
-		auto const F = _mm_mul_ps(A, D);
-		auto const G = _mm_shuffle_ps(E, E, _MM_SHUFFLE(0, 0, 2, 1));
+		_store3_pd(r, _cross_pd(_load3_pd(a), _load3_pd(b)));
 
-		_mm_store_ps(o, _mm_sub_ps(F, G));
+		return r;
+	}
 
-		return {o[0], o[1], o[2]};
+	inline double __vectorcall dot(TVector3<double> const &a,
+				       TVector3<double> const &b) noexcept
+	{
+		return _mm256_cvtsd_f64(_dot4_pd(_load3_pd(a), _load3_pd(b)));
 	}
 
 	// ----------------------------------------------------------------- //
 
-	inline float __vectorcall dot(TVector3<float> const &a,
-				      TVector3<float> const &b) noexcept
+	inline TVector4<double> __vectorcall operator+(TVector4<double> const &a,
+						       TVector4<double> const &b) noexcept
 	{
-		alignas(alignof(__m128)) float l[4] = {a.x(), a.y(), a.z(), a.z()};
-		alignas(alignof(__m128)) float r[4] = {b.x(), b.y(), b.z(), b.z()};
+		TVector4<double> r;
 
-		auto const A = _mm_load_ps(l);
-		auto const B = _mm_load_ps(r);
-		auto const C = _mm_mul_ps(A, B);
-		auto const D = _mm_shuffle_ps(C, C, _MM_SHUFFLE(0, 0, 0, 1)); // D = C.y
-		auto const E = _mm_shuffle_ps(C, C, _MM_SHUFFLE(0, 0, 0, 2)); // E = C.z
-		auto const F = _mm_add_ss(C, D);			      // F = C + D
-		auto const G = _mm_add_ss(F, E);			      // G = F + E = C + D + E
+		_mm256_storeu_pd(r.data, _mm256_add_pd(_mm256_loadu_pd(a.data), _mm256_loadu_pd(b.data)));
 
-		return _mm_cvtss_f32(G);
+		return r;
 	}
 
-	inline TVector4<float> __vectorcall operator+(TVector4<float> const &a,
-						      TVector4<float> const &b) noexcept
+	inline TVector4<double> __vectorcall operator-(TVector4<double> const &a,
+						       TVector4<double> const &b) noexcept
 	{
-		alignas(alignof(__m128)) TVector4<float> r;
-
-		auto const A = _mm_loadu_ps(a.data);
-		auto const B = _mm_loadu_ps(b.data);
+		TVector4<double> r;
 
-		_mm_store_ps(r.data, _mm_add_ps(A, B));
+		_mm256_storeu_pd(r.data, _mm256_sub_pd(_mm256_loadu_pd(a.data), _mm256_loadu_pd(b.data)));
 
 		return r;
 	}
 
-	inline TVector4<float> __vectorcall operator-(TVector4<float> const &a,
-						      TVector4<float> const &b) noexcept
+	inline TVector4<double> __vectorcall operator*(TVector4<double> const &a,
+						       TVector4<double> const &b) noexcept
 	{
-		alignas(alignof(__m128)) TVector4<float> r;
+		TVector4<double> r;
+
+		_mm256_storeu_pd(r.data, _mm256_mul_pd(_mm256_loadu_pd(a.data), _mm256_loadu_pd(b.data)));
 
-		auto const A = _mm_loadu_ps(a.data);
-		auto const B = _mm_loadu_ps(b.data);
+		return r;
+	}
+
+	inline TVector4<double> __vectorcall operator/(TVector4<double> const &a,
+						       TVector4<double> const &b) noexcept
+	{
+		TVector4<double> r;
 
-		_mm_store_ps(r.data, _mm_sub_ps(A, B));
+		_mm256_storeu_pd(r.data, _mm256_div_pd(_mm256_loadu_pd(a.data), _mm256_loadu_pd(b.data)));
 
 		return r;
 	}
 
-	inline TVector4<float> __vectorcall operator*(TVector4<float> const &a,
-						      TVector4<float> const &b) noexcept
+	inline double __vectorcall dot(TVector4<double> const &a,
+				       TVector4<double> const &b) noexcept
 	{
-		alignas(alignof(__m128)) TVector4<float> r;
+		return _mm256_cvtsd_f64(_dot4_pd(_mm256_loadu_pd(a.data), _mm256_loadu_pd(b.data)));
+	}
+
+	// ---------------------------- Aligned ---------------------------- //
 
-		auto const A = _mm_loadu_ps(a.data);
-		auto const B = _mm_loadu_ps(b.data);
+	inline TVector4A<double> __vectorcall operator+(TVector4A<double> const &a,
+							TVector4A<double> const &b) noexcept
+	{
+		TVector4A<double> r;
 
-		_mm_store_ps(r.data, _mm_mul_ps(A, B));
+		_mm256_store_pd(r.data, _mm256_add_pd(_mm256_load_pd(a.data), _mm256_load_pd(b.data)));
 
 		return r;
 	}
 
-	inline TVector4<float> __vectorcall operator/(TVector4<float> const &a,
-						      TVector4<float> const &b) noexcept
+	inline TVector4A<double> __vectorcall operator-(TVector4A<double> const &a,
+							TVector4A<double> const &b) noexcept
 	{
-		alignas(alignof(__m128)) TVector4<float> r;
+		TVector4A<double> r;
+
+		_mm256_store_pd(r.data, _mm256_sub_pd(_mm256_load_pd(a.data), _mm256_load_pd(b.data)));
+
+		return r;
+	}
 
-		auto const A = _mm_loadu_ps(a.data);
-		auto const B = _mm_loadu_ps(b.data);
+	inline TVector4A<double> __vectorcall operator*(TVector4A<double> const &a,
+							TVector4A<double> const &b) noexcept
+	{
+		TVector4A<double> r;
 
-		_mm_store_ps(r.data, _mm_div_ps(A, B));
+		_mm256_store_pd(r.data, _mm256_mul_pd(_mm256_load_pd(a.data), _mm256_load_pd(b.data)));
 
 		return r;
 	}
 
-	// ----------------------------------------------------------------- //
+	inline TVector4A<double> __vectorcall operator/(TVector4A<double> const &a,
+							TVector4A<double> const &b) noexcept
+	{
+		TVector4A<double> r;
 
-	inline TVector4<double> __vectorcall operator+(TVector4<double> const &a,
-						       TVector4<double> const &b) noexcept
+		_mm256_store_pd(r.data, _mm256_div_pd(_mm256_load_pd(a.data), _mm256_load_pd(b.data)));
+
+		return r;
+	}
+}
+
+// ------------------------------------------------------------------------- //
+
+namespace micro::math::simd
+{
+	inline TMatrix3x3<double> operator*(TMatrix3x3<double> const &a,
+					    TMatrix3x3<double> const &b) noexcept
 	{
-		alignas(alignof(__m128)) TVector4<double> r;
+		TMatrix3x3<double> r;
 
-		auto const A = _mm_loadu_pd(a.data + 0);
-		auto const B = _mm_loadu_pd(b.data + 0);
-		auto const C = _mm_loadu_pd(a.data + 2);
-		auto const D = _mm_loadu_pd(b.data + 2);
+		auto const B0 = _load3_pd(b.data[0]);
+		auto const B1 = _load3_pd(b.data[1]);
+		auto const B2 = _load3_pd(b.data[2]);
 
-		_mm_store_pd(r.data + 0, _mm_add_pd(A, B));
-		_mm_store_pd(r.data + 2, _mm_add_pd(C, D));
+		for (auto i = 0; i < 3; i++)
+		{
+			auto const A = _mm256_mul_pd(_mm256_broadcast_sd(a.data[i].data + 0), B0);
+			auto const B = _mm256_mul_pd(_mm256_broadcast_sd(a.data[i].data + 1), B1);
+			auto const C = _mm256_mul_pd(_mm256_broadcast_sd(a.data[i].data + 2), B2);
+
+			_store3_pd(r.data[i], _mm256_add_pd(_mm256_add_pd(A, C), B));
+		}
 
 		return r;
 	}
 
-	inline TVector4<double> __vectorcall operator-(TVector4<double> const &a,
-						       TVector4<double> const &b) noexcept
+	inline TVector3<double> __vectorcall operator*(TMatrix3x3<double> const &m,
+						       TVector3<double> const &v) noexcept
 	{
-		alignas(alignof(__m128)) TVector4<double> r;
+		auto const V = _load3_pd(v);
+		auto const X = _mm256_mul_pd(_load3_pd(m.data[0]), V);
+		auto const Y = _mm256_mul_pd(_load3_pd(m.data[1]), V);
+		auto const Z = _mm256_mul_pd(_load3_pd(m.data[2]), V);
 
-		auto const A = _mm_loadu_pd(a.data + 0);
-		auto const B = _mm_loadu_pd(b.data + 0);
-		auto const C = _mm_loadu_pd(a.data + 2);
-		auto const D = _mm_loadu_pd(b.data + 2);
+		TVector3<double> r;
 
-		_mm_store_pd(r.data + 0, _mm_sub_pd(A, B));
-		_mm_store_pd(r.data + 2, _mm_sub_pd(C, D));
+		_store3_pd(r, _hsum4_pd(X, Y, Z, Z));
 
 		return r;
 	}
 
-	inline TVector4<double> __vectorcall operator*(TVector4<double> const &a,
-						       TVector4<double> const &b) noexcept
+	inline TVector3<double> __vectorcall operator*(TMatrix3x4<double> const &m,
+						       TVector4<double> const &v) noexcept
 	{
-		alignas(alignof(__m128)) TVector4<double> r;
+		auto const V = _mm256_loadu_pd(v.data);
+		auto const X = _mm256_mul_pd(_mm256_loadu_pd(m.data[0].data), V);
+		auto const Y = _mm256_mul_pd(_mm256_loadu_pd(m.data[1].data), V);
+		auto const Z = _mm256_mul_pd(_mm256_loadu_pd(m.data[2].data), V);
 
-		auto const A = _mm_loadu_pd(a.data + 0);
-		auto const B = _mm_loadu_pd(b.data + 0);
-		auto const C = _mm_loadu_pd(a.data + 2);
-		auto const D = _mm_loadu_pd(b.data + 2);
+		TVector3<double> r;
 
-		_mm_storeu_pd(r.data + 0, _mm_mul_pd(A, B));
-		_mm_storeu_pd(r.data + 2, _mm_mul_pd(C, D));
+		_store3_pd(r, _hsum4_pd(X, Y, Z, Z));
 
 		return r;
 	}
 
-	inline TVector4<double> __vectorcall operator/(TVector4<double> const &a,
-						       TVector4<double> const &b) noexcept
+	inline TMatrix3x4<double> operator*(TMatrix3x4<double> const &a,
+					    TMatrix4x4<double> const &b) noexcept
 	{
-		alignas(alignof(__m128)) TVector4<double> r;
+		TMatrix3x4<double> r;
 
-		auto const A = _mm_loadu_pd(a.data + 0);
-		auto const B = _mm_loadu_pd(b.data + 0);
-		auto const C = _mm_loadu_pd(a.data + 2);
-		auto const D = _mm_loadu_pd(b.data + 2);
+		auto const B0 = _mm256_loadu_pd(b.data[0].data);
+		auto const B1 = _mm256_loadu_pd(b.data[1].data);
+		auto const B2 = _mm256_loadu_pd(b.data[2].data);
+		auto const B3 = _mm256_loadu_pd(b.data[3].data);
 
-		_mm_store_pd(r.data + 0, _mm_div_pd(A, B));
-		_mm_store_pd(r.data + 2, _mm_div_pd(C, D));
+		_mm256_storeu_pd(r.data[0].data, _m4x4_mul_pd(_mm256_loadu_pd(a.data[0].data), B0, B1, B2, B3));
+		_mm256_storeu_pd(r.data[1].data, _m4x4_mul_pd(_mm256_loadu_pd(a.data[1].data), B0, B1, B2, B3));
+		_mm256_storeu_pd(r.data[2].data, _m4x4_mul_pd(_mm256_loadu_pd(a.data[2].data), B0, B1, B2, B3));
 
 		return r;
 	}
-}
 
-// ------------------------------------------------------------------------- //
+	inline TMatrix3x4<double> compose3x4(TMatrix3x4<double> const &a,
+					     TMatrix3x4<double> const &b) noexcept
+	{
+		TMatrix3x4<double> r;
 
-#include <libmath/matrix2x2.hh>
-#include <libmath/matrix3x3.hh>
-#include <libmath/matrix4x4.hh>
+		_multiply_batch(&r, &a, 0, &b, 0, 1);
+
+		return r;
+	}
+
+	// ----------------------------- 4 x 4 ----------------------------- //
 
-namespace micro::math::simd
-{
 	/**
-	 * @brief Multiply a row from A matrix with all rows of B matrix
+	 * @brief Cross product form of the 4x4 inverse
 	 *
-	 * @param r A matrix row
-	 * @param a B matrix 1st-row
-	 * @param b B matrix 2nd-row
-	 * @param c B matrix 3rd-row
-	 * @param d B matrix 4th-row
+	 * With a, b, c, d the upper three rows of the columns and x, y, z, w the
+	 * last row, s = a ^ b, t = c ^ d, u = y a - x b and v = w c - z d give
+	 * det = s . v + t . u and the rows of the adjoint below.
 	 */
-	inline __m256d __vectorcall _m4x4_mul_pd(__m256d const r,
-						 __m256d const a,
-						 __m256d const b,
-						 __m256d const c,
-						 __m256d const d) noexcept
-	{
-		const auto A = _mm256_permute2f128_pd(r, r, 0b00'00); // X
-		const auto B = _mm256_permute2f128_pd(r, r, 0b01'01); // Y
-		const auto C = _mm256_permute2f128_pd(r, r, 0b10'10); // Z
-		const auto D = _mm256_permute2f128_pd(r, r, 0b11'11); // W
-		const auto E = _mm256_mul_pd(A, a);		      // X * a
-		const auto F = _mm256_mul_pd(B, b);		      // Y * b
-		const auto G = _mm256_mul_pd(C, c);		      // Z * c
-		const auto H = _mm256_mul_pd(D, d);		      // W * d
-		const auto I = _mm256_add_pd(E, G);		      // X * a + Z * c
-		const auto J = _mm256_add_pd(F, H);		      // Y * b + W * d
-		const auto K = _mm256_add_pd(I, J);		      // X * a + Z * c + Y * b + W * d
-
-		return K;
-	}
-
-	inline TMatrix4x4<double> operator*(TMatrix4x4<double> const &a,
-					    TMatrix4x4<double> const &b) noexcept
+	inline __m256d __vectorcall _m4x4_stuv_pd(TMatrix4x4<double> const &m,
+						  __m256d c[4], __m256d k[4]) noexcept
 	{
-		alignas(alignof(__m128)) TVector4<double> _0;
-		alignas(alignof(__m128)) TVector4<double> _1;
-		alignas(alignof(__m128)) TVector4<double> _2;
-		alignas(alignof(__m128)) TVector4<double> _3;
+		auto const nil = _mm256_setzero_pd();
+
+		auto const A = _mm256_loadu_pd(m.data[0].data);
+		auto const B = _mm256_loadu_pd(m.data[1].data);
+		auto const C = _mm256_loadu_pd(m.data[2].data);
+		auto const E = _mm256_unpacklo_pd(A, B);
+		auto const F = _mm256_unpackhi_pd(A, B);
+		auto const G = _mm256_unpacklo_pd(C, nil);
+		auto const H = _mm256_unpackhi_pd(C, nil);
+
+		c[0] = _mm256_permute2f128_pd(E, G, 0x20); // a
+		c[1] = _mm256_permute2f128_pd(F, H, 0x20); // b
+		c[2] = _mm256_permute2f128_pd(E, G, 0x31); // c
+		c[3] = _mm256_permute2f128_pd(F, H, 0x31); // d
+
+		auto const x = _mm256_broadcast_sd(m.data[3].data + 0);
+		auto const y = _mm256_broadcast_sd(m.data[3].data + 1);
+		auto const z = _mm256_broadcast_sd(m.data[3].data + 2);
+		auto const w = _mm256_broadcast_sd(m.data[3].data + 3);
+
+		k[0] = _cross_pd(c[0], c[1]);							  // s
+		k[1] = _cross_pd(c[2], c[3]);							  // t
+		k[2] = _mm256_sub_pd(_mm256_mul_pd(c[0], y), _mm256_mul_pd(c[1], x)); // u
+		k[3] = _mm256_sub_pd(_mm256_mul_pd(c[2], w), _mm256_mul_pd(c[3], z)); // v
+
+		return _mm256_add_pd(_dot4_pd(k[0], k[3]), _dot4_pd(k[1], k[2]));
+	}
 
-		auto const A0 = _mm256_loadu_pd(a.data[0].data);
-		auto const A1 = _mm256_loadu_pd(a.data[1].data);
-		auto const A2 = _mm256_loadu_pd(a.data[2].data);
-		auto const A3 = _mm256_loadu_pd(a.data[3].data);
-		auto const B0 = _mm256_loadu_pd(b.data[0].data);
-		auto const B1 = _mm256_loadu_pd(b.data[1].data);
-		auto const B2 = _mm256_loadu_pd(b.data[2].data);
-		auto const B3 = _mm256_loadu_pd(b.data[3].data);
+	inline double __vectorcall det(TMatrix4x4<double> const &m) noexcept
+	{
+		__m256d c[4];
+		__m256d k[4];
+
+		return _mm256_cvtsd_f64(_m4x4_stuv_pd(m, c, k));
+	}
+
+	inline TMatrix4x4<double> __vectorcall inverse(TMatrix4x4<double> const &m) noexcept
+	{
+		TMatrix4x4<double> r;
 
-		_mm256_store_pd(_0.data, _m4x4_mul_pd(A0, B0, B1, B2, B3));
-		_mm256_store_pd(_1.data, _m4x4_mul_pd(A1, B0, B1, B2, B3));
-		_mm256_store_pd(_2.data, _m4x4_mul_pd(A2, B0, B1, B2, B3));
-		_mm256_store_pd(_3.data, _m4x4_mul_pd(A3, B0, B1, B2, B3));
+		__m256d c[4];
+		__m256d k[4];
 
-		return {_0, _1, _2, _3};
+		auto const D = _mm256_div_pd(_mm256_set1_pd(1.), _m4x4_stuv_pd(m, c, k));
+
+		auto const s = _mm256_mul_pd(k[0], D);
+		auto const t = _mm256_mul_pd(k[1], D);
+		auto const u = _mm256_mul_pd(k[2], D);
+		auto const v = _mm256_mul_pd(k[3], D);
+
+		auto const x = _mm256_broadcast_sd(m.data[3].data + 0);
+		auto const y = _mm256_broadcast_sd(m.data[3].data + 1);
+		auto const z = _mm256_broadcast_sd(m.data[3].data + 2);
+		auto const w = _mm256_broadcast_sd(m.data[3].data + 3);
+		auto const n = _mm256_set1_pd(-0.);
+
+		auto const R0 = _mm256_add_pd(_cross_pd(c[1], v), _mm256_mul_pd(t, y));
+		auto const R1 = _mm256_sub_pd(_cross_pd(v, c[0]), _mm256_mul_pd(t, x));
+		auto const R2 = _mm256_add_pd(_cross_pd(c[3], u), _mm256_mul_pd(s, w));
+		auto const R3 = _mm256_sub_pd(_cross_pd(u, c[2]), _mm256_mul_pd(s, z));
+
+		_mm256_storeu_pd(r.data[0].data, _mm256_blend_pd(R0, _mm256_xor_pd(_dot4_pd(c[1], t), n), 0b1000));
+		_mm256_storeu_pd(r.data[1].data, _mm256_blend_pd(R1, _dot4_pd(c[0], t), 0b1000));
+		_mm256_storeu_pd(r.data[2].data, _mm256_blend_pd(R2, _mm256_xor_pd(_dot4_pd(c[3], s), n), 0b1000));
+		_mm256_storeu_pd(r.data[3].data, _mm256_blend_pd(R3, _dot4_pd(c[2], s), 0b1000));
+
+		return r;
+	}
+
+	inline TVector4<double> __vectorcall operator*(TMatrix4x4<double> const &m,
+						       TVector4<double> const &v) noexcept
+	{
+		TVector4<double> r;
+
+		auto const V = _mm256_loadu_pd(v.data);
+		auto const X = _mm256_mul_pd(_mm256_loadu_pd(m.data[0].data), V);
+		auto const Y = _mm256_mul_pd(_mm256_loadu_pd(m.data[1].data), V);
+		auto const Z = _mm256_mul_pd(_mm256_loadu_pd(m.data[2].data), V);
+		auto const W = _mm256_mul_pd(_mm256_loadu_pd(m.data[3].data), V);
+
+		_mm256_storeu_pd(r.data, _hsum4_pd(X, Y, Z, W));
+
+		return r;
+	}
+
+	inline __m256d __vectorcall _fms_pd(__m256d const a,
+					    __m256d const b,
+					    __m256d const c,
+					    __m256d const d) noexcept
+	{
+		return _mm256_sub_pd(_mm256_mul_pd(a, b), _mm256_mul_pd(c, d));
+	}
+
+	/**
+	 * @return a * x - b * y + c * z
+	 */
+	inline __m256d __vectorcall _m3_pd(__m256d const a, __m256d const x,
+					   __m256d const b, __m256d const y,
+					   __m256d const c, __m256d const z) noexcept
+	{
+		return _mm256_add_pd(_mm256_sub_pd(_mm256_mul_pd(a, x), _mm256_mul_pd(b, y)), _mm256_mul_pd(c, z));
+	}
+
+	/**
+	 * @brief 2x2 minors of the upper (s) and lower (c) two rows, @see _m4x4_minors_ps
+	 */
+	inline __m256d __vectorcall _m4x4_minors_pd(__m256d const m[16], __m256d s[6], __m256d c[6]) noexcept
+	{
+		s[0] = _fms_pd(m[0], m[5], m[4], m[1]);
+		s[1] = _fms_pd(m[0], m[6], m[4], m[2]);
+		s[2] = _fms_pd(m[0], m[7], m[4], m[3]);
+		s[3] = _fms_pd(m[1], m[6], m[5], m[2]);
+		s[4] = _fms_pd(m[1], m[7], m[5], m[3]);
+		s[5] = _fms_pd(m[2], m[7], m[6], m[3]);
+		c[0] = _fms_pd(m[8], m[13], m[12], m[9]);
+		c[1] = _fms_pd(m[8], m[14], m[12], m[10]);
+		c[2] = _fms_pd(m[8], m[15], m[12], m[11]);
+		c[3] = _fms_pd(m[9], m[14], m[13], m[10]);
+		c[4] = _fms_pd(m[9], m[15], m[13], m[11]);
+		c[5] = _fms_pd(m[10], m[15], m[14], m[11]);
+
+		auto const A = _fms_pd(s[0], c[5], s[1], c[4]);
+		auto const B = _mm256_add_pd(_mm256_mul_pd(s[2], c[3]), _mm256_mul_pd(s[3], c[2]));
+		auto const C = _fms_pd(s[5], c[0], s[4], c[1]);
+
+		return _mm256_add_pd(_mm256_add_pd(A, C), B);
+	}
+
+	inline void det_batch(double *dst,
+			      TMatrix4x4<double> const *src, std::size_t n) noexcept
+	{
+		std::size_t i = 0;
+
+		for (; i + 4 <= n; i += 4)
+		{
+			__m256d m[16];
+			__m256d s[6];
+			__m256d c[6];
+
+			_load4x4_soa_pd(src + i, m);
+			_mm256_storeu_pd(dst + i, _m4x4_minors_pd(m, s, c));
+		}
+
+		micro::math::det_batch<double>(dst + i, src + i, n - i);
+	}
+
+	inline void inverse_batch(TMatrix4x4<double> *dst,
+				  TMatrix4x4<double> const *src, std::size_t n, bool *singular = nullptr) noexcept
+	{
+		std::size_t i = 0;
+
+		for (; i + 4 <= n; i += 4)
+		{
+			__m256d m[16];
+			__m256d r[16];
+			__m256d s[6];
+			__m256d c[6];
+
+			_load4x4_soa_pd(src + i, m);
+
+			auto const D = _m4x4_minors_pd(m, s, c);
+			auto const R = _mm256_div_pd(_mm256_set1_pd(1.), D);
+			auto const N = _mm256_sub_pd(_mm256_setzero_pd(), R);
+
+			if (singular)
+			{
+				auto const mask = _mm256_movemask_pd(_mm256_cmp_pd(D, _mm256_setzero_pd(), _CMP_EQ_OQ));
+
+				singular[i + 0] = (mask & 1) != 0;
+				singular[i + 1] = (mask & 2) != 0;
+				singular[i + 2] = (mask & 4) != 0;
+				singular[i + 3] = (mask & 8) != 0;
+			}
+
+			r[0] = _mm256_mul_pd(_m3_pd(m[5], c[5], m[6], c[4], m[7], c[3]), R);
+			r[1] = _mm256_mul_pd(_m3_pd(m[1], c[5], m[2], c[4], m[3], c[3]), N);
+			r[2] = _mm256_mul_pd(_m3_pd(m[13], s[5], m[14], s[4], m[15], s[3]), R);
+			r[3] = _mm256_mul_pd(_m3_pd(m[9], s[5], m[10], s[4], m[11], s[3]), N);
+			r[4] = _mm256_mul_pd(_m3_pd(m[4], c[5], m[6], c[2], m[7], c[1]), N);
+			r[5] = _mm256_mul_pd(_m3_pd(m[0], c[5], m[2], c[2], m[3], c[1]), R);
+			r[6] = _mm256_mul_pd(_m3_pd(m[12], s[5], m[14], s[2], m[15], s[1]), N);
+			r[7] = _mm256_mul_pd(_m3_pd(m[8], s[5], m[10], s[2], m[11], s[1]), R);
+			r[8] = _mm256_mul_pd(_m3_pd(m[4], c[4], m[5], c[2], m[7], c[0]), R);
+			r[9] = _mm256_mul_pd(_m3_pd(m[0], c[4], m[1], c[2], m[3], c[0]), N);
+			r[10] = _mm256_mul_pd(_m3_pd(m[12], s[4], m[13], s[2], m[15], s[0]), R);
+			r[11] = _mm256_mul_pd(_m3_pd(m[8], s[4], m[9], s[2], m[11], s[0]), N);
+			r[12] = _mm256_mul_pd(_m3_pd(m[4], c[3], m[5], c[1], m[6], c[0]), N);
+			r[13] = _mm256_mul_pd(_m3_pd(m[0], c[3], m[1], c[1], m[2], c[0]), R);
+			r[14] = _mm256_mul_pd(_m3_pd(m[12], s[3], m[13], s[1], m[14], s[0]), N);
+			r[15] = _mm256_mul_pd(_m3_pd(m[8], s[3], m[9], s[1], m[10], s[0]), R);
+
+			_store4x4_soa_pd(dst + i, r);
+		}
+
+		micro::math::inverse_batch<double>(dst + i, src + i, n - i, singular ? singular + i : nullptr);
 	}
 
 	// ----------------------------------------------------------------- //
@@ -310,6 +557,225 @@ namespace micro::math::simd
 		_mm256_stream_pd(dst[2], _mm256_loadu_pd(src.data[2].data));
 		_mm256_stream_pd(dst[3], _mm256_loadu_pd(src.data[3].data));
 	}
+
+	inline void __vectorcall storeu(double dst[4][4], TMatrix4x4A<double> const &src) noexcept
+	{
+		_mm256_storeu_pd(dst[0], _mm256_load_pd(src.data[0].data));
+		_mm256_storeu_pd(dst[1], _mm256_load_pd(src.data[1].data));
+		_mm256_storeu_pd(dst[2], _mm256_load_pd(src.data[2].data));
+		_mm256_storeu_pd(dst[3], _mm256_load_pd(src.data[3].data));
+	}
+
+	inline void __vectorcall storea(double dst[4][4], TMatrix4x4A<double> const &src) noexcept
+	{
+		_mm256_store_pd(dst[0], _mm256_load_pd(src.data[0].data));
+		_mm256_store_pd(dst[1], _mm256_load_pd(src.data[1].data));
+		_mm256_store_pd(dst[2], _mm256_load_pd(src.data[2].data));
+		_mm256_store_pd(dst[3], _mm256_load_pd(src.data[3].data));
+	}
+
+	inline void __vectorcall stream(double dst[4][4], TMatrix4x4A<double> const &src) noexcept
+	{
+		_mm256_stream_pd(dst[0], _mm256_load_pd(src.data[0].data));
+		_mm256_stream_pd(dst[1], _mm256_load_pd(src.data[1].data));
+		_mm256_stream_pd(dst[2], _mm256_load_pd(src.data[2].data));
+		_mm256_stream_pd(dst[3], _mm256_load_pd(src.data[3].data));
+	}
+
+	// ----------------------------------------------------------------- //
+
+	/**
+	 * @brief Writes n vectors with non-temporal stores, the source is
+	 *        prefetched ahead as non-temporal too, so neither side of the
+	 *        copy stays in the cache hierarchy
+	 *
+	 * @param dst destination, 32 bytes aligned
+	 * @param src source vectors
+	 * @param n   vector count
+	 */
+	inline void stream_batch(double (*dst)[4], TVector4<double> const *src, std::size_t n) noexcept
+	{
+		constexpr std::size_t ahead = 8;
+
+		for (std::size_t i = 0; i < n; i++)
+		{
+			if (i + ahead < n)
+			{
+				_mm_prefetch(reinterpret_cast<char const *>(src + i + ahead) + 0x00, _MM_HINT_NTA);
+				_mm_prefetch(reinterpret_cast<char const *>(src + i + ahead) + sizeof(TVector4<double>) - 1, _MM_HINT_NTA);
+			}
+
+			_mm256_stream_pd(dst[i], _mm256_loadu_pd(src[i].data));
+		}
+
+		_mm_sfence();
+	}
+
+	/**
+	 * @brief Writes n matrices with non-temporal stores, @see stream_batch
+	 *
+	 * @param dst destination, 32 bytes aligned
+	 * @param src source matrices
+	 * @param n   matrix count
+	 */
+	inline void stream_batch(double (*dst)[4][4], TMatrix4x4<double> const *src, std::size_t n) noexcept
+	{
+		constexpr std::size_t ahead = 2;
+
+		for (std::size_t i = 0; i < n; i++)
+		{
+			if (i + ahead < n)
+			{
+				_mm_prefetch(reinterpret_cast<char const *>(src + i + ahead) + 0x00, _MM_HINT_NTA);
+				_mm_prefetch(reinterpret_cast<char const *>(src + i + ahead) + 0x40, _MM_HINT_NTA);
+				_mm_prefetch(reinterpret_cast<char const *>(src + i + ahead) + sizeof(TMatrix4x4<double>) - 1, _MM_HINT_NTA);
+			}
+
+			stream(dst[i], src[i]);
+		}
+
+		_mm_sfence();
+	}
+
+	inline void stream_batch(double (*dst)[4][4], TMatrix4x4A<double> const *src, std::size_t n) noexcept
+	{
+		constexpr std::size_t ahead = 2;
+
+		for (std::size_t i = 0; i < n; i++)
+		{
+			if (i + ahead < n)
+			{
+				_mm_prefetch(reinterpret_cast<char const *>(src + i + ahead) + 0x00, _MM_HINT_NTA);
+				_mm_prefetch(reinterpret_cast<char const *>(src + i + ahead) + 0x40, _MM_HINT_NTA);
+			}
+
+			stream(dst[i], src[i]);
+		}
+
+		_mm_sfence();
+	}
+}
+
+// ------------------------------------------------------------------------- //
+
+namespace micro::math::simd
+{
+	inline void dot_batch(float *dst,
+			      TVector3SoA<float const> const &a,
+			      TVector3SoA<float const> const &b, std::size_t n) noexcept
+	{
+		std::size_t i = 0;
+
+		for (; i + 8 <= n; i += 8)
+		{
+			auto const X = _mm256_mul_ps(_mm256_loadu_ps(a.x() + i), _mm256_loadu_ps(b.x() + i));
+			auto const Y = _mm256_mul_ps(_mm256_loadu_ps(a.y() + i), _mm256_loadu_ps(b.y() + i));
+			auto const Z = _mm256_mul_ps(_mm256_loadu_ps(a.z() + i), _mm256_loadu_ps(b.z() + i));
+
+			_mm256_storeu_ps(dst + i, _mm256_add_ps(_mm256_add_ps(X, Y), Z));
+		}
+
+		micro::math::dot_batch<float>(dst + i,
+					      TVector3SoA<float const>{{a.x() + i, a.y() + i, a.z() + i}},
+					      TVector3SoA<float const>{{b.x() + i, b.y() + i, b.z() + i}}, n - i);
+	}
+
+	inline void normalize_batch(TVector3SoA<float> const &dst,
+				    TVector3SoA<float const> const &src, std::size_t n) noexcept
+	{
+		std::size_t i = 0;
+
+		for (; i + 8 <= n; i += 8)
+		{
+			auto const X = _mm256_loadu_ps(src.x() + i);
+			auto const Y = _mm256_loadu_ps(src.y() + i);
+			auto const Z = _mm256_loadu_ps(src.z() + i);
+			auto const L = _mm256_sqrt_ps(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(X, X), _mm256_mul_ps(Y, Y)), _mm256_mul_ps(Z, Z)));
+
+			_mm256_storeu_ps(dst.x() + i, _mm256_div_ps(X, L));
+			_mm256_storeu_ps(dst.y() + i, _mm256_div_ps(Y, L));
+			_mm256_storeu_ps(dst.z() + i, _mm256_div_ps(Z, L));
+		}
+
+		micro::math::normalize_batch<float>(TVector3SoA<float>{{dst.x() + i, dst.y() + i, dst.z() + i}},
+						    TVector3SoA<float const>{{src.x() + i, src.y() + i, src.z() + i}}, n - i);
+	}
+
+	inline void dot_batch(double *dst,
+			      TVector3SoA<double const> const &a,
+			      TVector3SoA<double const> const &b, std::size_t n) noexcept
+	{
+		std::size_t i = 0;
+
+		for (; i + 4 <= n; i += 4)
+		{
+			auto const X = _mm256_mul_pd(_mm256_loadu_pd(a.x() + i), _mm256_loadu_pd(b.x() + i));
+			auto const Y = _mm256_mul_pd(_mm256_loadu_pd(a.y() + i), _mm256_loadu_pd(b.y() + i));
+			auto const Z = _mm256_mul_pd(_mm256_loadu_pd(a.z() + i), _mm256_loadu_pd(b.z() + i));
+
+			_mm256_storeu_pd(dst + i, _mm256_add_pd(_mm256_add_pd(X, Y), Z));
+		}
+
+		micro::math::dot_batch<double>(dst + i,
+					       TVector3SoA<double const>{{a.x() + i, a.y() + i, a.z() + i}},
+					       TVector3SoA<double const>{{b.x() + i, b.y() + i, b.z() + i}}, n - i);
+	}
+
+	inline void normalize_batch(TVector3SoA<double> const &dst,
+				    TVector3SoA<double const> const &src, std::size_t n) noexcept
+	{
+		std::size_t i = 0;
+
+		for (; i + 4 <= n; i += 4)
+		{
+			auto const X = _mm256_loadu_pd(src.x() + i);
+			auto const Y = _mm256_loadu_pd(src.y() + i);
+			auto const Z = _mm256_loadu_pd(src.z() + i);
+			auto const L = _mm256_sqrt_pd(_mm256_add_pd(_mm256_add_pd(_mm256_mul_pd(X, X), _mm256_mul_pd(Y, Y)), _mm256_mul_pd(Z, Z)));
+
+			_mm256_storeu_pd(dst.x() + i, _mm256_div_pd(X, L));
+			_mm256_storeu_pd(dst.y() + i, _mm256_div_pd(Y, L));
+			_mm256_storeu_pd(dst.z() + i, _mm256_div_pd(Z, L));
+		}
+
+		micro::math::normalize_batch<double>(TVector3SoA<double>{{dst.x() + i, dst.y() + i, dst.z() + i}},
+						     TVector3SoA<double const>{{src.x() + i, src.y() + i, src.z() + i}}, n - i);
+	}
+}
+
+// ------------------------------------------------------------------------- //
+
+#include <libmath/origin.hh>
+
+namespace micro::math::simd
+{
+	inline void rebase_batch(TVector3<float> *dst,
+				 TVector3<double> const *src,
+				 TVector3<double> const &origin, std::size_t n) noexcept
+	{
+		auto const O = _load3_pd(origin);
+
+		for (std::size_t i = 0; i < n; i++)
+		{
+			_store3_ps(dst[i], _mm256_cvtpd_ps(_mm256_sub_pd(_load3_pd(src[i]), O)));
+		}
+	}
+
+	inline void rebase_batch(TMatrix3x4<float> *dst,
+				 TMatrix3x4<double> const *src,
+				 TVector3<double> const &origin, std::size_t n) noexcept
+	{
+		__m256d const O[3] = {_mm256_setr_pd(0., 0., 0., origin.x()),
+				      _mm256_setr_pd(0., 0., 0., origin.y()),
+				      _mm256_setr_pd(0., 0., 0., origin.z())};
+
+		for (std::size_t i = 0; i < n; i++)
+		{
+			_mm_storeu_ps(dst[i].data[0].data, _mm256_cvtpd_ps(_mm256_sub_pd(_mm256_loadu_pd(src[i].data[0].data), O[0])));
+			_mm_storeu_ps(dst[i].data[1].data, _mm256_cvtpd_ps(_mm256_sub_pd(_mm256_loadu_pd(src[i].data[1].data), O[1])));
+			_mm_storeu_ps(dst[i].data[2].data, _mm256_cvtpd_ps(_mm256_sub_pd(_mm256_loadu_pd(src[i].data[2].data), O[2])));
+		}
+	}
 }
 
 #endif
\ No newline at end of file
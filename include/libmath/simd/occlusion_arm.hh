@@ -0,0 +1,127 @@
+#ifndef MICRO_LIBMATH_SIMD_OCCLUSION_ARM_HH__GUARD
+#define MICRO_LIBMATH_SIMD_OCCLUSION_ARM_HH__GUARD
+
+#include <cstddef>
+#include <arm_neon.h>
+
+#include <libmath/occlusion.hh>
+#include <libmath/simd/arm.hh>
+
+#ifndef _MSC_VER
+#	define __vectorcall
+#endif
+
+//
+// NEON tile rasteriser for occlusion.hh. Kept apart from arm.hh so that
+// only the users of the occlusion buffer pull in <thread> and <atomic>.
+//
+
+namespace micro::math::simd
+{
+	/**
+	 * @return a * b + c, rounded like raster_madd
+	 */
+	inline float32x4_t __vectorcall _raster_madd_ps(float32x4_t const a,
+							float32x4_t const b,
+							float32x4_t const c) noexcept
+	{
+#ifdef MICRO_LIBMATH_OCCLUSION_FMA
+		return vfmaq_f32(c, a, b);
+#else
+		return vaddq_f32(vmulq_f32(a, b), c);
+#endif
+	}
+
+	/**
+	 * @brief Rasterises one half tile row (4 pixels) per 128-bit register
+	 */
+	inline void rasterize_tiles(TOcclusionBuffer<float> &b,
+				    std::size_t first,
+				    std::size_t last) noexcept
+	{
+		alignas(16) static constexpr float lane[4] = {.5f, 1.5f, 2.5f, 3.5f};
+
+		auto const I = vld1q_f32(lane);
+
+		for (auto t = first; t < last; t++)
+		{
+			auto const x0 = float((t % b.tiles_x) * b.tile);
+			auto const y0 = float((t / b.tiles_x) * b.tile) + .5f;
+
+			float32x4_t const PX[2] = {vaddq_f32(vdupq_n_f32(x0), I),
+						   vaddq_f32(vdupq_n_f32(x0 + 4.f), I)};
+
+			auto *d = b.depth.data() + t * b.tile * b.tile;
+
+			for (auto k : b.bins[t])
+			{
+				TEdge<float> e[3];
+				float z[3];
+
+				if (!setup_triangle(e, z, b.triangles.data() + k * 3))
+				{
+					continue;
+				}
+
+				auto const E0 = vdupq_n_f32(e[0].a);
+				auto const E1 = vdupq_n_f32(e[1].a);
+				auto const E2 = vdupq_n_f32(e[2].a);
+				auto const Z0 = vdupq_n_f32(z[0]);
+				auto const Z1 = vdupq_n_f32(z[1]);
+				auto const Z2 = vdupq_n_f32(z[2]);
+
+				for (std::size_t y = 0; y < b.tile; y++)
+				{
+					auto const py = y0 + float(y);
+
+					auto const R0 = vdupq_n_f32(e[0].row(py));
+					auto const R1 = vdupq_n_f32(e[1].row(py));
+					auto const R2 = vdupq_n_f32(e[2].row(py));
+
+					for (auto h = 0; h < 2; h++)
+					{
+						auto const L0 = _raster_madd_ps(E0, PX[h], R0);
+						auto const L1 = _raster_madd_ps(E1, PX[h], R1);
+						auto const L2 = _raster_madd_ps(E2, PX[h], R2);
+
+						auto const M = vandq_u32(vandq_u32(vcgezq_f32(L0), vcgezq_f32(L1)), vcgezq_f32(L2));
+
+						if (vmaxvq_u32(M) == 0)
+						{
+							continue;
+						}
+
+						auto const S = vaddq_f32(Z0, _raster_madd_ps(L2, Z2, vmulq_f32(L1, Z1)));
+						auto const D = vld1q_f32(d + y * b.tile + h * 4);
+
+						vst1q_f32(d + y * b.tile + h * 4, vbslq_f32(M, vminq_f32(S, D), D));
+					}
+				}
+			}
+
+			auto lo = vld1q_f32(d);
+			auto hi = lo;
+
+			for (std::size_t i = 4; i < b.tile * b.tile; i += 4)
+			{
+				auto const D = vld1q_f32(d + i);
+
+				lo = vminq_f32(lo, D);
+				hi = vmaxq_f32(hi, D);
+			}
+
+			b.tile_min[t] = vminvq_f32(lo);
+			b.tile_max[t] = vmaxvq_f32(hi);
+		}
+	}
+
+	inline void rasterize(TOcclusionBuffer<float> &b, unsigned threads = 1)
+	{
+		parallel_tiles(b.tiles(), threads, [&b](std::size_t first, std::size_t last)
+		{
+			rasterize_tiles(b, first, last);
+		});
+	}
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,226 @@
+#ifndef MICRO_LIBMATH_SIMD_OCCLUSION_SSE_HH__GUARD
+#define MICRO_LIBMATH_SIMD_OCCLUSION_SSE_HH__GUARD
+
+#include <cstddef>
+#include <immintrin.h>
+
+#include <libmath/occlusion.hh>
+#include <libmath/simd/sse.hh>
+
+#ifndef _MSC_VER
+#	define __vectorcall
+#endif
+
+//
+// SSE and AVX tile rasterisers for occlusion.hh. Kept apart from sse.hh so
+// that only the users of the occlusion buffer pull in <thread> and <atomic>.
+//
+
+namespace micro::math::simd
+{
+	/**
+	 * @return a * b + c, rounded like raster_madd
+	 */
+	inline __m128 __vectorcall _raster_madd_ps(__m128 const a,
+						   __m128 const b,
+						   __m128 const c) noexcept
+	{
+#ifdef MICRO_LIBMATH_OCCLUSION_FMA
+		return _mm_fmadd_ps(a, b, c);
+#else
+		return _mm_add_ps(_mm_mul_ps(a, b), c);
+#endif
+	}
+
+#ifdef __AVX__
+	inline __m256 __vectorcall _raster_madd_ps(__m256 const a,
+						   __m256 const b,
+						   __m256 const c) noexcept
+	{
+#ifdef MICRO_LIBMATH_OCCLUSION_FMA
+		return _mm256_fmadd_ps(a, b, c);
+#else
+		return _mm256_add_ps(_mm256_mul_ps(a, b), c);
+#endif
+	}
+
+	/**
+	 * @brief Rasterises one 8-pixel tile row per 256-bit register
+	 */
+	inline void rasterize_tiles(TOcclusionBuffer<float> &b,
+				    std::size_t first,
+				    std::size_t last) noexcept
+	{
+		auto const I = _mm256_setr_ps(.5f, 1.5f, 2.5f, 3.5f, 4.5f, 5.5f, 6.5f, 7.5f);
+		auto const nil = _mm256_setzero_ps();
+
+		for (auto t = first; t < last; t++)
+		{
+			auto const x0 = float((t % b.tiles_x) * b.tile);
+			auto const y0 = float((t / b.tiles_x) * b.tile) + .5f;
+			auto const PX = _mm256_add_ps(_mm256_set1_ps(x0), I);
+
+			auto *d = b.depth.data() + t * b.tile * b.tile;
+
+			for (auto k : b.bins[t])
+			{
+				TEdge<float> e[3];
+				float z[3];
+
+				if (!setup_triangle(e, z, b.triangles.data() + k * 3))
+				{
+					continue;
+				}
+
+				auto const E0 = _mm256_set1_ps(e[0].a);
+				auto const E1 = _mm256_set1_ps(e[1].a);
+				auto const E2 = _mm256_set1_ps(e[2].a);
+				auto const Z0 = _mm256_set1_ps(z[0]);
+				auto const Z1 = _mm256_set1_ps(z[1]);
+				auto const Z2 = _mm256_set1_ps(z[2]);
+
+				for (std::size_t y = 0; y < b.tile; y++)
+				{
+					auto const py = y0 + float(y);
+
+					auto const L0 = _raster_madd_ps(E0, PX, _mm256_set1_ps(e[0].row(py)));
+					auto const L1 = _raster_madd_ps(E1, PX, _mm256_set1_ps(e[1].row(py)));
+					auto const L2 = _raster_madd_ps(E2, PX, _mm256_set1_ps(e[2].row(py)));
+
+					auto const M = _mm256_and_ps(_mm256_and_ps(_mm256_cmp_ps(L0, nil, _CMP_GE_OQ),
+										   _mm256_cmp_ps(L1, nil, _CMP_GE_OQ)),
+								     _mm256_cmp_ps(L2, nil, _CMP_GE_OQ));
+
+					if (_mm256_movemask_ps(M) == 0)
+					{
+						continue;
+					}
+
+					auto const S = _mm256_add_ps(Z0, _raster_madd_ps(L2, Z2, _mm256_mul_ps(L1, Z1)));
+					auto const D = _mm256_loadu_ps(d + y * b.tile);
+
+					_mm256_storeu_ps(d + y * b.tile, _mm256_blendv_ps(D, _mm256_min_ps(S, D), M));
+				}
+			}
+
+			auto lo = _mm256_loadu_ps(d);
+			auto hi = lo;
+
+			for (std::size_t y = 1; y < b.tile; y++)
+			{
+				auto const D = _mm256_loadu_ps(d + y * b.tile);
+
+				lo = _mm256_min_ps(lo, D);
+				hi = _mm256_max_ps(hi, D);
+			}
+
+			auto l = _mm_min_ps(_mm256_castps256_ps128(lo), _mm256_extractf128_ps(lo, 1));
+			auto h = _mm_max_ps(_mm256_castps256_ps128(hi), _mm256_extractf128_ps(hi, 1));
+
+			l = _mm_min_ps(l, _mm_movehl_ps(l, l));
+			h = _mm_max_ps(h, _mm_movehl_ps(h, h));
+
+			b.tile_min[t] = _mm_cvtss_f32(_mm_min_ss(l, _mm_shuffle_ps(l, l, 0b01)));
+			b.tile_max[t] = _mm_cvtss_f32(_mm_max_ss(h, _mm_shuffle_ps(h, h, 0b01)));
+		}
+	}
+#else
+	/**
+	 * @brief Rasterises one half tile row (4 pixels) per 128-bit register
+	 */
+	inline void rasterize_tiles(TOcclusionBuffer<float> &b,
+				    std::size_t first,
+				    std::size_t last) noexcept
+	{
+		auto const I = _mm_setr_ps(.5f, 1.5f, 2.5f, 3.5f);
+		auto const nil = _mm_setzero_ps();
+
+		for (auto t = first; t < last; t++)
+		{
+			auto const x0 = float((t % b.tiles_x) * b.tile);
+			auto const y0 = float((t / b.tiles_x) * b.tile) + .5f;
+
+			__m128 const PX[2] = {_mm_add_ps(_mm_set1_ps(x0), I),
+					      _mm_add_ps(_mm_set1_ps(x0 + 4.f), I)};
+
+			auto *d = b.depth.data() + t * b.tile * b.tile;
+
+			for (auto k : b.bins[t])
+			{
+				TEdge<float> e[3];
+				float z[3];
+
+				if (!setup_triangle(e, z, b.triangles.data() + k * 3))
+				{
+					continue;
+				}
+
+				auto const E0 = _mm_set1_ps(e[0].a);
+				auto const E1 = _mm_set1_ps(e[1].a);
+				auto const E2 = _mm_set1_ps(e[2].a);
+				auto const Z0 = _mm_set1_ps(z[0]);
+				auto const Z1 = _mm_set1_ps(z[1]);
+				auto const Z2 = _mm_set1_ps(z[2]);
+
+				for (std::size_t y = 0; y < b.tile; y++)
+				{
+					auto const py = y0 + float(y);
+
+					auto const R0 = _mm_set1_ps(e[0].row(py));
+					auto const R1 = _mm_set1_ps(e[1].row(py));
+					auto const R2 = _mm_set1_ps(e[2].row(py));
+
+					for (auto h = 0; h < 2; h++)
+					{
+						auto const L0 = _raster_madd_ps(E0, PX[h], R0);
+						auto const L1 = _raster_madd_ps(E1, PX[h], R1);
+						auto const L2 = _raster_madd_ps(E2, PX[h], R2);
+
+						auto const M = _mm_and_ps(_mm_and_ps(_mm_cmpge_ps(L0, nil),
+										     _mm_cmpge_ps(L1, nil)),
+									  _mm_cmpge_ps(L2, nil));
+
+						if (_mm_movemask_ps(M) == 0)
+						{
+							continue;
+						}
+
+						auto const S = _mm_add_ps(Z0, _raster_madd_ps(L2, Z2, _mm_mul_ps(L1, Z1)));
+						auto const D = _mm_loadu_ps(d + y * b.tile + h * 4);
+
+						_mm_storeu_ps(d + y * b.tile + h * 4, _mm_or_ps(_mm_and_ps(M, _mm_min_ps(S, D)),
+												_mm_andnot_ps(M, D)));
+					}
+				}
+			}
+
+			auto lo = _mm_loadu_ps(d);
+			auto hi = lo;
+
+			for (std::size_t i = 4; i < b.tile * b.tile; i += 4)
+			{
+				auto const D = _mm_loadu_ps(d + i);
+
+				lo = _mm_min_ps(lo, D);
+				hi = _mm_max_ps(hi, D);
+			}
+
+			lo = _mm_min_ps(lo, _mm_movehl_ps(lo, lo));
+			hi = _mm_max_ps(hi, _mm_movehl_ps(hi, hi));
+
+			b.tile_min[t] = _mm_cvtss_f32(_mm_min_ss(lo, _mm_shuffle_ps(lo, lo, 0b01)));
+			b.tile_max[t] = _mm_cvtss_f32(_mm_max_ss(hi, _mm_shuffle_ps(hi, hi, 0b01)));
+		}
+	}
+#endif
+
+	inline void rasterize(TOcclusionBuffer<float> &b, unsigned threads = 1)
+	{
+		parallel_tiles(b.tiles(), threads, [&b](std::size_t first, std::size_t last)
+		{
+			rasterize_tiles(b, first, last);
+		});
+	}
+}
+
+#endif
\ No newline at end of file
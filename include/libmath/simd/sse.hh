@@ -1,6 +1,9 @@
 #ifndef MICRO_LIBMATH_SIMD_SSE_HH__GUARD
 #define MICRO_LIBMATH_SIMD_SSE_HH__GUARD
 
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
 #include <immintrin.h>
 
 #include <libmath/vector2.hh>
@@ -157,6 +160,7 @@ namespace micro::math::simd
 
 	// ----------------------------------------------------------------- //
 
+#ifndef __AVX__
 	inline TVector4<double> __vectorcall operator+(TVector4<double> const &a,
 						       TVector4<double> const &b) noexcept
 	{
@@ -220,12 +224,134 @@ namespace micro::math::simd
 
 		return r;
 	}
+#endif
+
+	// ---------------------------- Aligned ---------------------------- //
+
+	inline TVector4A<float> __vectorcall operator+(TVector4A<float> const &a,
+						       TVector4A<float> const &b) noexcept
+	{
+		TVector4A<float> r;
+
+		auto const A = _mm_load_ps(a.data);
+		auto const B = _mm_load_ps(b.data);
+
+		_mm_store_ps(r.data, _mm_add_ps(A, B));
+
+		return r;
+	}
+
+	inline TVector4A<float> __vectorcall operator-(TVector4A<float> const &a,
+						       TVector4A<float> const &b) noexcept
+	{
+		TVector4A<float> r;
+
+		auto const A = _mm_load_ps(a.data);
+		auto const B = _mm_load_ps(b.data);
+
+		_mm_store_ps(r.data, _mm_sub_ps(A, B));
+
+		return r;
+	}
+
+	inline TVector4A<float> __vectorcall operator*(TVector4A<float> const &a,
+						       TVector4A<float> const &b) noexcept
+	{
+		TVector4A<float> r;
+
+		auto const A = _mm_load_ps(a.data);
+		auto const B = _mm_load_ps(b.data);
+
+		_mm_store_ps(r.data, _mm_mul_ps(A, B));
+
+		return r;
+	}
+
+	inline TVector4A<float> __vectorcall operator/(TVector4A<float> const &a,
+						       TVector4A<float> const &b) noexcept
+	{
+		TVector4A<float> r;
+
+		auto const A = _mm_load_ps(a.data);
+		auto const B = _mm_load_ps(b.data);
+
+		_mm_store_ps(r.data, _mm_div_ps(A, B));
+
+		return r;
+	}
+
+#ifndef __AVX__
+	inline TVector4A<double> __vectorcall operator+(TVector4A<double> const &a,
+							TVector4A<double> const &b) noexcept
+	{
+		TVector4A<double> r;
+
+		auto const A = _mm_load_pd(a.data + 0);
+		auto const B = _mm_load_pd(b.data + 0);
+		auto const C = _mm_load_pd(a.data + 2);
+		auto const D = _mm_load_pd(b.data + 2);
+
+		_mm_store_pd(r.data + 0, _mm_add_pd(A, B));
+		_mm_store_pd(r.data + 2, _mm_add_pd(C, D));
+
+		return r;
+	}
+
+	inline TVector4A<double> __vectorcall operator-(TVector4A<double> const &a,
+							TVector4A<double> const &b) noexcept
+	{
+		TVector4A<double> r;
+
+		auto const A = _mm_load_pd(a.data + 0);
+		auto const B = _mm_load_pd(b.data + 0);
+		auto const C = _mm_load_pd(a.data + 2);
+		auto const D = _mm_load_pd(b.data + 2);
+
+		_mm_store_pd(r.data + 0, _mm_sub_pd(A, B));
+		_mm_store_pd(r.data + 2, _mm_sub_pd(C, D));
+
+		return r;
+	}
+
+	inline TVector4A<double> __vectorcall operator*(TVector4A<double> const &a,
+							TVector4A<double> const &b) noexcept
+	{
+		TVector4A<double> r;
+
+		auto const A = _mm_load_pd(a.data + 0);
+		auto const B = _mm_load_pd(b.data + 0);
+		auto const C = _mm_load_pd(a.data + 2);
+		auto const D = _mm_load_pd(b.data + 2);
+
+		_mm_store_pd(r.data + 0, _mm_mul_pd(A, B));
+		_mm_store_pd(r.data + 2, _mm_mul_pd(C, D));
+
+		return r;
+	}
+
+	inline TVector4A<double> __vectorcall operator/(TVector4A<double> const &a,
+							TVector4A<double> const &b) noexcept
+	{
+		TVector4A<double> r;
+
+		auto const A = _mm_load_pd(a.data + 0);
+		auto const B = _mm_load_pd(b.data + 0);
+		auto const C = _mm_load_pd(a.data + 2);
+		auto const D = _mm_load_pd(b.data + 2);
+
+		_mm_store_pd(r.data + 0, _mm_div_pd(A, B));
+		_mm_store_pd(r.data + 2, _mm_div_pd(C, D));
+
+		return r;
+	}
+#endif
 }
 
 // ------------------------------------------------------------------------- //
 
 #include <libmath/matrix2x2.hh>
 #include <libmath/matrix3x3.hh>
+#include <libmath/matrix3x4.hh>
 #include <libmath/matrix4x4.hh>
 
 namespace micro::math::simd
@@ -365,6 +491,143 @@ namespace micro::math::simd
 					 _2[0], _2[1], _2[2]};
 	}
 
+	// ----------------------------------------------------------------- //
+
+	/**
+	 * @brief Loads a TVector3<float> as xyz0 without reading past its end
+	 */
+	inline __m128 __vectorcall _load3_ps(TVector3<float> const &v) noexcept
+	{
+		auto const A = _mm_loadl_pi(_mm_setzero_ps(), reinterpret_cast<__m64 const *>(v.data)); // xy00
+		auto const B = _mm_load_ss(v.data + 2);						      // z000
+
+		return _mm_movelh_ps(A, B);
+	}
+
+	/**
+	 * @brief Stores the xyz lanes of r into a TVector3<float>
+	 */
+	inline void __vectorcall _store3_ps(TVector3<float> &v, __m128 const r) noexcept
+	{
+		_mm_storel_pi(reinterpret_cast<__m64 *>(v.data), r);
+		_mm_store_ss(v.data + 2, _mm_movehl_ps(r, r));
+	}
+
+	/**
+	 * @brief Cross product of the xyz lanes
+	 *
+	 * @return a ^ b, w is 0 when a.w and b.w are equal
+	 */
+	inline __m128 __vectorcall _cross_ps(__m128 const a,
+					     __m128 const b) noexcept
+	{
+		auto const A = _mm_shuffle_ps(a, a, _MM_SHUFFLE(3, 0, 2, 1)); // yzx
+		auto const B = _mm_shuffle_ps(b, b, _MM_SHUFFLE(3, 0, 2, 1)); // yzx
+		auto const C = _mm_sub_ps(_mm_mul_ps(a, B), _mm_mul_ps(A, b)); // zxy of a ^ b
+
+		return _mm_shuffle_ps(C, C, _MM_SHUFFLE(3, 0, 2, 1));
+	}
+
+	/**
+	 * @brief Dot product of the xyz lanes
+	 *
+	 * @return a.x * b.x + a.y * b.y + a.z * b.z in every lane
+	 */
+	inline __m128 __vectorcall _dot3_ps(__m128 const a,
+					    __m128 const b) noexcept
+	{
+		auto const C = _mm_mul_ps(a, b);
+		auto const D = _mm_shuffle_ps(C, C, _MM_SHUFFLE(0, 0, 0, 1)); // D = C.y
+		auto const E = _mm_shuffle_ps(C, C, _MM_SHUFFLE(0, 0, 0, 2)); // E = C.z
+		auto const F = _mm_add_ss(_mm_add_ss(C, D), E);
+
+		return _mm_shuffle_ps(F, F, _MM_SHUFFLE(0, 0, 0, 0));
+	}
+
+	/**
+	 * @brief Rows of the cofactor matrix of the 3x3 block with rows a, b, c
+	 *
+	 * The adjoint is the transpose of {b ^ c, c ^ a, a ^ b}, the determinant
+	 * is a . (b ^ c), so both come out of the same three cross products.
+	 */
+	inline void __vectorcall _m3x3_cof_ps(__m128 const a,
+					      __m128 const b,
+					      __m128 const c,
+					      __m128 &r0,
+					      __m128 &r1,
+					      __m128 &r2) noexcept
+	{
+		r0 = _cross_ps(b, c);
+		r1 = _cross_ps(c, a);
+		r2 = _cross_ps(a, b);
+	}
+
+	inline float __vectorcall det(TMatrix3x3<float> const &m) noexcept
+	{
+		auto const A = _load3_ps(m.data[0]);
+		auto const B = _load3_ps(m.data[1]);
+		auto const C = _load3_ps(m.data[2]);
+
+		return _mm_cvtss_f32(_dot3_ps(A, _cross_ps(B, C)));
+	}
+
+	inline TMatrix3x3<float> __vectorcall adjoint(TMatrix3x3<float> const &m) noexcept
+	{
+		TMatrix3x3<float> r;
+
+		__m128 C0, C1, C2, C3 = _mm_setzero_ps();
+
+		_m3x3_cof_ps(_load3_ps(m.data[0]), _load3_ps(m.data[1]), _load3_ps(m.data[2]), C0, C1, C2);
+
+		_MM_TRANSPOSE4_PS(C0, C1, C2, C3);
+
+		_store3_ps(r.data[0], C0);
+		_store3_ps(r.data[1], C1);
+		_store3_ps(r.data[2], C2);
+
+		return r;
+	}
+
+	inline TMatrix3x3<float> __vectorcall inverse(TMatrix3x3<float> const &m) noexcept
+	{
+		TMatrix3x3<float> r;
+
+		__m128 C0, C1, C2, C3 = _mm_setzero_ps();
+
+		auto const A = _load3_ps(m.data[0]);
+
+		_m3x3_cof_ps(A, _load3_ps(m.data[1]), _load3_ps(m.data[2]), C0, C1, C2);
+
+		auto const D = _dot3_ps(A, C0);
+
+		_MM_TRANSPOSE4_PS(C0, C1, C2, C3);
+
+		_store3_ps(r.data[0], _mm_div_ps(C0, D));
+		_store3_ps(r.data[1], _mm_div_ps(C1, D));
+		_store3_ps(r.data[2], _mm_div_ps(C2, D));
+
+		return r;
+	}
+
+	inline TMatrix3x3<float> __vectorcall normal_matrix(TMatrix4x4<float> const &m) noexcept
+	{
+		TMatrix3x3<float> r;
+
+		__m128 C0, C1, C2;
+
+		auto const A = _mm_loadu_ps(m.data[0].data);
+
+		_m3x3_cof_ps(A, _mm_loadu_ps(m.data[1].data), _mm_loadu_ps(m.data[2].data), C0, C1, C2);
+
+		auto const D = _dot3_ps(A, C0);
+
+		_store3_ps(r.data[0], _mm_div_ps(C0, D));
+		_store3_ps(r.data[1], _mm_div_ps(C1, D));
+		_store3_ps(r.data[2], _mm_div_ps(C2, D));
+
+		return r;
+	}
+
 	/**
 	 * @brief Multiply a row from A matrix with all rows of B matrix
 	 *
@@ -420,6 +683,28 @@ namespace micro::math::simd
 		return {_0, _1, _2, _3};
 	}
 
+	inline TMatrix4x4A<float> operator*(TMatrix4x4A<float> const &a,
+					    TMatrix4x4A<float> const &b) noexcept
+	{
+		TMatrix4x4A<float> r;
+
+		auto const A0 = _mm_load_ps(a.data[0].data);
+		auto const A1 = _mm_load_ps(a.data[1].data);
+		auto const A2 = _mm_load_ps(a.data[2].data);
+		auto const A3 = _mm_load_ps(a.data[3].data);
+		auto const B0 = _mm_load_ps(b.data[0].data);
+		auto const B1 = _mm_load_ps(b.data[1].data);
+		auto const B2 = _mm_load_ps(b.data[2].data);
+		auto const B3 = _mm_load_ps(b.data[3].data);
+
+		_mm_store_ps(r.data[0].data, _m4x4_mul_ps(A0, B0, B1, B2, B3));
+		_mm_store_ps(r.data[1].data, _m4x4_mul_ps(A1, B0, B1, B2, B3));
+		_mm_store_ps(r.data[2].data, _m4x4_mul_ps(A2, B0, B1, B2, B3));
+		_mm_store_ps(r.data[3].data, _m4x4_mul_ps(A3, B0, B1, B2, B3));
+
+		return r;
+	}
+
 #ifdef __AVX__
 	/**
 	 * @brief Multiply a row from A matrix with all rows of B matrix
@@ -436,10 +721,12 @@ namespace micro::math::simd
 						 __m256d const c,
 						 __m256d const d) noexcept
 	{
-		const auto A = _mm256_permute2f128_pd(r, r, 0b00'00); // X
-		const auto B = _mm256_permute2f128_pd(r, r, 0b01'01); // Y
-		const auto C = _mm256_permute2f128_pd(r, r, 0b10'10); // Z
-		const auto D = _mm256_permute2f128_pd(r, r, 0b11'11); // W
+		const auto L = _mm256_permute2f128_pd(r, r, 0x00);     // XY XY
+		const auto U = _mm256_permute2f128_pd(r, r, 0x11);     // ZW ZW
+		const auto A = _mm256_permute_pd(L, 0b0000);	      // X
+		const auto B = _mm256_permute_pd(L, 0b1111);	      // Y
+		const auto C = _mm256_permute_pd(U, 0b0000);	      // Z
+		const auto D = _mm256_permute_pd(U, 0b1111);	      // W
 		const auto E = _mm256_mul_pd(A, a);		      // X * a
 		const auto F = _mm256_mul_pd(B, b);		      // Y * b
 		const auto G = _mm256_mul_pd(C, c);		      // Z * c
@@ -475,6 +762,28 @@ namespace micro::math::simd
 
 		return {_0, _1, _2, _3};
 	}
+
+	inline TMatrix4x4A<double> operator*(TMatrix4x4A<double> const &a,
+					     TMatrix4x4A<double> const &b) noexcept
+	{
+		TMatrix4x4A<double> r;
+
+		auto const A0 = _mm256_load_pd(a.data[0].data);
+		auto const A1 = _mm256_load_pd(a.data[1].data);
+		auto const A2 = _mm256_load_pd(a.data[2].data);
+		auto const A3 = _mm256_load_pd(a.data[3].data);
+		auto const B0 = _mm256_load_pd(b.data[0].data);
+		auto const B1 = _mm256_load_pd(b.data[1].data);
+		auto const B2 = _mm256_load_pd(b.data[2].data);
+		auto const B3 = _mm256_load_pd(b.data[3].data);
+
+		_mm256_store_pd(r.data[0].data, _m4x4_mul_pd(A0, B0, B1, B2, B3));
+		_mm256_store_pd(r.data[1].data, _m4x4_mul_pd(A1, B0, B1, B2, B3));
+		_mm256_store_pd(r.data[2].data, _m4x4_mul_pd(A2, B0, B1, B2, B3));
+		_mm256_store_pd(r.data[3].data, _m4x4_mul_pd(A3, B0, B1, B2, B3));
+
+		return r;
+	}
 #endif
 
 	// ----------------------------------------------------------------- //
@@ -503,6 +812,27 @@ namespace micro::math::simd
 		return {_0, _1, _2, _3};
 	}
 
+	inline TMatrix4x4A<float> __vectorcall transpose(TMatrix4x4A<float> const &m) noexcept
+	{
+		TMatrix4x4A<float> r;
+
+		auto const A = _mm_load_ps(m.data[0].data); // A11 A12 A13 A14
+		auto const B = _mm_load_ps(m.data[1].data); // A21 A22 A23 A24
+		auto const C = _mm_load_ps(m.data[2].data); // A31 A32 A33 A34
+		auto const D = _mm_load_ps(m.data[3].data); // A41 A42 A43 A44
+		auto const E = _mm_unpacklo_ps(A, B);	    // A11 A21 A12 A22
+		auto const F = _mm_unpackhi_ps(A, B);	    // A13 A23 A14 A24
+		auto const G = _mm_unpacklo_ps(C, D);	    // A31 A41 A32 A42
+		auto const H = _mm_unpackhi_ps(C, D);	    // A33 A43 A34 A44
+
+		_mm_store_ps(r.data[0].data, _mm_movelh_ps(E, G)); // A11 A21 A31 A41
+		_mm_store_ps(r.data[1].data, _mm_movehl_ps(G, E)); // A12 A22 A32 A42
+		_mm_store_ps(r.data[2].data, _mm_movelh_ps(F, H)); // A13 A23 A33 A43
+		_mm_store_ps(r.data[3].data, _mm_movehl_ps(H, F)); // A14 A24 A34 A44
+
+		return r;
+	}
+
 	// ----------------------------------------------------------------- //
 
 	inline void __vectorcall storeu(float dst[4][4], TMatrix4x4<float> const &src) noexcept
@@ -528,6 +858,3726 @@ namespace micro::math::simd
 		_mm_stream_ps(dst[2], _mm_loadu_ps(src.data[2].data));
 		_mm_stream_ps(dst[3], _mm_loadu_ps(src.data[3].data));
 	}
+
+	inline void __vectorcall storeu(float dst[4][4], TMatrix4x4A<float> const &src) noexcept
+	{
+		_mm_storeu_ps(dst[0], _mm_load_ps(src.data[0].data));
+		_mm_storeu_ps(dst[1], _mm_load_ps(src.data[1].data));
+		_mm_storeu_ps(dst[2], _mm_load_ps(src.data[2].data));
+		_mm_storeu_ps(dst[3], _mm_load_ps(src.data[3].data));
+	}
+
+	inline void __vectorcall storea(float dst[4][4], TMatrix4x4A<float> const &src) noexcept
+	{
+		_mm_store_ps(dst[0], _mm_load_ps(src.data[0].data));
+		_mm_store_ps(dst[1], _mm_load_ps(src.data[1].data));
+		_mm_store_ps(dst[2], _mm_load_ps(src.data[2].data));
+		_mm_store_ps(dst[3], _mm_load_ps(src.data[3].data));
+	}
+
+	inline void __vectorcall stream(float dst[4][4], TMatrix4x4A<float> const &src) noexcept
+	{
+		_mm_stream_ps(dst[0], _mm_load_ps(src.data[0].data));
+		_mm_stream_ps(dst[1], _mm_load_ps(src.data[1].data));
+		_mm_stream_ps(dst[2], _mm_load_ps(src.data[2].data));
+		_mm_stream_ps(dst[3], _mm_load_ps(src.data[3].data));
+	}
+
+	// ----------------------------------------------------------------- //
+
+	/**
+	 * @brief Writes n vectors with non-temporal stores, the source is
+	 *        prefetched ahead as non-temporal too, so neither side of the
+	 *        copy stays in the cache hierarchy
+	 *
+	 * @param dst destination, 16 bytes aligned
+	 * @param src source vectors
+	 * @param n   vector count
+	 */
+	inline void stream_batch(float (*dst)[4], TVector4<float> const *src, std::size_t n) noexcept
+	{
+		constexpr std::size_t ahead = 16;
+
+		for (std::size_t i = 0; i < n; i++)
+		{
+			if (i + ahead < n)
+			{
+				_mm_prefetch(reinterpret_cast<char const *>(src + i + ahead), _MM_HINT_NTA);
+			}
+
+			_mm_stream_ps(dst[i], _mm_loadu_ps(src[i].data));
+		}
+
+		_mm_sfence();
+	}
+
+	/**
+	 * @brief Writes n matrices with non-temporal stores, @see stream_batch
+	 *
+	 * @param dst destination, 16 bytes aligned
+	 * @param src source matrices
+	 * @param n   matrix count
+	 */
+	inline void stream_batch(float (*dst)[3][4], TMatrix3x4<float> const *src, std::size_t n) noexcept
+	{
+		constexpr std::size_t ahead = 4;
+
+		for (std::size_t i = 0; i < n; i++)
+		{
+			if (i + ahead < n)
+			{
+				_mm_prefetch(reinterpret_cast<char const *>(src + i + ahead) + 0x00, _MM_HINT_NTA);
+				_mm_prefetch(reinterpret_cast<char const *>(src + i + ahead) + sizeof(TMatrix3x4<float>) - 1, _MM_HINT_NTA);
+			}
+
+			_mm_stream_ps(dst[i][0], _mm_loadu_ps(src[i].data[0].data));
+			_mm_stream_ps(dst[i][1], _mm_loadu_ps(src[i].data[1].data));
+			_mm_stream_ps(dst[i][2], _mm_loadu_ps(src[i].data[2].data));
+		}
+
+		_mm_sfence();
+	}
+
+	/**
+	 * @brief Writes n matrices with non-temporal stores, @see stream_batch
+	 *
+	 * @param dst destination, 16 bytes aligned
+	 * @param src source matrices
+	 * @param n   matrix count
+	 */
+	inline void stream_batch(float (*dst)[4][4], TMatrix4x4<float> const *src, std::size_t n) noexcept
+	{
+		constexpr std::size_t ahead = 4;
+
+		for (std::size_t i = 0; i < n; i++)
+		{
+			if (i + ahead < n)
+			{
+				_mm_prefetch(reinterpret_cast<char const *>(src + i + ahead) + 0x00, _MM_HINT_NTA);
+				_mm_prefetch(reinterpret_cast<char const *>(src + i + ahead) + sizeof(TMatrix4x4<float>) - 1, _MM_HINT_NTA);
+			}
+
+			stream(dst[i], src[i]);
+		}
+
+		_mm_sfence();
+	}
+
+	inline void stream_batch(float (*dst)[4][4], TMatrix4x4A<float> const *src, std::size_t n) noexcept
+	{
+		constexpr std::size_t ahead = 4;
+
+		for (std::size_t i = 0; i < n; i++)
+		{
+			if (i + ahead < n)
+			{
+				_mm_prefetch(reinterpret_cast<char const *>(src + i + ahead), _MM_HINT_NTA);
+			}
+
+			stream(dst[i], src[i]);
+		}
+
+		_mm_sfence();
+	}
+}
+
+// ------------------------------------------------------------------------- //
+
+#include <libmath/half.hh>
+
+namespace micro::math::simd
+{
+	/**
+	 * @brief Rounds 4 floats to bfloat16, ties to even, NaNs stay quiet
+	 *
+	 * @return the 4 bfloat16 sign-extended in the 32-bit lanes, ready for _mm_packs_epi32
+	 */
+	inline __m128i __vectorcall _bf16_pack_ps(__m128 const f) noexcept
+	{
+		auto const X = _mm_castps_si128(f);
+		auto const A = _mm_and_si128(_mm_srli_epi32(X, 16), _mm_set1_epi32(1)); // LSB of the kept bits
+		auto const B = _mm_add_epi32(_mm_add_epi32(X, _mm_set1_epi32(0x7FFF)), A);
+		auto const C = _mm_or_si128(X, _mm_set1_epi32(0x400000));	      // quiet NaN
+		auto const N = _mm_castps_si128(_mm_cmpunord_ps(f, f));
+		auto const D = _mm_or_si128(_mm_and_si128(N, C), _mm_andnot_si128(N, B));
+
+		return _mm_srai_epi32(D, 16);
+	}
+
+	inline void pack_batch(bfloat16 *dst, float const *src, std::size_t n) noexcept
+	{
+		std::size_t i = 0;
+
+		for (; i + 8 <= n; i += 8)
+		{
+			auto const A = _bf16_pack_ps(_mm_loadu_ps(src + i + 0));
+			auto const B = _bf16_pack_ps(_mm_loadu_ps(src + i + 4));
+
+			_mm_storeu_si128(reinterpret_cast<__m128i *>(&dst[i].bits), _mm_packs_epi32(A, B));
+		}
+
+		for (; i < n; i++)
+		{
+			dst[i] = pack<bfloat16>(src[i]);
+		}
+	}
+
+	inline void unpack_batch(float *dst, bfloat16 const *src, std::size_t n) noexcept
+	{
+		auto const nil = _mm_setzero_si128();
+
+		std::size_t i = 0;
+
+		for (; i + 8 <= n; i += 8)
+		{
+			auto const A = _mm_loadu_si128(reinterpret_cast<__m128i const *>(&src[i].bits));
+
+			_mm_storeu_ps(dst + i + 0, _mm_castsi128_ps(_mm_unpacklo_epi16(nil, A)));
+			_mm_storeu_ps(dst + i + 4, _mm_castsi128_ps(_mm_unpackhi_epi16(nil, A)));
+		}
+
+		for (; i < n; i++)
+		{
+			dst[i] = unpack(src[i]);
+		}
+	}
+
+	inline void transform_batch(TPackedVector4<bfloat16> *dst,
+				    TMatrix4x4<float> const &m,
+				    TPackedVector4<bfloat16> const *src, std::size_t n) noexcept
+	{
+		auto const nil = _mm_setzero_si128();
+
+		auto C0 = _mm_loadu_ps(m.data[0].data);
+		auto C1 = _mm_loadu_ps(m.data[1].data);
+		auto C2 = _mm_loadu_ps(m.data[2].data);
+		auto C3 = _mm_loadu_ps(m.data[3].data);
+
+		_MM_TRANSPOSE4_PS(C0, C1, C2, C3);
+
+		for (std::size_t i = 0; i < n; i++)
+		{
+			auto const A = _mm_loadl_epi64(reinterpret_cast<__m128i const *>(src[i].data));
+			auto const B = _mm_castsi128_ps(_mm_unpacklo_epi16(nil, A));
+			auto const C = _bf16_pack_ps(_m4x4_mul_ps(B, C0, C1, C2, C3));
+
+			_mm_storel_epi64(reinterpret_cast<__m128i *>(dst[i].data), _mm_packs_epi32(C, C));
+		}
+	}
+
+#ifdef __F16C__
+	inline void pack_batch(half *dst, float const *src, std::size_t n) noexcept
+	{
+		std::size_t i = 0;
+
+		for (; i + 8 <= n; i += 8)
+		{
+			auto const A = _mm_cvtps_ph(_mm_loadu_ps(src + i + 0), _MM_FROUND_TO_NEAREST_INT);
+			auto const B = _mm_cvtps_ph(_mm_loadu_ps(src + i + 4), _MM_FROUND_TO_NEAREST_INT);
+
+			_mm_storeu_si128(reinterpret_cast<__m128i *>(&dst[i].bits), _mm_unpacklo_epi64(A, B));
+		}
+
+		for (; i < n; i++)
+		{
+			dst[i] = pack<half>(src[i]);
+		}
+	}
+
+	inline void unpack_batch(float *dst, half const *src, std::size_t n) noexcept
+	{
+		std::size_t i = 0;
+
+		for (; i + 8 <= n; i += 8)
+		{
+			auto const A = _mm_loadu_si128(reinterpret_cast<__m128i const *>(&src[i].bits));
+
+			_mm_storeu_ps(dst + i + 0, _mm_cvtph_ps(A));
+			_mm_storeu_ps(dst + i + 4, _mm_cvtph_ps(_mm_unpackhi_epi64(A, A)));
+		}
+
+		for (; i < n; i++)
+		{
+			dst[i] = unpack(src[i]);
+		}
+	}
+
+	inline void transform_batch(TPackedVector4<half> *dst,
+				    TMatrix4x4<float> const &m,
+				    TPackedVector4<half> const *src, std::size_t n) noexcept
+	{
+		auto C0 = _mm_loadu_ps(m.data[0].data);
+		auto C1 = _mm_loadu_ps(m.data[1].data);
+		auto C2 = _mm_loadu_ps(m.data[2].data);
+		auto C3 = _mm_loadu_ps(m.data[3].data);
+
+		_MM_TRANSPOSE4_PS(C0, C1, C2, C3);
+
+		for (std::size_t i = 0; i < n; i++)
+		{
+			auto const A = _mm_cvtph_ps(_mm_loadl_epi64(reinterpret_cast<__m128i const *>(src[i].data)));
+			auto const B = _mm_cvtps_ph(_m4x4_mul_ps(A, C0, C1, C2, C3), _MM_FROUND_TO_NEAREST_INT);
+
+			_mm_storel_epi64(reinterpret_cast<__m128i *>(dst[i].data), B);
+		}
+	}
+#endif
 }
 
+// ------------------------------------------------------------------------- //
+
+#include <libmath/quantize.hh>
+
+namespace micro::math::simd
+{
+	inline void encode_batch(PackedNormal *dst, TVector3<float> const *src, std::size_t n) noexcept
+	{
+		auto const nil = _mm_setzero_ps();
+		auto const one = _mm_set1_ps(1.f);
+		auto const neg = _mm_set1_ps(-0.f);
+		auto const max = _mm_set1_ps(quantize_snorm16);
+
+		std::size_t i = 0;
+
+		for (; i + 4 <= n; i += 4)
+		{
+			auto x = _load3_ps(src[i + 0]);
+			auto y = _load3_ps(src[i + 1]);
+			auto z = _load3_ps(src[i + 2]);
+			auto w = _load3_ps(src[i + 3]);
+
+			_MM_TRANSPOSE4_PS(x, y, z, w);
+
+			auto const S = _mm_add_ps(_mm_add_ps(_mm_andnot_ps(neg, x), _mm_andnot_ps(neg, y)), _mm_andnot_ps(neg, z));
+			auto const G = _mm_cmpgt_ps(S, nil); // the zero vector encodes as +Z
+			auto const X = _mm_and_ps(G, _mm_div_ps(x, S));
+			auto const Y = _mm_and_ps(G, _mm_div_ps(y, S));
+
+			//
+			// fold the lower hemisphere, sign(0) is taken as positive
+			//
+
+			auto const N = _mm_cmplt_ps(z, nil);
+			auto const U = _mm_or_ps(_mm_sub_ps(one, _mm_andnot_ps(neg, Y)), _mm_and_ps(_mm_cmplt_ps(X, nil), neg));
+			auto const V = _mm_or_ps(_mm_sub_ps(one, _mm_andnot_ps(neg, X)), _mm_and_ps(_mm_cmplt_ps(Y, nil), neg));
+			auto const P = _mm_or_ps(_mm_and_ps(N, U), _mm_andnot_ps(N, X));
+			auto const Q = _mm_or_ps(_mm_and_ps(N, V), _mm_andnot_ps(N, Y));
+
+			auto const A = _mm_cvtps_epi32(_mm_mul_ps(P, max));
+			auto const B = _mm_cvtps_epi32(_mm_mul_ps(Q, max));
+
+			_mm_storeu_si128(reinterpret_cast<__m128i *>(dst[i].data), _mm_unpacklo_epi16(_mm_packs_epi32(A, A),
+												       _mm_packs_epi32(B, B)));
+		}
+
+		for (; i < n; i++)
+		{
+			dst[i] = encode_normal(src[i]);
+		}
+	}
+
+	inline void decode_batch(TVector3<float> *dst, PackedNormal const *src, std::size_t n) noexcept
+	{
+		auto const nil = _mm_setzero_ps();
+		auto const one = _mm_set1_ps(1.f);
+		auto const neg = _mm_set1_ps(-0.f);
+		auto const max = _mm_set1_ps(quantize_snorm16);
+
+		std::size_t i = 0;
+
+		for (; i + 4 <= n; i += 4)
+		{
+			auto const A = _mm_loadu_si128(reinterpret_cast<__m128i const *>(src[i].data)); // x0 y0 x1 y1 x2 y2 x3 y3
+			auto const X = _mm_div_ps(_mm_cvtepi32_ps(_mm_srai_epi32(_mm_slli_epi32(A, 16), 16)), max);
+			auto const Y = _mm_div_ps(_mm_cvtepi32_ps(_mm_srai_epi32(A, 16)), max);
+			auto const Z = _mm_sub_ps(_mm_sub_ps(one, _mm_andnot_ps(neg, X)), _mm_andnot_ps(neg, Y));
+			auto const T = _mm_max_ps(_mm_sub_ps(nil, Z), nil);
+			auto const U = _mm_sub_ps(X, _mm_or_ps(T, _mm_and_ps(neg, X))); // x - copysign(t, x)
+			auto const V = _mm_sub_ps(Y, _mm_or_ps(T, _mm_and_ps(neg, Y))); // y - copysign(t, y)
+			auto const L = _mm_add_ps(_mm_add_ps(_mm_mul_ps(U, U), _mm_mul_ps(V, V)), _mm_mul_ps(Z, Z));
+			auto const R = _mm_sqrt_ps(L);
+
+			auto x = _mm_div_ps(U, R);
+			auto y = _mm_div_ps(V, R);
+			auto z = _mm_div_ps(Z, R);
+			auto w = nil;
+
+			_MM_TRANSPOSE4_PS(x, y, z, w);
+
+			_store3_ps(dst[i + 0], x);
+			_store3_ps(dst[i + 1], y);
+			_store3_ps(dst[i + 2], z);
+			_store3_ps(dst[i + 3], w);
+		}
+
+		for (; i < n; i++)
+		{
+			dst[i] = decode(src[i]);
+		}
+	}
+
+	// ----------------------------------------------------------------- //
+
+	/**
+	 * @brief Expands a smallest-three quaternion
+	 *
+	 * @param e encoded quaternion, the 2 bytes following it are read and ignored
+	 */
+	inline __m128 __vectorcall _decode_quaternion_ps(PackedQuaternion const &e) noexcept
+	{
+		auto const A = _mm_loadl_epi64(reinterpret_cast<__m128i const *>(e.data));
+		auto const B = _mm_srli_epi32(_mm_unpacklo_epi16(A, _mm_setzero_si128()), 1);
+		auto const C = _mm_mul_ps(_mm_cvtepi32_ps(B), _mm_set1_ps(2.f * quantize_sqrt1_2 / quantize_unorm15));
+		auto const F = _mm_sub_ps(C, _mm_set1_ps(quantize_sqrt1_2)); // a b c -
+
+		auto const M = _mm_mul_ps(F, F);
+		auto const D = _mm_add_ss(_mm_add_ss(M, _mm_shuffle_ps(M, M, _MM_SHUFFLE(0, 0, 0, 1))),
+					  _mm_shuffle_ps(M, M, _MM_SHUFFLE(0, 0, 0, 2)));
+		auto const S = _mm_sqrt_ss(_mm_max_ss(_mm_sub_ss(_mm_set_ss(1.f), D), _mm_setzero_ps()));
+		auto const W = _mm_shuffle_ps(S, S, _MM_SHUFFLE(0, 0, 0, 0));
+
+		switch ((e.data[0] & 1) << 1 | (e.data[1] & 1))
+		{
+		case 0:
+			return _mm_shuffle_ps(_mm_shuffle_ps(W, F, _MM_SHUFFLE(1, 0, 0, 0)), F, _MM_SHUFFLE(2, 1, 2, 0)); // w a b c
+		case 1:
+			return _mm_shuffle_ps(_mm_unpacklo_ps(F, W), F, _MM_SHUFFLE(2, 1, 1, 0)); // a w b c
+		case 2:
+			return _mm_shuffle_ps(F, _mm_shuffle_ps(F, W, _MM_SHUFFLE(0, 0, 2, 2)), _MM_SHUFFLE(0, 2, 1, 0)); // a b w c
+		default:
+			return _mm_shuffle_ps(F, _mm_shuffle_ps(F, W, _MM_SHUFFLE(0, 0, 2, 2)), _MM_SHUFFLE(2, 0, 1, 0)); // a b c w
+		}
+	}
+
+	inline void encode_batch(PackedQuaternion *dst, TVector4<float> const *src, std::size_t n) noexcept
+	{
+		auto const neg = _mm_set1_ps(-0.f);
+		auto const one = _mm_set1_ps(1.f);
+		auto const nil = _mm_setzero_ps();
+		auto const mul = _mm_set1_ps(.5f / quantize_sqrt1_2);
+		auto const max = _mm_set1_ps(quantize_unorm15);
+
+		alignas(alignof(__m128i)) std::int32_t o[4];
+
+		for (std::size_t i = 0; i < n; i++)
+		{
+			auto const Q = _mm_loadu_ps(src[i].data);
+			auto const A = _mm_andnot_ps(neg, Q);
+			auto const B = _mm_max_ps(A, _mm_shuffle_ps(A, A, _MM_SHUFFLE(2, 3, 0, 1)));
+			auto const C = _mm_max_ps(B, _mm_shuffle_ps(B, B, _MM_SHUFFLE(1, 0, 3, 2))); // max(|q|) in every lane
+
+			auto const m = _mm_movemask_ps(_mm_cmpeq_ps(A, C));
+			auto const k = m & 1 ? 0 : m & 2 ? 1 : m & 4 ? 2 : 3; // first largest, as the scalar path
+
+			//
+			// q and -q are the same rotation, flip so that the dropped component is positive
+			//
+
+			alignas(alignof(__m128)) float q[4];
+
+			_mm_store_ps(q, Q);
+
+			auto const S = _mm_and_ps(_mm_set1_ps(q[k]), neg);
+			auto const F = _mm_xor_ps(Q, S);
+
+			__m128 G;
+
+			switch (k)
+			{
+			case 0:
+				G = _mm_shuffle_ps(F, F, _MM_SHUFFLE(0, 3, 2, 1));
+				break;
+			case 1:
+				G = _mm_shuffle_ps(F, F, _MM_SHUFFLE(1, 3, 2, 0));
+				break;
+			case 2:
+				G = _mm_shuffle_ps(F, F, _MM_SHUFFLE(2, 3, 1, 0));
+				break;
+			default:
+				G = F;
+				break;
+			}
+
+			auto const H = _mm_add_ps(_mm_mul_ps(G, mul), _mm_set1_ps(.5f));
+			auto const I = _mm_min_ps(_mm_max_ps(H, nil), one);
+
+			_mm_store_si128(reinterpret_cast<__m128i *>(o), _mm_cvtps_epi32(_mm_mul_ps(I, max)));
+
+			dst[i].data[0] = static_cast<std::uint16_t>(o[0] << 1 | k >> 1);
+			dst[i].data[1] = static_cast<std::uint16_t>(o[1] << 1 | (k & 1));
+			dst[i].data[2] = static_cast<std::uint16_t>(o[2] << 1);
+		}
+	}
+
+	inline void decode_batch(TVector4<float> *dst, PackedQuaternion const *src, std::size_t n) noexcept
+	{
+		for (std::size_t i = 0; i + 1 < n; i++)
+		{
+			_mm_storeu_ps(dst[i].data, _decode_quaternion_ps(src[i]));
+		}
+
+		if (n > 0)
+		{
+			dst[n - 1] = decode(src[n - 1]);
+		}
+	}
+
+	inline void decode_batch(TMatrix3x3<float> *dst, PackedQuaternion const *src, std::size_t n) noexcept
+	{
+		alignas(alignof(__m128)) TVector4<float> q;
+
+		for (std::size_t i = 0; i + 1 < n; i++)
+		{
+			_mm_store_ps(q.data, _decode_quaternion_ps(src[i]));
+
+			dst[i] = rotate3x3(q);
+		}
+
+		if (n > 0)
+		{
+			dst[n - 1] = rotate3x3(decode(src[n - 1]));
+		}
+	}
+
+	// ----------------------------------------------------------------- //
+
+	inline void encode_batch(PackedPosition *dst, TVector3<float> const *src, std::size_t n, TAABB<float> const &b) noexcept
+	{
+		auto const nil = _mm_setzero_ps();
+		auto const one = _mm_set1_ps(1.f);
+		auto const max = _mm_set1_ps(quantize_unorm16);
+		auto const bia = _mm_set1_epi32(0x8000);
+		auto const top = _mm_set1_epi16(-0x8000);
+		auto const lo = _load3_ps(b.lower());
+		auto const E = _mm_sub_ps(_load3_ps(b.upper()), lo);
+		auto const R = _mm_and_ps(_mm_div_ps(one, E), _mm_cmpgt_ps(E, nil)); // 0 on flat axes
+
+		for (std::size_t i = 0; i < n; i++)
+		{
+			auto const A = _mm_mul_ps(_mm_sub_ps(_load3_ps(src[i]), lo), R);
+			auto const B = _mm_min_ps(_mm_max_ps(A, nil), one);
+
+			//
+			// no unsigned saturating pack before SSE4.1, bias to signed and back
+			//
+
+			auto const C = _mm_sub_epi32(_mm_cvtps_epi32(_mm_mul_ps(B, max)), bia);
+			auto const D = _mm_xor_si128(_mm_packs_epi32(C, C), top);
+
+			dst[i].data[0] = static_cast<std::uint16_t>(_mm_extract_epi16(D, 0));
+			dst[i].data[1] = static_cast<std::uint16_t>(_mm_extract_epi16(D, 1));
+			dst[i].data[2] = static_cast<std::uint16_t>(_mm_extract_epi16(D, 2));
+		}
+	}
+
+	inline void decode_batch(TVector3<float> *dst, PackedPosition const *src, std::size_t n, TAABB<float> const &b) noexcept
+	{
+		auto const lo = _load3_ps(b.lower());
+		auto const S = _mm_div_ps(_mm_sub_ps(_load3_ps(b.upper()), lo), _mm_set1_ps(quantize_unorm16));
+
+		for (std::size_t i = 0; i + 1 < n; i++)
+		{
+			auto const A = _mm_loadl_epi64(reinterpret_cast<__m128i const *>(src[i].data)); // reads 2 bytes of src[i + 1]
+			auto const B = _mm_cvtepi32_ps(_mm_unpacklo_epi16(A, _mm_setzero_si128()));
+
+			_store3_ps(dst[i], _mm_add_ps(_mm_mul_ps(B, S), lo));
+		}
+
+		if (n > 0)
+		{
+			dst[n - 1] = decode(src[n - 1], b);
+		}
+	}
+}
+
+// ------------------------------------------------------------------------- //
+
+#include <libmath/batch.hh>
+
+namespace micro::math::simd
+{
+	/**
+	 * @brief Multiply a row from A matrix with the same half of all rows of B matrix
+	 *
+	 * @param r A matrix row
+	 *
+	 * @return r[0] * a + r[1] * b + r[2] * c
+	 */
+	inline __m128d __vectorcall _m3_mul_pd(double const *r,
+					       __m128d const a,
+					       __m128d const b,
+					       __m128d const c) noexcept
+	{
+		auto const A = _mm_mul_pd(_mm_set1_pd(r[0]), a);
+		auto const B = _mm_mul_pd(_mm_set1_pd(r[1]), b);
+		auto const C = _mm_mul_pd(_mm_set1_pd(r[2]), c);
+
+		return _mm_add_pd(_mm_add_pd(A, C), B);
+	}
+
+	/**
+	 * @return r[0] * a + r[1] * b + r[2] * c + r[3] * d
+	 */
+	inline __m128d __vectorcall _m4_mul_pd(double const *r,
+					       __m128d const a,
+					       __m128d const b,
+					       __m128d const c,
+					       __m128d const d) noexcept
+	{
+		auto const A = _mm_mul_pd(_mm_set1_pd(r[0]), a);
+		auto const B = _mm_mul_pd(_mm_set1_pd(r[1]), b);
+		auto const C = _mm_mul_pd(_mm_set1_pd(r[2]), c);
+		auto const D = _mm_mul_pd(_mm_set1_pd(r[3]), d);
+
+		return _mm_add_pd(_mm_add_pd(A, C), _mm_add_pd(B, D));
+	}
+
+	//
+	// SoA transposes: m[k] holds element k (row by row) of W consecutive
+	// matrices, one per lane, W being the lane count of the register. The
+	// loads take the distance s between those matrices, a stride of 0
+	// broadcasts src[0] to every lane.
+	//
+
+	inline void __vectorcall _load2x2_soa_ps(TMatrix2x2<float> const *src, __m128 m[4], std::size_t s = 1) noexcept
+	{
+		m[0] = _mm_loadu_ps(reinterpret_cast<float const *>(src + 0 * s));
+		m[1] = _mm_loadu_ps(reinterpret_cast<float const *>(src + 1 * s));
+		m[2] = _mm_loadu_ps(reinterpret_cast<float const *>(src + 2 * s));
+		m[3] = _mm_loadu_ps(reinterpret_cast<float const *>(src + 3 * s));
+
+		_MM_TRANSPOSE4_PS(m[0], m[1], m[2], m[3]);
+	}
+
+	inline void __vectorcall _store2x2_soa_ps(TMatrix2x2<float> *dst, __m128 const m[4]) noexcept
+	{
+		auto A = m[0];
+		auto B = m[1];
+		auto C = m[2];
+		auto D = m[3];
+
+		_MM_TRANSPOSE4_PS(A, B, C, D);
+
+		_mm_storeu_ps(reinterpret_cast<float *>(dst + 0), A);
+		_mm_storeu_ps(reinterpret_cast<float *>(dst + 1), B);
+		_mm_storeu_ps(reinterpret_cast<float *>(dst + 2), C);
+		_mm_storeu_ps(reinterpret_cast<float *>(dst + 3), D);
+	}
+
+	inline void __vectorcall _load3x3_soa_ps(TMatrix3x3<float> const *src, __m128 m[9], std::size_t s = 1) noexcept
+	{
+		for (auto r = 0; r < 3; r++)
+		{
+			auto A = _load3_ps(src[0 * s].data[r]);
+			auto B = _load3_ps(src[1 * s].data[r]);
+			auto C = _load3_ps(src[2 * s].data[r]);
+			auto D = _load3_ps(src[3 * s].data[r]);
+
+			_MM_TRANSPOSE4_PS(A, B, C, D);
+
+			m[r * 3 + 0] = A;
+			m[r * 3 + 1] = B;
+			m[r * 3 + 2] = C;
+		}
+	}
+
+	inline void __vectorcall _store3x3_soa_ps(TMatrix3x3<float> *dst, __m128 const m[9]) noexcept
+	{
+		for (auto r = 0; r < 3; r++)
+		{
+			auto A = m[r * 3 + 0];
+			auto B = m[r * 3 + 1];
+			auto C = m[r * 3 + 2];
+			auto D = _mm_setzero_ps();
+
+			_MM_TRANSPOSE4_PS(A, B, C, D);
+
+			_store3_ps(dst[0].data[r], A);
+			_store3_ps(dst[1].data[r], B);
+			_store3_ps(dst[2].data[r], C);
+			_store3_ps(dst[3].data[r], D);
+		}
+	}
+
+	inline void __vectorcall _load3x4_soa_ps(TMatrix3x4<float> const *src, __m128 m[12], std::size_t s = 1) noexcept
+	{
+		for (auto r = 0; r < 3; r++)
+		{
+			auto A = _mm_loadu_ps(src[0 * s].data[r].data);
+			auto B = _mm_loadu_ps(src[1 * s].data[r].data);
+			auto C = _mm_loadu_ps(src[2 * s].data[r].data);
+			auto D = _mm_loadu_ps(src[3 * s].data[r].data);
+
+			_MM_TRANSPOSE4_PS(A, B, C, D);
+
+			m[r * 4 + 0] = A;
+			m[r * 4 + 1] = B;
+			m[r * 4 + 2] = C;
+			m[r * 4 + 3] = D;
+		}
+	}
+
+	inline void __vectorcall _store3x4_soa_ps(TMatrix3x4<float> *dst, __m128 const m[12]) noexcept
+	{
+		for (auto r = 0; r < 3; r++)
+		{
+			auto A = m[r * 4 + 0];
+			auto B = m[r * 4 + 1];
+			auto C = m[r * 4 + 2];
+			auto D = m[r * 4 + 3];
+
+			_MM_TRANSPOSE4_PS(A, B, C, D);
+
+			_mm_storeu_ps(dst[0].data[r].data, A);
+			_mm_storeu_ps(dst[1].data[r].data, B);
+			_mm_storeu_ps(dst[2].data[r].data, C);
+			_mm_storeu_ps(dst[3].data[r].data, D);
+		}
+	}
+
+	inline void __vectorcall _load4x4_soa_ps(TMatrix4x4<float> const *src, __m128 m[16], std::size_t s = 1) noexcept
+	{
+		for (auto r = 0; r < 4; r++)
+		{
+			auto A = _mm_loadu_ps(src[0 * s].data[r].data);
+			auto B = _mm_loadu_ps(src[1 * s].data[r].data);
+			auto C = _mm_loadu_ps(src[2 * s].data[r].data);
+			auto D = _mm_loadu_ps(src[3 * s].data[r].data);
+
+			_MM_TRANSPOSE4_PS(A, B, C, D);
+
+			m[r * 4 + 0] = A;
+			m[r * 4 + 1] = B;
+			m[r * 4 + 2] = C;
+			m[r * 4 + 3] = D;
+		}
+	}
+
+	inline void __vectorcall _store4x4_soa_ps(TMatrix4x4<float> *dst, __m128 const m[16]) noexcept
+	{
+		for (auto r = 0; r < 4; r++)
+		{
+			auto A = m[r * 4 + 0];
+			auto B = m[r * 4 + 1];
+			auto C = m[r * 4 + 2];
+			auto D = m[r * 4 + 3];
+
+			_MM_TRANSPOSE4_PS(A, B, C, D);
+
+			_mm_storeu_ps(dst[0].data[r].data, A);
+			_mm_storeu_ps(dst[1].data[r].data, B);
+			_mm_storeu_ps(dst[2].data[r].data, C);
+			_mm_storeu_ps(dst[3].data[r].data, D);
+		}
+	}
+
+	inline __m128 __vectorcall _soa_mul(__m128 const a, __m128 const b) noexcept { return _mm_mul_ps(a, b); }
+	inline __m128 __vectorcall _soa_add(__m128 const a, __m128 const b) noexcept { return _mm_add_ps(a, b); }
+
+#ifdef __AVX__
+	//
+	// 8 float lanes, built from two 4 lane transposes
+	//
+
+	inline void __vectorcall _soa8_ps(__m256 *m, __m128 const *l, __m128 const *h, std::size_t n) noexcept
+	{
+		for (std::size_t k = 0; k < n; k++)
+		{
+			m[k] = _mm256_insertf128_ps(_mm256_castps128_ps256(l[k]), h[k], 1);
+		}
+	}
+
+	inline void __vectorcall _soa4_ps(__m128 *l, __m128 *h, __m256 const *m, std::size_t n) noexcept
+	{
+		for (std::size_t k = 0; k < n; k++)
+		{
+			l[k] = _mm256_castps256_ps128(m[k]);
+			h[k] = _mm256_extractf128_ps(m[k], 1);
+		}
+	}
+
+	inline void __vectorcall _load2x2_soa_ps(TMatrix2x2<float> const *src, __m256 m[4], std::size_t s = 1) noexcept
+	{
+		__m128 L[4];
+		__m128 H[4];
+
+		_load2x2_soa_ps(src, L, s);
+		_load2x2_soa_ps(src + 4 * s, H, s);
+		_soa8_ps(m, L, H, 4);
+	}
+
+	inline void __vectorcall _store2x2_soa_ps(TMatrix2x2<float> *dst, __m256 const m[4]) noexcept
+	{
+		__m128 L[4];
+		__m128 H[4];
+
+		_soa4_ps(L, H, m, 4);
+		_store2x2_soa_ps(dst, L);
+		_store2x2_soa_ps(dst + 4, H);
+	}
+
+	inline void __vectorcall _load3x3_soa_ps(TMatrix3x3<float> const *src, __m256 m[9], std::size_t s = 1) noexcept
+	{
+		__m128 L[9];
+		__m128 H[9];
+
+		_load3x3_soa_ps(src, L, s);
+		_load3x3_soa_ps(src + 4 * s, H, s);
+		_soa8_ps(m, L, H, 9);
+	}
+
+	inline void __vectorcall _store3x3_soa_ps(TMatrix3x3<float> *dst, __m256 const m[9]) noexcept
+	{
+		__m128 L[9];
+		__m128 H[9];
+
+		_soa4_ps(L, H, m, 9);
+		_store3x3_soa_ps(dst, L);
+		_store3x3_soa_ps(dst + 4, H);
+	}
+
+	inline void __vectorcall _load3x4_soa_ps(TMatrix3x4<float> const *src, __m256 m[12], std::size_t s = 1) noexcept
+	{
+		__m128 L[12];
+		__m128 H[12];
+
+		_load3x4_soa_ps(src, L, s);
+		_load3x4_soa_ps(src + 4 * s, H, s);
+		_soa8_ps(m, L, H, 12);
+	}
+
+	inline void __vectorcall _store3x4_soa_ps(TMatrix3x4<float> *dst, __m256 const m[12]) noexcept
+	{
+		__m128 L[12];
+		__m128 H[12];
+
+		_soa4_ps(L, H, m, 12);
+		_store3x4_soa_ps(dst, L);
+		_store3x4_soa_ps(dst + 4, H);
+	}
+
+	inline void __vectorcall _load4x4_soa_ps(TMatrix4x4<float> const *src, __m256 m[16], std::size_t s = 1) noexcept
+	{
+		__m128 L[16];
+		__m128 H[16];
+
+		_load4x4_soa_ps(src, L, s);
+		_load4x4_soa_ps(src + 4 * s, H, s);
+		_soa8_ps(m, L, H, 16);
+	}
+
+	inline void __vectorcall _store4x4_soa_ps(TMatrix4x4<float> *dst, __m256 const m[16]) noexcept
+	{
+		__m128 L[16];
+		__m128 H[16];
+
+		_soa4_ps(L, H, m, 16);
+		_store4x4_soa_ps(dst, L);
+		_store4x4_soa_ps(dst + 4, H);
+	}
+
+	/**
+	 * @brief Four matrices to SoA, m[k] holds element k of each, one per lane
+	 */
+	inline void __vectorcall _load4x4_soa_pd(TMatrix4x4<double> const *src, __m256d m[16], std::size_t s = 1) noexcept
+	{
+		for (auto r = 0; r < 4; r++)
+		{
+			auto const A = _mm256_loadu_pd(src[0 * s].data[r].data);
+			auto const B = _mm256_loadu_pd(src[1 * s].data[r].data);
+			auto const C = _mm256_loadu_pd(src[2 * s].data[r].data);
+			auto const D = _mm256_loadu_pd(src[3 * s].data[r].data);
+			auto const E = _mm256_unpacklo_pd(A, B);
+			auto const F = _mm256_unpackhi_pd(A, B);
+			auto const G = _mm256_unpacklo_pd(C, D);
+			auto const H = _mm256_unpackhi_pd(C, D);
+
+			m[r * 4 + 0] = _mm256_permute2f128_pd(E, G, 0x20);
+			m[r * 4 + 1] = _mm256_permute2f128_pd(F, H, 0x20);
+			m[r * 4 + 2] = _mm256_permute2f128_pd(E, G, 0x31);
+			m[r * 4 + 3] = _mm256_permute2f128_pd(F, H, 0x31);
+		}
+	}
+
+	inline void __vectorcall _store4x4_soa_pd(TMatrix4x4<double> *dst, __m256d const m[16]) noexcept
+	{
+		for (auto r = 0; r < 4; r++)
+		{
+			auto const E = _mm256_unpacklo_pd(m[r * 4 + 0], m[r * 4 + 1]);
+			auto const F = _mm256_unpackhi_pd(m[r * 4 + 0], m[r * 4 + 1]);
+			auto const G = _mm256_unpacklo_pd(m[r * 4 + 2], m[r * 4 + 3]);
+			auto const H = _mm256_unpackhi_pd(m[r * 4 + 2], m[r * 4 + 3]);
+
+			_mm256_storeu_pd(dst[0].data[r].data, _mm256_permute2f128_pd(E, G, 0x20));
+			_mm256_storeu_pd(dst[1].data[r].data, _mm256_permute2f128_pd(F, H, 0x20));
+			_mm256_storeu_pd(dst[2].data[r].data, _mm256_permute2f128_pd(E, G, 0x31));
+			_mm256_storeu_pd(dst[3].data[r].data, _mm256_permute2f128_pd(F, H, 0x31));
+		}
+	}
+
+	inline void __vectorcall _load3x4_soa_pd(TMatrix3x4<double> const *src, __m256d m[12], std::size_t s = 1) noexcept
+	{
+		for (auto r = 0; r < 3; r++)
+		{
+			auto const A = _mm256_loadu_pd(src[0 * s].data[r].data);
+			auto const B = _mm256_loadu_pd(src[1 * s].data[r].data);
+			auto const C = _mm256_loadu_pd(src[2 * s].data[r].data);
+			auto const D = _mm256_loadu_pd(src[3 * s].data[r].data);
+			auto const E = _mm256_unpacklo_pd(A, B);
+			auto const F = _mm256_unpackhi_pd(A, B);
+			auto const G = _mm256_unpacklo_pd(C, D);
+			auto const H = _mm256_unpackhi_pd(C, D);
+
+			m[r * 4 + 0] = _mm256_permute2f128_pd(E, G, 0x20);
+			m[r * 4 + 1] = _mm256_permute2f128_pd(F, H, 0x20);
+			m[r * 4 + 2] = _mm256_permute2f128_pd(E, G, 0x31);
+			m[r * 4 + 3] = _mm256_permute2f128_pd(F, H, 0x31);
+		}
+	}
+
+	inline void __vectorcall _store3x4_soa_pd(TMatrix3x4<double> *dst, __m256d const m[12]) noexcept
+	{
+		for (auto r = 0; r < 3; r++)
+		{
+			auto const E = _mm256_unpacklo_pd(m[r * 4 + 0], m[r * 4 + 1]);
+			auto const F = _mm256_unpackhi_pd(m[r * 4 + 0], m[r * 4 + 1]);
+			auto const G = _mm256_unpacklo_pd(m[r * 4 + 2], m[r * 4 + 3]);
+			auto const H = _mm256_unpackhi_pd(m[r * 4 + 2], m[r * 4 + 3]);
+
+			_mm256_storeu_pd(dst[0].data[r].data, _mm256_permute2f128_pd(E, G, 0x20));
+			_mm256_storeu_pd(dst[1].data[r].data, _mm256_permute2f128_pd(F, H, 0x20));
+			_mm256_storeu_pd(dst[2].data[r].data, _mm256_permute2f128_pd(E, G, 0x31));
+			_mm256_storeu_pd(dst[3].data[r].data, _mm256_permute2f128_pd(F, H, 0x31));
+		}
+	}
+
+	inline __m256 __vectorcall _soa_mul(__m256 const a, __m256 const b) noexcept { return _mm256_mul_ps(a, b); }
+	inline __m256 __vectorcall _soa_add(__m256 const a, __m256 const b) noexcept { return _mm256_add_ps(a, b); }
+	inline __m256d __vectorcall _soa_mul(__m256d const a, __m256d const b) noexcept { return _mm256_mul_pd(a, b); }
+	inline __m256d __vectorcall _soa_add(__m256d const a, __m256d const b) noexcept { return _mm256_add_pd(a, b); }
+
+	using soa_ps = __m256;
+#else
+	using soa_ps = __m128;
+#endif
+
+	/**
+	 * @brief c = a * b lane by lane, a is R x K with rows S registers apart
+	 *        and b is K x C, one register per element
+	 */
+	template <int R, int K, int C, int S = K, class V>
+	inline void __vectorcall _multiply_soa(V const *a, V const *b, V *c) noexcept
+	{
+		for (auto r = 0; r < R; r++)
+		{
+			for (auto j = 0; j < C; j++)
+			{
+				auto x = _soa_mul(a[r * S], b[j]);
+
+				for (auto k = 1; k < K; k++)
+				{
+					x = _soa_add(x, _soa_mul(a[r * S + k], b[k * C + j]));
+				}
+
+				c[r * C + j] = x;
+			}
+		}
+	}
+
+	//
+	// Shared loops of the multiply_batch forms, a stride of 0 repeats the
+	// same matrix for every product. W products at a time run transposed
+	// to SoA, the rest one by one. Both operands are fully loaded before
+	// anything is stored, so dst may be the same array as a or b.
+	//
+
+	inline void _multiply_batch(TMatrix2x2<float> *dst,
+				    TMatrix2x2<float> const *a, std::size_t sa,
+				    TMatrix2x2<float> const *b, std::size_t sb, std::size_t n) noexcept
+	{
+		constexpr std::size_t W = sizeof(soa_ps) / sizeof(float);
+
+		soa_ps X[4];
+		soa_ps Y[4];
+		soa_ps Z[4];
+		std::size_t i = 0;
+
+		if (n >= W && !sa)
+		{
+			_load2x2_soa_ps(a, X, 0);
+		}
+
+		if (n >= W && !sb)
+		{
+			_load2x2_soa_ps(b, Y, 0);
+		}
+
+		for (; i + W <= n; i += W)
+		{
+			if (sa)
+			{
+				_load2x2_soa_ps(a + i, X);
+			}
+
+			if (sb)
+			{
+				_load2x2_soa_ps(b + i, Y);
+			}
+
+			_multiply_soa<2, 2, 2>(X, Y, Z);
+
+			_store2x2_soa_ps(dst + i, Z);
+		}
+
+		for (; i < n; i++)
+		{
+			auto const A = _mm_loadu_ps(reinterpret_cast<float const *>(a + i * sa)); // abcd
+			auto const B = _mm_loadu_ps(reinterpret_cast<float const *>(b + i * sb)); // efgh
+
+			//
+			// the whole product in one register, aacc * efef + bbdd * ghgh
+			//
+
+			auto const C = _mm_mul_ps(_mm_shuffle_ps(A, A, _MM_SHUFFLE(2, 2, 0, 0)), _mm_shuffle_ps(B, B, _MM_SHUFFLE(1, 0, 1, 0)));
+			auto const D = _mm_mul_ps(_mm_shuffle_ps(A, A, _MM_SHUFFLE(3, 3, 1, 1)), _mm_shuffle_ps(B, B, _MM_SHUFFLE(3, 2, 3, 2)));
+
+			_mm_storeu_ps(reinterpret_cast<float *>(dst + i), _mm_add_ps(C, D));
+		}
+	}
+
+	inline void _multiply_batch(TMatrix2x2<double> *dst,
+				    TMatrix2x2<double> const *a, std::size_t sa,
+				    TMatrix2x2<double> const *b, std::size_t sb, std::size_t n) noexcept
+	{
+		for (std::size_t i = 0; i < n; i++)
+		{
+			auto const A0 = _mm_loadu_pd(a[i * sa].data[0].data); // ab
+			auto const A1 = _mm_loadu_pd(a[i * sa].data[1].data); // cd
+			auto const B0 = _mm_loadu_pd(b[i * sb].data[0].data); // ef
+			auto const B1 = _mm_loadu_pd(b[i * sb].data[1].data); // gh
+
+			auto const C0 = _mm_add_pd(_mm_mul_pd(_mm_unpacklo_pd(A0, A0), B0), _mm_mul_pd(_mm_unpackhi_pd(A0, A0), B1));
+			auto const C1 = _mm_add_pd(_mm_mul_pd(_mm_unpacklo_pd(A1, A1), B0), _mm_mul_pd(_mm_unpackhi_pd(A1, A1), B1));
+
+			_mm_storeu_pd(dst[i].data[0].data, C0);
+			_mm_storeu_pd(dst[i].data[1].data, C1);
+		}
+	}
+
+	inline void _multiply_batch(TMatrix3x3<float> *dst,
+				    TMatrix3x3<float> const *a, std::size_t sa,
+				    TMatrix3x3<float> const *b, std::size_t sb, std::size_t n) noexcept
+	{
+		constexpr std::size_t W = sizeof(soa_ps) / sizeof(float);
+
+		soa_ps X[9];
+		soa_ps Y[9];
+		soa_ps Z[9];
+		std::size_t i = 0;
+
+		if (n >= W && !sa)
+		{
+			_load3x3_soa_ps(a, X, 0);
+		}
+
+		if (n >= W && !sb)
+		{
+			_load3x3_soa_ps(b, Y, 0);
+		}
+
+		for (; i + W <= n; i += W)
+		{
+			if (sa)
+			{
+				_load3x3_soa_ps(a + i, X);
+			}
+
+			if (sb)
+			{
+				_load3x3_soa_ps(b + i, Y);
+			}
+
+			_multiply_soa<3, 3, 3>(X, Y, Z);
+
+			_store3x3_soa_ps(dst + i, Z);
+		}
+
+		for (; i < n; i++)
+		{
+			auto const A0 = _load3_ps(a[i * sa].data[0]);
+			auto const A1 = _load3_ps(a[i * sa].data[1]);
+			auto const A2 = _load3_ps(a[i * sa].data[2]);
+			auto const B0 = _load3_ps(b[i * sb].data[0]);
+			auto const B1 = _load3_ps(b[i * sb].data[1]);
+			auto const B2 = _load3_ps(b[i * sb].data[2]);
+
+			_store3_ps(dst[i].data[0], _m3x3_mul_ps(A0, B0, B1, B2));
+			_store3_ps(dst[i].data[1], _m3x3_mul_ps(A1, B0, B1, B2));
+			_store3_ps(dst[i].data[2], _m3x3_mul_ps(A2, B0, B1, B2));
+		}
+	}
+
+	inline void _multiply_batch(TMatrix3x3<double> *dst,
+				    TMatrix3x3<double> const *a, std::size_t sa,
+				    TMatrix3x3<double> const *b, std::size_t sb, std::size_t n) noexcept
+	{
+		for (std::size_t i = 0; i < n; i++)
+		{
+			auto const l = a[i * sa];
+
+			auto const B0 = _mm_loadu_pd(b[i * sb].data[0].data);	   // xy
+			auto const B1 = _mm_loadu_pd(b[i * sb].data[1].data);	   // xy
+			auto const B2 = _mm_loadu_pd(b[i * sb].data[2].data);	   // xy
+			auto const D0 = _mm_load_sd(b[i * sb].data[0].data + 2); // z0
+			auto const D1 = _mm_load_sd(b[i * sb].data[1].data + 2); // z0
+			auto const D2 = _mm_load_sd(b[i * sb].data[2].data + 2); // z0
+
+			_mm_storeu_pd(dst[i].data[0].data, _m3_mul_pd(l.data[0].data, B0, B1, B2));
+			_mm_storeu_pd(dst[i].data[1].data, _m3_mul_pd(l.data[1].data, B0, B1, B2));
+			_mm_storeu_pd(dst[i].data[2].data, _m3_mul_pd(l.data[2].data, B0, B1, B2));
+			_mm_store_sd(dst[i].data[0].data + 2, _m3_mul_pd(l.data[0].data, D0, D1, D2));
+			_mm_store_sd(dst[i].data[1].data + 2, _m3_mul_pd(l.data[1].data, D0, D1, D2));
+			_mm_store_sd(dst[i].data[2].data + 2, _m3_mul_pd(l.data[2].data, D0, D1, D2));
+		}
+	}
+
+	inline void _multiply_batch(TMatrix3x4<float> *dst,
+				    TMatrix3x4<float> const *a, std::size_t sa,
+				    TMatrix3x4<float> const *b, std::size_t sb, std::size_t n) noexcept
+	{
+		constexpr std::size_t W = sizeof(soa_ps) / sizeof(float);
+
+		soa_ps X[12];
+		soa_ps Y[12];
+		soa_ps Z[12];
+		std::size_t i = 0;
+
+		if (n >= W && !sa)
+		{
+			_load3x4_soa_ps(a, X, 0);
+		}
+
+		if (n >= W && !sb)
+		{
+			_load3x4_soa_ps(b, Y, 0);
+		}
+
+		for (; i + W <= n; i += W)
+		{
+			if (sa)
+			{
+				_load3x4_soa_ps(a + i, X);
+			}
+
+			if (sb)
+			{
+				_load3x4_soa_ps(b + i, Y);
+			}
+
+			_multiply_soa<3, 3, 4, 4>(X, Y, Z);
+
+			for (auto r = 0; r < 3; r++)
+			{
+				Z[r * 4 + 3] = _soa_add(Z[r * 4 + 3], X[r * 4 + 3]); // translation
+			}
+
+			_store3x4_soa_ps(dst + i, Z);
+		}
+
+		auto const T = _mm_castsi128_ps(_mm_set_epi32(-1, 0, 0, 0));
+
+		for (; i < n; i++)
+		{
+			auto const A0 = _mm_loadu_ps(a[i * sa].data[0].data);
+			auto const A1 = _mm_loadu_ps(a[i * sa].data[1].data);
+			auto const A2 = _mm_loadu_ps(a[i * sa].data[2].data);
+			auto const B0 = _mm_loadu_ps(b[i * sb].data[0].data);
+			auto const B1 = _mm_loadu_ps(b[i * sb].data[1].data);
+			auto const B2 = _mm_loadu_ps(b[i * sb].data[2].data);
+
+			//
+			// the implied row (0, 0, 0, 1) of b only picks up the translation of a
+			//
+
+			_mm_storeu_ps(dst[i].data[0].data, _mm_add_ps(_m3x3_mul_ps(A0, B0, B1, B2), _mm_and_ps(A0, T)));
+			_mm_storeu_ps(dst[i].data[1].data, _mm_add_ps(_m3x3_mul_ps(A1, B0, B1, B2), _mm_and_ps(A1, T)));
+			_mm_storeu_ps(dst[i].data[2].data, _mm_add_ps(_m3x3_mul_ps(A2, B0, B1, B2), _mm_and_ps(A2, T)));
+		}
+	}
+
+	inline void _multiply_batch(TMatrix4x4<float> *dst,
+				    TMatrix4x4<float> const *a, std::size_t sa,
+				    TMatrix4x4<float> const *b, std::size_t sb, std::size_t n) noexcept
+	{
+		constexpr std::size_t W = sizeof(soa_ps) / sizeof(float);
+
+		soa_ps X[16];
+		soa_ps Y[16];
+		soa_ps Z[16];
+		std::size_t i = 0;
+
+		if (n >= W && !sa)
+		{
+			_load4x4_soa_ps(a, X, 0);
+		}
+
+		if (n >= W && !sb)
+		{
+			_load4x4_soa_ps(b, Y, 0);
+		}
+
+		for (; i + W <= n; i += W)
+		{
+			if (sa)
+			{
+				_load4x4_soa_ps(a + i, X);
+			}
+
+			if (sb)
+			{
+				_load4x4_soa_ps(b + i, Y);
+			}
+
+			_multiply_soa<4, 4, 4>(X, Y, Z);
+
+			_store4x4_soa_ps(dst + i, Z);
+		}
+
+		for (; i < n; i++)
+		{
+			auto const A0 = _mm_loadu_ps(a[i * sa].data[0].data);
+			auto const A1 = _mm_loadu_ps(a[i * sa].data[1].data);
+			auto const A2 = _mm_loadu_ps(a[i * sa].data[2].data);
+			auto const A3 = _mm_loadu_ps(a[i * sa].data[3].data);
+			auto const B0 = _mm_loadu_ps(b[i * sb].data[0].data);
+			auto const B1 = _mm_loadu_ps(b[i * sb].data[1].data);
+			auto const B2 = _mm_loadu_ps(b[i * sb].data[2].data);
+			auto const B3 = _mm_loadu_ps(b[i * sb].data[3].data);
+
+			_mm_storeu_ps(dst[i].data[0].data, _m4x4_mul_ps(A0, B0, B1, B2, B3));
+			_mm_storeu_ps(dst[i].data[1].data, _m4x4_mul_ps(A1, B0, B1, B2, B3));
+			_mm_storeu_ps(dst[i].data[2].data, _m4x4_mul_ps(A2, B0, B1, B2, B3));
+			_mm_storeu_ps(dst[i].data[3].data, _m4x4_mul_ps(A3, B0, B1, B2, B3));
+		}
+	}
+
+#ifdef __AVX__
+	inline void _multiply_batch(TMatrix3x4<double> *dst,
+				    TMatrix3x4<double> const *a, std::size_t sa,
+				    TMatrix3x4<double> const *b, std::size_t sb, std::size_t n) noexcept
+	{
+		constexpr std::size_t W = 4;
+
+		__m256d X[12];
+		__m256d Y[12];
+		__m256d Z[12];
+		std::size_t i = 0;
+
+		if (n >= W && !sa)
+		{
+			_load3x4_soa_pd(a, X, 0);
+		}
+
+		if (n >= W && !sb)
+		{
+			_load3x4_soa_pd(b, Y, 0);
+		}
+
+		for (; i + W <= n; i += W)
+		{
+			if (sa)
+			{
+				_load3x4_soa_pd(a + i, X);
+			}
+
+			if (sb)
+			{
+				_load3x4_soa_pd(b + i, Y);
+			}
+
+			_multiply_soa<3, 3, 4, 4>(X, Y, Z);
+
+			for (auto r = 0; r < 3; r++)
+			{
+				Z[r * 4 + 3] = _soa_add(Z[r * 4 + 3], X[r * 4 + 3]); // translation
+			}
+
+			_store3x4_soa_pd(dst + i, Z);
+		}
+
+		auto const nil = _mm256_setzero_pd();
+
+		for (; i < n; i++)
+		{
+			auto const l = a[i * sa];
+
+			auto const B0 = _mm256_loadu_pd(b[i * sb].data[0].data);
+			auto const B1 = _mm256_loadu_pd(b[i * sb].data[1].data);
+			auto const B2 = _mm256_loadu_pd(b[i * sb].data[2].data);
+
+			for (auto j = 0; j < 3; j++)
+			{
+				auto const A = _mm256_mul_pd(_mm256_broadcast_sd(l.data[j].data + 0), B0);
+				auto const B = _mm256_mul_pd(_mm256_broadcast_sd(l.data[j].data + 1), B1);
+				auto const C = _mm256_mul_pd(_mm256_broadcast_sd(l.data[j].data + 2), B2);
+				auto const D = _mm256_blend_pd(nil, _mm256_loadu_pd(l.data[j].data), 0b1000); // translation
+
+				_mm256_storeu_pd(dst[i].data[j].data, _mm256_add_pd(_mm256_add_pd(A, C), _mm256_add_pd(B, D)));
+			}
+		}
+	}
+
+	inline void _multiply_batch(TMatrix4x4<double> *dst,
+				    TMatrix4x4<double> const *a, std::size_t sa,
+				    TMatrix4x4<double> const *b, std::size_t sb, std::size_t n) noexcept
+	{
+		constexpr std::size_t W = 4;
+
+		__m256d X[16];
+		__m256d Y[16];
+		__m256d Z[16];
+		std::size_t i = 0;
+
+		if (n >= W && !sa)
+		{
+			_load4x4_soa_pd(a, X, 0);
+		}
+
+		if (n >= W && !sb)
+		{
+			_load4x4_soa_pd(b, Y, 0);
+		}
+
+		for (; i + W <= n; i += W)
+		{
+			if (sa)
+			{
+				_load4x4_soa_pd(a + i, X);
+			}
+
+			if (sb)
+			{
+				_load4x4_soa_pd(b + i, Y);
+			}
+
+			_multiply_soa<4, 4, 4>(X, Y, Z);
+
+			_store4x4_soa_pd(dst + i, Z);
+		}
+
+		for (; i < n; i++)
+		{
+			auto const l = a[i * sa];
+
+			auto const B0 = _mm256_loadu_pd(b[i * sb].data[0].data);
+			auto const B1 = _mm256_loadu_pd(b[i * sb].data[1].data);
+			auto const B2 = _mm256_loadu_pd(b[i * sb].data[2].data);
+			auto const B3 = _mm256_loadu_pd(b[i * sb].data[3].data);
+
+			for (auto j = 0; j < 4; j++)
+			{
+				auto const A = _mm256_mul_pd(_mm256_broadcast_sd(l.data[j].data + 0), B0);
+				auto const B = _mm256_mul_pd(_mm256_broadcast_sd(l.data[j].data + 1), B1);
+				auto const C = _mm256_mul_pd(_mm256_broadcast_sd(l.data[j].data + 2), B2);
+				auto const D = _mm256_mul_pd(_mm256_broadcast_sd(l.data[j].data + 3), B3);
+
+				_mm256_storeu_pd(dst[i].data[j].data, _mm256_add_pd(_mm256_add_pd(A, C), _mm256_add_pd(B, D)));
+			}
+		}
+	}
+#else
+	inline void _multiply_batch(TMatrix3x4<double> *dst,
+				    TMatrix3x4<double> const *a, std::size_t sa,
+				    TMatrix3x4<double> const *b, std::size_t sb, std::size_t n) noexcept
+	{
+		auto const nil = _mm_setzero_pd();
+
+		for (std::size_t i = 0; i < n; i++)
+		{
+			auto const l = a[i * sa];
+
+			auto const B0 = _mm_loadu_pd(b[i * sb].data[0].data + 0); // xy
+			auto const B1 = _mm_loadu_pd(b[i * sb].data[1].data + 0); // xy
+			auto const B2 = _mm_loadu_pd(b[i * sb].data[2].data + 0); // xy
+			auto const D0 = _mm_loadu_pd(b[i * sb].data[0].data + 2); // zw
+			auto const D1 = _mm_loadu_pd(b[i * sb].data[1].data + 2); // zw
+			auto const D2 = _mm_loadu_pd(b[i * sb].data[2].data + 2); // zw
+
+			for (auto j = 0; j < 3; j++)
+			{
+				auto const T = _mm_move_sd(_mm_loadu_pd(l.data[j].data + 2), nil); // translation, 0w
+
+				_mm_storeu_pd(dst[i].data[j].data + 0, _m3_mul_pd(l.data[j].data, B0, B1, B2));
+				_mm_storeu_pd(dst[i].data[j].data + 2, _mm_add_pd(_m3_mul_pd(l.data[j].data, D0, D1, D2), T));
+			}
+		}
+	}
+
+	inline void _multiply_batch(TMatrix4x4<double> *dst,
+				    TMatrix4x4<double> const *a, std::size_t sa,
+				    TMatrix4x4<double> const *b, std::size_t sb, std::size_t n) noexcept
+	{
+		for (std::size_t i = 0; i < n; i++)
+		{
+			auto const l = a[i * sa];
+
+			auto const B0 = _mm_loadu_pd(b[i * sb].data[0].data + 0); // xy
+			auto const B1 = _mm_loadu_pd(b[i * sb].data[1].data + 0); // xy
+			auto const B2 = _mm_loadu_pd(b[i * sb].data[2].data + 0); // xy
+			auto const B3 = _mm_loadu_pd(b[i * sb].data[3].data + 0); // xy
+			auto const D0 = _mm_loadu_pd(b[i * sb].data[0].data + 2); // zw
+			auto const D1 = _mm_loadu_pd(b[i * sb].data[1].data + 2); // zw
+			auto const D2 = _mm_loadu_pd(b[i * sb].data[2].data + 2); // zw
+			auto const D3 = _mm_loadu_pd(b[i * sb].data[3].data + 2); // zw
+
+			for (auto j = 0; j < 4; j++)
+			{
+				_mm_storeu_pd(dst[i].data[j].data + 0, _m4_mul_pd(l.data[j].data, B0, B1, B2, B3));
+				_mm_storeu_pd(dst[i].data[j].data + 2, _m4_mul_pd(l.data[j].data, D0, D1, D2, D3));
+			}
+		}
+	}
+#endif
+
+	// ----------------------------------------------------------------- //
+
+	inline void multiply_batch(TMatrix2x2<float> *dst,
+				   TMatrix2x2<float> const *a,
+				   TMatrix2x2<float> const *b, std::size_t n) noexcept
+	{
+		_multiply_batch(dst, a, 1, b, 1, n);
+	}
+
+	inline void multiply_batch(TMatrix2x2<float> *dst,
+				   TMatrix2x2<float> const &a,
+				   TMatrix2x2<float> const *b, std::size_t n) noexcept
+	{
+		_multiply_batch(dst, &a, 0, b, 1, n);
+	}
+
+	inline void multiply_batch(TMatrix2x2<float> *dst,
+				   TMatrix2x2<float> const *a,
+				   TMatrix2x2<float> const &b, std::size_t n) noexcept
+	{
+		_multiply_batch(dst, a, 1, &b, 0, n);
+	}
+
+	inline void multiply_batch(TMatrix2x2<double> *dst,
+				   TMatrix2x2<double> const *a,
+				   TMatrix2x2<double> const *b, std::size_t n) noexcept
+	{
+		_multiply_batch(dst, a, 1, b, 1, n);
+	}
+
+	inline void multiply_batch(TMatrix2x2<double> *dst,
+				   TMatrix2x2<double> const &a,
+				   TMatrix2x2<double> const *b, std::size_t n) noexcept
+	{
+		_multiply_batch(dst, &a, 0, b, 1, n);
+	}
+
+	inline void multiply_batch(TMatrix2x2<double> *dst,
+				   TMatrix2x2<double> const *a,
+				   TMatrix2x2<double> const &b, std::size_t n) noexcept
+	{
+		_multiply_batch(dst, a, 1, &b, 0, n);
+	}
+
+	inline void multiply_batch(TMatrix3x3<float> *dst,
+				   TMatrix3x3<float> const *a,
+				   TMatrix3x3<float> const *b, std::size_t n) noexcept
+	{
+		_multiply_batch(dst, a, 1, b, 1, n);
+	}
+
+	inline void multiply_batch(TMatrix3x3<float> *dst,
+				   TMatrix3x3<float> const &a,
+				   TMatrix3x3<float> const *b, std::size_t n) noexcept
+	{
+		_multiply_batch(dst, &a, 0, b, 1, n);
+	}
+
+	inline void multiply_batch(TMatrix3x3<float> *dst,
+				   TMatrix3x3<float> const *a,
+				   TMatrix3x3<float> const &b, std::size_t n) noexcept
+	{
+		_multiply_batch(dst, a, 1, &b, 0, n);
+	}
+
+	inline void multiply_batch(TMatrix3x3<double> *dst,
+				   TMatrix3x3<double> const *a,
+				   TMatrix3x3<double> const *b, std::size_t n) noexcept
+	{
+		_multiply_batch(dst, a, 1, b, 1, n);
+	}
+
+	inline void multiply_batch(TMatrix3x3<double> *dst,
+				   TMatrix3x3<double> const &a,
+				   TMatrix3x3<double> const *b, std::size_t n) noexcept
+	{
+		_multiply_batch(dst, &a, 0, b, 1, n);
+	}
+
+	inline void multiply_batch(TMatrix3x3<double> *dst,
+				   TMatrix3x3<double> const *a,
+				   TMatrix3x3<double> const &b, std::size_t n) noexcept
+	{
+		_multiply_batch(dst, a, 1, &b, 0, n);
+	}
+
+	inline void multiply_batch(TMatrix3x4<float> *dst,
+				   TMatrix3x4<float> const *a,
+				   TMatrix3x4<float> const *b, std::size_t n) noexcept
+	{
+		_multiply_batch(dst, a, 1, b, 1, n);
+	}
+
+	inline void multiply_batch(TMatrix3x4<float> *dst,
+				   TMatrix3x4<float> const &a,
+				   TMatrix3x4<float> const *b, std::size_t n) noexcept
+	{
+		_multiply_batch(dst, &a, 0, b, 1, n);
+	}
+
+	inline void multiply_batch(TMatrix3x4<float> *dst,
+				   TMatrix3x4<float> const *a,
+				   TMatrix3x4<float> const &b, std::size_t n) noexcept
+	{
+		_multiply_batch(dst, a, 1, &b, 0, n);
+	}
+
+	inline void multiply_batch(TMatrix3x4<double> *dst,
+				   TMatrix3x4<double> const *a,
+				   TMatrix3x4<double> const *b, std::size_t n) noexcept
+	{
+		_multiply_batch(dst, a, 1, b, 1, n);
+	}
+
+	inline void multiply_batch(TMatrix3x4<double> *dst,
+				   TMatrix3x4<double> const &a,
+				   TMatrix3x4<double> const *b, std::size_t n) noexcept
+	{
+		_multiply_batch(dst, &a, 0, b, 1, n);
+	}
+
+	inline void multiply_batch(TMatrix3x4<double> *dst,
+				   TMatrix3x4<double> const *a,
+				   TMatrix3x4<double> const &b, std::size_t n) noexcept
+	{
+		_multiply_batch(dst, a, 1, &b, 0, n);
+	}
+
+	inline void multiply_batch(TMatrix4x4<float> *dst,
+				   TMatrix4x4<float> const *a,
+				   TMatrix4x4<float> const *b, std::size_t n) noexcept
+	{
+		_multiply_batch(dst, a, 1, b, 1, n);
+	}
+
+	inline void multiply_batch(TMatrix4x4<float> *dst,
+				   TMatrix4x4<float> const &a,
+				   TMatrix4x4<float> const *b, std::size_t n) noexcept
+	{
+		_multiply_batch(dst, &a, 0, b, 1, n);
+	}
+
+	inline void multiply_batch(TMatrix4x4<float> *dst,
+				   TMatrix4x4<float> const *a,
+				   TMatrix4x4<float> const &b, std::size_t n) noexcept
+	{
+		_multiply_batch(dst, a, 1, &b, 0, n);
+	}
+
+	inline void multiply_batch(TMatrix4x4<double> *dst,
+				   TMatrix4x4<double> const *a,
+				   TMatrix4x4<double> const *b, std::size_t n) noexcept
+	{
+		_multiply_batch(dst, a, 1, b, 1, n);
+	}
+
+	inline void multiply_batch(TMatrix4x4<double> *dst,
+				   TMatrix4x4<double> const &a,
+				   TMatrix4x4<double> const *b, std::size_t n) noexcept
+	{
+		_multiply_batch(dst, &a, 0, b, 1, n);
+	}
+
+	inline void multiply_batch(TMatrix4x4<double> *dst,
+				   TMatrix4x4<double> const *a,
+				   TMatrix4x4<double> const &b, std::size_t n) noexcept
+	{
+		_multiply_batch(dst, a, 1, &b, 0, n);
+	}
+}
+
+// ------------------------------------------------------------------------- //
+
+namespace micro::math::simd
+{
+	//
+	// The batched inverses work on four matrices at a time in SoA form, m[k]
+	// holds element k of the four matrices, one per lane, so the scalar
+	// cofactor expansion runs unchanged across the lanes. With AVX the same
+	// expansion first runs on eight matrices in __m256 registers.
+	//
+
+	inline __m128 __vectorcall _fms_ps(__m128 const a,
+					   __m128 const b,
+					   __m128 const c,
+					   __m128 const d) noexcept
+	{
+		return _mm_sub_ps(_mm_mul_ps(a, b), _mm_mul_ps(c, d));
+	}
+
+	/**
+	 * @return a * x - b * y + c * z
+	 */
+	inline __m128 __vectorcall _m3_ps(__m128 const a, __m128 const x,
+					  __m128 const b, __m128 const y,
+					  __m128 const c, __m128 const z) noexcept
+	{
+		return _mm_add_ps(_mm_sub_ps(_mm_mul_ps(a, x), _mm_mul_ps(b, y)), _mm_mul_ps(c, z));
+	}
+
+	/**
+	 * @brief Writes det(src[i]) == 0 of four lanes
+	 */
+	inline void __vectorcall _singular_ps(bool *dst, __m128 const d) noexcept
+	{
+		auto const mask = _mm_movemask_ps(_mm_cmpeq_ps(d, _mm_setzero_ps()));
+
+		dst[0] = (mask & 1) != 0;
+		dst[1] = (mask & 2) != 0;
+		dst[2] = (mask & 4) != 0;
+		dst[3] = (mask & 8) != 0;
+	}
+
+#ifdef __AVX__
+	inline __m256 __vectorcall _fms_ps(__m256 const a,
+					   __m256 const b,
+					   __m256 const c,
+					   __m256 const d) noexcept
+	{
+		return _mm256_sub_ps(_mm256_mul_ps(a, b), _mm256_mul_ps(c, d));
+	}
+
+	inline __m256 __vectorcall _m3_ps(__m256 const a, __m256 const x,
+					  __m256 const b, __m256 const y,
+					  __m256 const c, __m256 const z) noexcept
+	{
+		return _mm256_add_ps(_mm256_sub_ps(_mm256_mul_ps(a, x), _mm256_mul_ps(b, y)), _mm256_mul_ps(c, z));
+	}
+
+	inline void __vectorcall _singular_ps(bool *dst, __m256 const d) noexcept
+	{
+		auto const mask = _mm256_movemask_ps(_mm256_cmp_ps(d, _mm256_setzero_ps(), _CMP_EQ_OQ));
+
+		for (auto k = 0; k < 8; k++)
+		{
+			dst[k] = (mask & (1 << k)) != 0;
+		}
+	}
+#endif
+
+	// ----------------------------- 2 x 2 ----------------------------- //
+
+	inline void det_batch(float *dst,
+			      TMatrix2x2<float> const *src, std::size_t n) noexcept
+	{
+		std::size_t i = 0;
+
+#ifdef __AVX__
+		for (; i + 8 <= n; i += 8)
+		{
+			__m256 m[4];
+
+			_load2x2_soa_ps(src + i, m);
+			_mm256_storeu_ps(dst + i, _fms_ps(m[0], m[3], m[1], m[2]));
+		}
+#endif
+
+		for (; i + 4 <= n; i += 4)
+		{
+			__m128 m[4];
+
+			_load2x2_soa_ps(src + i, m);
+			_mm_storeu_ps(dst + i, _fms_ps(m[0], m[3], m[1], m[2]));
+		}
+
+		micro::math::det_batch<float>(dst + i, src + i, n - i);
+	}
+
+	inline void inverse_batch(TMatrix2x2<float> *dst,
+				  TMatrix2x2<float> const *src, std::size_t n, bool *singular = nullptr) noexcept
+	{
+		std::size_t i = 0;
+
+#ifdef __AVX__
+		for (; i + 8 <= n; i += 8)
+		{
+			__m256 m[4];
+			__m256 r[4];
+
+			_load2x2_soa_ps(src + i, m);
+
+			auto const D = _fms_ps(m[0], m[3], m[1], m[2]);
+			auto const R = _mm256_div_ps(_mm256_set1_ps(1.f), D);
+			auto const N = _mm256_sub_ps(_mm256_setzero_ps(), R);
+
+			if (singular)
+			{
+				_singular_ps(singular + i, D);
+			}
+
+			r[0] = _mm256_mul_ps(m[3], R);
+			r[1] = _mm256_mul_ps(m[1], N);
+			r[2] = _mm256_mul_ps(m[2], N);
+			r[3] = _mm256_mul_ps(m[0], R);
+
+			_store2x2_soa_ps(dst + i, r);
+		}
+#endif
+
+		for (; i + 4 <= n; i += 4)
+		{
+			__m128 m[4];
+
+			_load2x2_soa_ps(src + i, m);
+
+			auto const D = _fms_ps(m[0], m[3], m[1], m[2]);
+			auto const R = _mm_div_ps(_mm_set1_ps(1.f), D);
+			auto const N = _mm_sub_ps(_mm_setzero_ps(), R);
+
+			if (singular)
+			{
+				_singular_ps(singular + i, D);
+			}
+
+			auto A = _mm_mul_ps(m[3], R);
+			auto B = _mm_mul_ps(m[1], N);
+			auto C = _mm_mul_ps(m[2], N);
+			auto E = _mm_mul_ps(m[0], R);
+
+			_MM_TRANSPOSE4_PS(A, B, C, E);
+
+			_mm_storeu_ps(reinterpret_cast<float *>(dst + i + 0), A);
+			_mm_storeu_ps(reinterpret_cast<float *>(dst + i + 1), B);
+			_mm_storeu_ps(reinterpret_cast<float *>(dst + i + 2), C);
+			_mm_storeu_ps(reinterpret_cast<float *>(dst + i + 3), E);
+		}
+
+		micro::math::inverse_batch<float>(dst + i, src + i, n - i, singular ? singular + i : nullptr);
+	}
+
+	// ----------------------------- 3 x 3 ----------------------------- //
+
+	inline void det_batch(float *dst,
+			      TMatrix3x3<float> const *src, std::size_t n) noexcept
+	{
+		std::size_t i = 0;
+
+#ifdef __AVX__
+		for (; i + 8 <= n; i += 8)
+		{
+			__m256 m[9];
+
+			_load3x3_soa_ps(src + i, m);
+
+			auto const A = _fms_ps(m[4], m[8], m[5], m[7]);
+			auto const B = _fms_ps(m[5], m[6], m[3], m[8]);
+			auto const C = _fms_ps(m[3], m[7], m[4], m[6]);
+
+			_mm256_storeu_ps(dst + i, _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(m[0], A), _mm256_mul_ps(m[1], B)), _mm256_mul_ps(m[2], C)));
+		}
+#endif
+
+		for (; i + 4 <= n; i += 4)
+		{
+			__m128 m[9];
+
+			_load3x3_soa_ps(src + i, m);
+
+			auto const A = _fms_ps(m[4], m[8], m[5], m[7]);
+			auto const B = _fms_ps(m[5], m[6], m[3], m[8]);
+			auto const C = _fms_ps(m[3], m[7], m[4], m[6]);
+
+			_mm_storeu_ps(dst + i, _mm_add_ps(_mm_add_ps(_mm_mul_ps(m[0], A), _mm_mul_ps(m[1], B)), _mm_mul_ps(m[2], C)));
+		}
+
+		micro::math::det_batch<float>(dst + i, src + i, n - i);
+	}
+
+	inline void inverse_batch(TMatrix3x3<float> *dst,
+				  TMatrix3x3<float> const *src, std::size_t n, bool *singular = nullptr) noexcept
+	{
+		std::size_t i = 0;
+
+#ifdef __AVX__
+		for (; i + 8 <= n; i += 8)
+		{
+			__m256 m[9];
+			__m256 r[9];
+
+			_load3x3_soa_ps(src + i, m);
+
+			r[0] = _fms_ps(m[4], m[8], m[5], m[7]);
+			r[1] = _fms_ps(m[2], m[7], m[1], m[8]);
+			r[2] = _fms_ps(m[1], m[5], m[2], m[4]);
+			r[3] = _fms_ps(m[5], m[6], m[3], m[8]);
+			r[4] = _fms_ps(m[0], m[8], m[2], m[6]);
+			r[5] = _fms_ps(m[2], m[3], m[0], m[5]);
+			r[6] = _fms_ps(m[3], m[7], m[4], m[6]);
+			r[7] = _fms_ps(m[1], m[6], m[0], m[7]);
+			r[8] = _fms_ps(m[0], m[4], m[1], m[3]);
+
+			auto const D = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(m[0], r[0]), _mm256_mul_ps(m[1], r[3])), _mm256_mul_ps(m[2], r[6]));
+			auto const R = _mm256_div_ps(_mm256_set1_ps(1.f), D);
+
+			if (singular)
+			{
+				_singular_ps(singular + i, D);
+			}
+
+			for (auto k = 0; k < 9; k++)
+			{
+				r[k] = _mm256_mul_ps(r[k], R);
+			}
+
+			_store3x3_soa_ps(dst + i, r);
+		}
+#endif
+
+		for (; i + 4 <= n; i += 4)
+		{
+			__m128 m[9];
+			__m128 r[9];
+
+			_load3x3_soa_ps(src + i, m);
+
+			r[0] = _fms_ps(m[4], m[8], m[5], m[7]);
+			r[1] = _fms_ps(m[2], m[7], m[1], m[8]);
+			r[2] = _fms_ps(m[1], m[5], m[2], m[4]);
+			r[3] = _fms_ps(m[5], m[6], m[3], m[8]);
+			r[4] = _fms_ps(m[0], m[8], m[2], m[6]);
+			r[5] = _fms_ps(m[2], m[3], m[0], m[5]);
+			r[6] = _fms_ps(m[3], m[7], m[4], m[6]);
+			r[7] = _fms_ps(m[1], m[6], m[0], m[7]);
+			r[8] = _fms_ps(m[0], m[4], m[1], m[3]);
+
+			auto const D = _mm_add_ps(_mm_add_ps(_mm_mul_ps(m[0], r[0]), _mm_mul_ps(m[1], r[3])), _mm_mul_ps(m[2], r[6]));
+			auto const R = _mm_div_ps(_mm_set1_ps(1.f), D);
+
+			if (singular)
+			{
+				_singular_ps(singular + i, D);
+			}
+
+			for (auto k = 0; k < 9; k++)
+			{
+				r[k] = _mm_mul_ps(r[k], R);
+			}
+
+			_store3x3_soa_ps(dst + i, r);
+		}
+
+		micro::math::inverse_batch<float>(dst + i, src + i, n - i, singular ? singular + i : nullptr);
+	}
+
+	// ----------------------------- 4 x 4 ----------------------------- //
+
+	/**
+	 * @brief 2x2 minors of the upper (s) and lower (c) two rows of a 4x4 matrix
+	 *
+	 * @return the determinant expanded over the minors
+	 */
+	inline __m128 __vectorcall _m4x4_minors_ps(__m128 const m[16], __m128 s[6], __m128 c[6]) noexcept
+	{
+		s[0] = _fms_ps(m[0], m[5], m[4], m[1]);
+		s[1] = _fms_ps(m[0], m[6], m[4], m[2]);
+		s[2] = _fms_ps(m[0], m[7], m[4], m[3]);
+		s[3] = _fms_ps(m[1], m[6], m[5], m[2]);
+		s[4] = _fms_ps(m[1], m[7], m[5], m[3]);
+		s[5] = _fms_ps(m[2], m[7], m[6], m[3]);
+		c[0] = _fms_ps(m[8], m[13], m[12], m[9]);
+		c[1] = _fms_ps(m[8], m[14], m[12], m[10]);
+		c[2] = _fms_ps(m[8], m[15], m[12], m[11]);
+		c[3] = _fms_ps(m[9], m[14], m[13], m[10]);
+		c[4] = _fms_ps(m[9], m[15], m[13], m[11]);
+		c[5] = _fms_ps(m[10], m[15], m[14], m[11]);
+
+		auto const A = _fms_ps(s[0], c[5], s[1], c[4]);
+		auto const B = _mm_add_ps(_mm_mul_ps(s[2], c[3]), _mm_mul_ps(s[3], c[2]));
+		auto const C = _fms_ps(s[5], c[0], s[4], c[1]);
+
+		return _mm_add_ps(_mm_add_ps(A, C), B);
+	}
+
+#ifdef __AVX__
+	inline __m256 __vectorcall _m4x4_minors_ps(__m256 const m[16], __m256 s[6], __m256 c[6]) noexcept
+	{
+		s[0] = _fms_ps(m[0], m[5], m[4], m[1]);
+		s[1] = _fms_ps(m[0], m[6], m[4], m[2]);
+		s[2] = _fms_ps(m[0], m[7], m[4], m[3]);
+		s[3] = _fms_ps(m[1], m[6], m[5], m[2]);
+		s[4] = _fms_ps(m[1], m[7], m[5], m[3]);
+		s[5] = _fms_ps(m[2], m[7], m[6], m[3]);
+		c[0] = _fms_ps(m[8], m[13], m[12], m[9]);
+		c[1] = _fms_ps(m[8], m[14], m[12], m[10]);
+		c[2] = _fms_ps(m[8], m[15], m[12], m[11]);
+		c[3] = _fms_ps(m[9], m[14], m[13], m[10]);
+		c[4] = _fms_ps(m[9], m[15], m[13], m[11]);
+		c[5] = _fms_ps(m[10], m[15], m[14], m[11]);
+
+		auto const A = _fms_ps(s[0], c[5], s[1], c[4]);
+		auto const B = _mm256_add_ps(_mm256_mul_ps(s[2], c[3]), _mm256_mul_ps(s[3], c[2]));
+		auto const C = _fms_ps(s[5], c[0], s[4], c[1]);
+
+		return _mm256_add_ps(_mm256_add_ps(A, C), B);
+	}
+#endif
+
+	inline void det_batch(float *dst,
+			      TMatrix4x4<float> const *src, std::size_t n) noexcept
+	{
+		std::size_t i = 0;
+
+#ifdef __AVX__
+		for (; i + 8 <= n; i += 8)
+		{
+			__m256 m[16];
+			__m256 s[6];
+			__m256 c[6];
+
+			_load4x4_soa_ps(src + i, m);
+			_mm256_storeu_ps(dst + i, _m4x4_minors_ps(m, s, c));
+		}
+#endif
+
+		for (; i + 4 <= n; i += 4)
+		{
+			__m128 m[16];
+			__m128 s[6];
+			__m128 c[6];
+
+			_load4x4_soa_ps(src + i, m);
+			_mm_storeu_ps(dst + i, _m4x4_minors_ps(m, s, c));
+		}
+
+		micro::math::det_batch<float>(dst + i, src + i, n - i);
+	}
+
+	inline void inverse_batch(TMatrix4x4<float> *dst,
+				  TMatrix4x4<float> const *src, std::size_t n, bool *singular = nullptr) noexcept
+	{
+		std::size_t i = 0;
+
+#ifdef __AVX__
+		for (; i + 8 <= n; i += 8)
+		{
+			__m256 m[16];
+			__m256 r[16];
+			__m256 s[6];
+			__m256 c[6];
+
+			_load4x4_soa_ps(src + i, m);
+
+			auto const D = _m4x4_minors_ps(m, s, c);
+			auto const R = _mm256_div_ps(_mm256_set1_ps(1.f), D);
+			auto const N = _mm256_sub_ps(_mm256_setzero_ps(), R);
+
+			if (singular)
+			{
+				_singular_ps(singular + i, D);
+			}
+
+			r[0] = _mm256_mul_ps(_m3_ps(m[5], c[5], m[6], c[4], m[7], c[3]), R);
+			r[1] = _mm256_mul_ps(_m3_ps(m[1], c[5], m[2], c[4], m[3], c[3]), N);
+			r[2] = _mm256_mul_ps(_m3_ps(m[13], s[5], m[14], s[4], m[15], s[3]), R);
+			r[3] = _mm256_mul_ps(_m3_ps(m[9], s[5], m[10], s[4], m[11], s[3]), N);
+			r[4] = _mm256_mul_ps(_m3_ps(m[4], c[5], m[6], c[2], m[7], c[1]), N);
+			r[5] = _mm256_mul_ps(_m3_ps(m[0], c[5], m[2], c[2], m[3], c[1]), R);
+			r[6] = _mm256_mul_ps(_m3_ps(m[12], s[5], m[14], s[2], m[15], s[1]), N);
+			r[7] = _mm256_mul_ps(_m3_ps(m[8], s[5], m[10], s[2], m[11], s[1]), R);
+			r[8] = _mm256_mul_ps(_m3_ps(m[4], c[4], m[5], c[2], m[7], c[0]), R);
+			r[9] = _mm256_mul_ps(_m3_ps(m[0], c[4], m[1], c[2], m[3], c[0]), N);
+			r[10] = _mm256_mul_ps(_m3_ps(m[12], s[4], m[13], s[2], m[15], s[0]), R);
+			r[11] = _mm256_mul_ps(_m3_ps(m[8], s[4], m[9], s[2], m[11], s[0]), N);
+			r[12] = _mm256_mul_ps(_m3_ps(m[4], c[3], m[5], c[1], m[6], c[0]), N);
+			r[13] = _mm256_mul_ps(_m3_ps(m[0], c[3], m[1], c[1], m[2], c[0]), R);
+			r[14] = _mm256_mul_ps(_m3_ps(m[12], s[3], m[13], s[1], m[14], s[0]), N);
+			r[15] = _mm256_mul_ps(_m3_ps(m[8], s[3], m[9], s[1], m[10], s[0]), R);
+
+			_store4x4_soa_ps(dst + i, r);
+		}
+#endif
+
+		for (; i + 4 <= n; i += 4)
+		{
+			__m128 m[16];
+			__m128 r[16];
+			__m128 s[6];
+			__m128 c[6];
+
+			_load4x4_soa_ps(src + i, m);
+
+			auto const D = _m4x4_minors_ps(m, s, c);
+			auto const R = _mm_div_ps(_mm_set1_ps(1.f), D);
+			auto const N = _mm_sub_ps(_mm_setzero_ps(), R);
+
+			if (singular)
+			{
+				_singular_ps(singular + i, D);
+			}
+
+			r[0] = _mm_mul_ps(_m3_ps(m[5], c[5], m[6], c[4], m[7], c[3]), R);
+			r[1] = _mm_mul_ps(_m3_ps(m[1], c[5], m[2], c[4], m[3], c[3]), N);
+			r[2] = _mm_mul_ps(_m3_ps(m[13], s[5], m[14], s[4], m[15], s[3]), R);
+			r[3] = _mm_mul_ps(_m3_ps(m[9], s[5], m[10], s[4], m[11], s[3]), N);
+			r[4] = _mm_mul_ps(_m3_ps(m[4], c[5], m[6], c[2], m[7], c[1]), N);
+			r[5] = _mm_mul_ps(_m3_ps(m[0], c[5], m[2], c[2], m[3], c[1]), R);
+			r[6] = _mm_mul_ps(_m3_ps(m[12], s[5], m[14], s[2], m[15], s[1]), N);
+			r[7] = _mm_mul_ps(_m3_ps(m[8], s[5], m[10], s[2], m[11], s[1]), R);
+			r[8] = _mm_mul_ps(_m3_ps(m[4], c[4], m[5], c[2], m[7], c[0]), R);
+			r[9] = _mm_mul_ps(_m3_ps(m[0], c[4], m[1], c[2], m[3], c[0]), N);
+			r[10] = _mm_mul_ps(_m3_ps(m[12], s[4], m[13], s[2], m[15], s[0]), R);
+			r[11] = _mm_mul_ps(_m3_ps(m[8], s[4], m[9], s[2], m[11], s[0]), N);
+			r[12] = _mm_mul_ps(_m3_ps(m[4], c[3], m[5], c[1], m[6], c[0]), N);
+			r[13] = _mm_mul_ps(_m3_ps(m[0], c[3], m[1], c[1], m[2], c[0]), R);
+			r[14] = _mm_mul_ps(_m3_ps(m[12], s[3], m[13], s[1], m[14], s[0]), N);
+			r[15] = _mm_mul_ps(_m3_ps(m[8], s[3], m[9], s[1], m[10], s[0]), R);
+
+			_store4x4_soa_ps(dst + i, r);
+		}
+
+		micro::math::inverse_batch<float>(dst + i, src + i, n - i, singular ? singular + i : nullptr);
+	}
+}
+
+// ------------------------------------------------------------------------- //
+
+namespace micro::math::simd
+{
+	inline __m128 __vectorcall _load2_ps(TVector2<float> const &v) noexcept
+	{
+		return _mm_loadl_pi(_mm_setzero_ps(), reinterpret_cast<__m64 const *>(v.data)); // xy00
+	}
+
+	inline void __vectorcall _store2_ps(TVector2<float> &v, __m128 const r) noexcept
+	{
+		_mm_storel_pi(reinterpret_cast<__m64 *>(v.data), r);
+	}
+
+	//
+	// Every float shape is padded to 4 x 4 in registers and goes through a
+	// single _MM_TRANSPOSE4_PS, doubles are transposed in 2 x 2 blocks.
+	//
+
+	inline TMatrix2x2<float> __vectorcall transpose(TMatrix2x2<float> const &m) noexcept
+	{
+		TMatrix2x2<float> r;
+
+		auto const A = _mm_loadu_ps(reinterpret_cast<float const *>(&m)); // abcd
+
+		_mm_storeu_ps(reinterpret_cast<float *>(&r), _mm_shuffle_ps(A, A, _MM_SHUFFLE(3, 1, 2, 0)));
+
+		return r;
+	}
+
+	inline TMatrix3x2<float> __vectorcall transpose(TMatrix2x3<float> const &m) noexcept
+	{
+		TMatrix3x2<float> r;
+
+		auto A = _load3_ps(m.data[0]);
+		auto B = _load3_ps(m.data[1]);
+		auto C = _mm_setzero_ps();
+		auto D = _mm_setzero_ps();
+
+		_MM_TRANSPOSE4_PS(A, B, C, D);
+
+		_store2_ps(r.data[0], A);
+		_store2_ps(r.data[1], B);
+		_store2_ps(r.data[2], C);
+
+		return r;
+	}
+
+	inline TMatrix4x2<float> __vectorcall transpose(TMatrix2x4<float> const &m) noexcept
+	{
+		TMatrix4x2<float> r;
+
+		auto A = _mm_loadu_ps(m.data[0].data);
+		auto B = _mm_loadu_ps(m.data[1].data);
+		auto C = _mm_setzero_ps();
+		auto D = _mm_setzero_ps();
+
+		_MM_TRANSPOSE4_PS(A, B, C, D);
+
+		_store2_ps(r.data[0], A);
+		_store2_ps(r.data[1], B);
+		_store2_ps(r.data[2], C);
+		_store2_ps(r.data[3], D);
+
+		return r;
+	}
+
+	inline TMatrix2x3<float> __vectorcall transpose(TMatrix3x2<float> const &m) noexcept
+	{
+		TMatrix2x3<float> r;
+
+		auto A = _load2_ps(m.data[0]);
+		auto B = _load2_ps(m.data[1]);
+		auto C = _load2_ps(m.data[2]);
+		auto D = _mm_setzero_ps();
+
+		_MM_TRANSPOSE4_PS(A, B, C, D);
+
+		_store3_ps(r.data[0], A);
+		_store3_ps(r.data[1], B);
+
+		return r;
+	}
+
+	inline TMatrix3x3<float> __vectorcall transpose(TMatrix3x3<float> const &m) noexcept
+	{
+		TMatrix3x3<float> r;
+
+		auto A = _load3_ps(m.data[0]);
+		auto B = _load3_ps(m.data[1]);
+		auto C = _load3_ps(m.data[2]);
+		auto D = _mm_setzero_ps();
+
+		_MM_TRANSPOSE4_PS(A, B, C, D);
+
+		_store3_ps(r.data[0], A);
+		_store3_ps(r.data[1], B);
+		_store3_ps(r.data[2], C);
+
+		return r;
+	}
+
+	inline TMatrix4x3<float> __vectorcall transpose(TMatrix3x4<float> const &m) noexcept
+	{
+		TMatrix4x3<float> r;
+
+		auto A = _mm_loadu_ps(m.data[0].data);
+		auto B = _mm_loadu_ps(m.data[1].data);
+		auto C = _mm_loadu_ps(m.data[2].data);
+		auto D = _mm_setzero_ps();
+
+		_MM_TRANSPOSE4_PS(A, B, C, D);
+
+		_store3_ps(r.data[0], A);
+		_store3_ps(r.data[1], B);
+		_store3_ps(r.data[2], C);
+		_store3_ps(r.data[3], D);
+
+		return r;
+	}
+
+	inline TMatrix2x4<float> __vectorcall transpose(TMatrix4x2<float> const &m) noexcept
+	{
+		TMatrix2x4<float> r;
+
+		auto A = _load2_ps(m.data[0]);
+		auto B = _load2_ps(m.data[1]);
+		auto C = _load2_ps(m.data[2]);
+		auto D = _load2_ps(m.data[3]);
+
+		_MM_TRANSPOSE4_PS(A, B, C, D);
+
+		_mm_storeu_ps(r.data[0].data, A);
+		_mm_storeu_ps(r.data[1].data, B);
+
+		return r;
+	}
+
+	inline TMatrix3x4<float> __vectorcall transpose(TMatrix4x3<float> const &m) noexcept
+	{
+		TMatrix3x4<float> r;
+
+		auto A = _load3_ps(m.data[0]);
+		auto B = _load3_ps(m.data[1]);
+		auto C = _load3_ps(m.data[2]);
+		auto D = _load3_ps(m.data[3]);
+
+		_MM_TRANSPOSE4_PS(A, B, C, D);
+
+		_mm_storeu_ps(r.data[0].data, A);
+		_mm_storeu_ps(r.data[1].data, B);
+		_mm_storeu_ps(r.data[2].data, C);
+
+		return r;
+	}
+
+	// ----------------------------------------------------------------- //
+
+	inline TMatrix3x2<double> __vectorcall transpose(TMatrix2x3<double> const &m) noexcept
+	{
+		TMatrix3x2<double> r;
+
+		auto const A = _mm_loadu_pd(m.data[0].data + 0);
+		auto const B = _mm_loadu_pd(m.data[1].data + 0);
+
+		_mm_storeu_pd(r.data[0].data + 0, _mm_unpacklo_pd(A, B));
+		_mm_storeu_pd(r.data[1].data + 0, _mm_unpackhi_pd(A, B));
+
+		auto const C = _mm_loadh_pd(_mm_load_sd(m.data[0].data + 2), m.data[1].data + 2);
+
+		_mm_storeu_pd(r.data[2].data + 0, C);
+
+		return r;
+	}
+
+	inline TMatrix4x2<double> __vectorcall transpose(TMatrix2x4<double> const &m) noexcept
+	{
+		TMatrix4x2<double> r;
+
+		auto const A = _mm_loadu_pd(m.data[0].data + 0);
+		auto const B = _mm_loadu_pd(m.data[1].data + 0);
+
+		_mm_storeu_pd(r.data[0].data + 0, _mm_unpacklo_pd(A, B));
+		_mm_storeu_pd(r.data[1].data + 0, _mm_unpackhi_pd(A, B));
+
+		auto const C = _mm_loadu_pd(m.data[0].data + 2);
+		auto const D = _mm_loadu_pd(m.data[1].data + 2);
+
+		_mm_storeu_pd(r.data[2].data + 0, _mm_unpacklo_pd(C, D));
+		_mm_storeu_pd(r.data[3].data + 0, _mm_unpackhi_pd(C, D));
+
+		return r;
+	}
+
+	inline TMatrix2x3<double> __vectorcall transpose(TMatrix3x2<double> const &m) noexcept
+	{
+		TMatrix2x3<double> r;
+
+		auto const A = _mm_loadu_pd(m.data[0].data + 0);
+		auto const B = _mm_loadu_pd(m.data[1].data + 0);
+
+		_mm_storeu_pd(r.data[0].data + 0, _mm_unpacklo_pd(A, B));
+		_mm_storeu_pd(r.data[1].data + 0, _mm_unpackhi_pd(A, B));
+
+		auto const C = _mm_loadu_pd(m.data[2].data + 0);
+
+		_mm_store_sd(r.data[0].data + 2, C);
+		_mm_storeh_pd(r.data[1].data + 2, C);
+
+		return r;
+	}
+
+	inline TMatrix3x3<double> __vectorcall transpose(TMatrix3x3<double> const &m) noexcept
+	{
+		TMatrix3x3<double> r;
+
+		auto const A = _mm_loadu_pd(m.data[0].data + 0);
+		auto const B = _mm_loadu_pd(m.data[1].data + 0);
+
+		_mm_storeu_pd(r.data[0].data + 0, _mm_unpacklo_pd(A, B));
+		_mm_storeu_pd(r.data[1].data + 0, _mm_unpackhi_pd(A, B));
+
+		auto const C = _mm_loadh_pd(_mm_load_sd(m.data[0].data + 2), m.data[1].data + 2);
+
+		_mm_storeu_pd(r.data[2].data + 0, C);
+
+		auto const D = _mm_loadu_pd(m.data[2].data + 0);
+
+		_mm_store_sd(r.data[0].data + 2, D);
+		_mm_storeh_pd(r.data[1].data + 2, D);
+
+		r.data[2].data[2] = m.data[2].data[2];
+
+		return r;
+	}
+
+	inline TMatrix4x3<double> __vectorcall transpose(TMatrix3x4<double> const &m) noexcept
+	{
+		TMatrix4x3<double> r;
+
+		auto const A = _mm_loadu_pd(m.data[0].data + 0);
+		auto const B = _mm_loadu_pd(m.data[1].data + 0);
+
+		_mm_storeu_pd(r.data[0].data + 0, _mm_unpacklo_pd(A, B));
+		_mm_storeu_pd(r.data[1].data + 0, _mm_unpackhi_pd(A, B));
+
+		auto const C = _mm_loadu_pd(m.data[0].data + 2);
+		auto const D = _mm_loadu_pd(m.data[1].data + 2);
+
+		_mm_storeu_pd(r.data[2].data + 0, _mm_unpacklo_pd(C, D));
+		_mm_storeu_pd(r.data[3].data + 0, _mm_unpackhi_pd(C, D));
+
+		auto const E = _mm_loadu_pd(m.data[2].data + 0);
+
+		_mm_store_sd(r.data[0].data + 2, E);
+		_mm_storeh_pd(r.data[1].data + 2, E);
+
+		auto const F = _mm_loadu_pd(m.data[2].data + 2);
+
+		_mm_store_sd(r.data[2].data + 2, F);
+		_mm_storeh_pd(r.data[3].data + 2, F);
+
+		return r;
+	}
+
+	inline TMatrix2x4<double> __vectorcall transpose(TMatrix4x2<double> const &m) noexcept
+	{
+		TMatrix2x4<double> r;
+
+		auto const A = _mm_loadu_pd(m.data[0].data + 0);
+		auto const B = _mm_loadu_pd(m.data[1].data + 0);
+
+		_mm_storeu_pd(r.data[0].data + 0, _mm_unpacklo_pd(A, B));
+		_mm_storeu_pd(r.data[1].data + 0, _mm_unpackhi_pd(A, B));
+
+		auto const C = _mm_loadu_pd(m.data[2].data + 0);
+		auto const D = _mm_loadu_pd(m.data[3].data + 0);
+
+		_mm_storeu_pd(r.data[0].data + 2, _mm_unpacklo_pd(C, D));
+		_mm_storeu_pd(r.data[1].data + 2, _mm_unpackhi_pd(C, D));
+
+		return r;
+	}
+
+	inline TMatrix3x4<double> __vectorcall transpose(TMatrix4x3<double> const &m) noexcept
+	{
+		TMatrix3x4<double> r;
+
+		auto const A = _mm_loadu_pd(m.data[0].data + 0);
+		auto const B = _mm_loadu_pd(m.data[1].data + 0);
+
+		_mm_storeu_pd(r.data[0].data + 0, _mm_unpacklo_pd(A, B));
+		_mm_storeu_pd(r.data[1].data + 0, _mm_unpackhi_pd(A, B));
+
+		auto const C = _mm_loadh_pd(_mm_load_sd(m.data[0].data + 2), m.data[1].data + 2);
+
+		_mm_storeu_pd(r.data[2].data + 0, C);
+
+		auto const D = _mm_loadu_pd(m.data[2].data + 0);
+		auto const E = _mm_loadu_pd(m.data[3].data + 0);
+
+		_mm_storeu_pd(r.data[0].data + 2, _mm_unpacklo_pd(D, E));
+		_mm_storeu_pd(r.data[1].data + 2, _mm_unpackhi_pd(D, E));
+
+		auto const F = _mm_loadh_pd(_mm_load_sd(m.data[2].data + 2), m.data[3].data + 2);
+
+		_mm_storeu_pd(r.data[2].data + 2, F);
+
+		return r;
+	}
+
+#ifdef __AVX__
+	inline TMatrix4x4<double> __vectorcall transpose(TMatrix4x4<double> const &m) noexcept
+	{
+		TMatrix4x4<double> r;
+
+		auto const A = _mm256_loadu_pd(m.data[0].data);
+		auto const B = _mm256_loadu_pd(m.data[1].data);
+		auto const C = _mm256_loadu_pd(m.data[2].data);
+		auto const D = _mm256_loadu_pd(m.data[3].data);
+		auto const E = _mm256_unpacklo_pd(A, B); // A11 A21 A13 A23
+		auto const F = _mm256_unpackhi_pd(A, B); // A12 A22 A14 A24
+		auto const G = _mm256_unpacklo_pd(C, D); // A31 A41 A33 A43
+		auto const H = _mm256_unpackhi_pd(C, D); // A32 A42 A34 A44
+
+		_mm256_storeu_pd(r.data[0].data, _mm256_permute2f128_pd(E, G, 0x20));
+		_mm256_storeu_pd(r.data[1].data, _mm256_permute2f128_pd(F, H, 0x20));
+		_mm256_storeu_pd(r.data[2].data, _mm256_permute2f128_pd(E, G, 0x31));
+		_mm256_storeu_pd(r.data[3].data, _mm256_permute2f128_pd(F, H, 0x31));
+
+		return r;
+	}
+#else
+	inline TMatrix4x4<double> __vectorcall transpose(TMatrix4x4<double> const &m) noexcept
+	{
+		TMatrix4x4<double> r;
+
+		auto const A = _mm_loadu_pd(m.data[0].data + 0);
+		auto const B = _mm_loadu_pd(m.data[1].data + 0);
+
+		_mm_storeu_pd(r.data[0].data + 0, _mm_unpacklo_pd(A, B));
+		_mm_storeu_pd(r.data[1].data + 0, _mm_unpackhi_pd(A, B));
+
+		auto const C = _mm_loadu_pd(m.data[0].data + 2);
+		auto const D = _mm_loadu_pd(m.data[1].data + 2);
+
+		_mm_storeu_pd(r.data[2].data + 0, _mm_unpacklo_pd(C, D));
+		_mm_storeu_pd(r.data[3].data + 0, _mm_unpackhi_pd(C, D));
+
+		auto const E = _mm_loadu_pd(m.data[2].data + 0);
+		auto const F = _mm_loadu_pd(m.data[3].data + 0);
+
+		_mm_storeu_pd(r.data[0].data + 2, _mm_unpacklo_pd(E, F));
+		_mm_storeu_pd(r.data[1].data + 2, _mm_unpackhi_pd(E, F));
+
+		auto const G = _mm_loadu_pd(m.data[2].data + 2);
+		auto const H = _mm_loadu_pd(m.data[3].data + 2);
+
+		_mm_storeu_pd(r.data[2].data + 2, _mm_unpacklo_pd(G, H));
+		_mm_storeu_pd(r.data[3].data + 2, _mm_unpackhi_pd(G, H));
+
+		return r;
+	}
+#endif
+
+	// ----------------------------------------------------------------- //
+
+	inline void transpose_batch(TMatrix2x2<float> *dst,
+				    TMatrix2x2<float> const *src, std::size_t n) noexcept
+	{
+		for (std::size_t i = 0; i < n; i++)
+		{
+			dst[i] = transpose(src[i]);
+		}
+	}
+
+	inline void transpose_batch(TMatrix3x2<float> *dst,
+				    TMatrix2x3<float> const *src, std::size_t n) noexcept
+	{
+		for (std::size_t i = 0; i < n; i++)
+		{
+			dst[i] = transpose(src[i]);
+		}
+	}
+
+	inline void transpose_batch(TMatrix4x2<float> *dst,
+				    TMatrix2x4<float> const *src, std::size_t n) noexcept
+	{
+		for (std::size_t i = 0; i < n; i++)
+		{
+			dst[i] = transpose(src[i]);
+		}
+	}
+
+	inline void transpose_batch(TMatrix2x3<float> *dst,
+				    TMatrix3x2<float> const *src, std::size_t n) noexcept
+	{
+		for (std::size_t i = 0; i < n; i++)
+		{
+			dst[i] = transpose(src[i]);
+		}
+	}
+
+	inline void transpose_batch(TMatrix3x3<float> *dst,
+				    TMatrix3x3<float> const *src, std::size_t n) noexcept
+	{
+		for (std::size_t i = 0; i < n; i++)
+		{
+			dst[i] = transpose(src[i]);
+		}
+	}
+
+	inline void transpose_batch(TMatrix4x3<float> *dst,
+				    TMatrix3x4<float> const *src, std::size_t n) noexcept
+	{
+		for (std::size_t i = 0; i < n; i++)
+		{
+			dst[i] = transpose(src[i]);
+		}
+	}
+
+	inline void transpose_batch(TMatrix2x4<float> *dst,
+				    TMatrix4x2<float> const *src, std::size_t n) noexcept
+	{
+		for (std::size_t i = 0; i < n; i++)
+		{
+			dst[i] = transpose(src[i]);
+		}
+	}
+
+	inline void transpose_batch(TMatrix3x4<float> *dst,
+				    TMatrix4x3<float> const *src, std::size_t n) noexcept
+	{
+		for (std::size_t i = 0; i < n; i++)
+		{
+			dst[i] = transpose(src[i]);
+		}
+	}
+
+	inline void transpose_batch(TMatrix4x4<float> *dst,
+				    TMatrix4x4<float> const *src, std::size_t n) noexcept
+	{
+		for (std::size_t i = 0; i < n; i++)
+		{
+			dst[i] = transpose(src[i]);
+		}
+	}
+
+	inline void transpose_batch(TMatrix2x2<double> *dst,
+				    TMatrix2x2<double> const *src, std::size_t n) noexcept
+	{
+		for (std::size_t i = 0; i < n; i++)
+		{
+			dst[i] = transpose(src[i]);
+		}
+	}
+
+	inline void transpose_batch(TMatrix3x2<double> *dst,
+				    TMatrix2x3<double> const *src, std::size_t n) noexcept
+	{
+		for (std::size_t i = 0; i < n; i++)
+		{
+			dst[i] = transpose(src[i]);
+		}
+	}
+
+	inline void transpose_batch(TMatrix4x2<double> *dst,
+				    TMatrix2x4<double> const *src, std::size_t n) noexcept
+	{
+		for (std::size_t i = 0; i < n; i++)
+		{
+			dst[i] = transpose(src[i]);
+		}
+	}
+
+	inline void transpose_batch(TMatrix2x3<double> *dst,
+				    TMatrix3x2<double> const *src, std::size_t n) noexcept
+	{
+		for (std::size_t i = 0; i < n; i++)
+		{
+			dst[i] = transpose(src[i]);
+		}
+	}
+
+	inline void transpose_batch(TMatrix3x3<double> *dst,
+				    TMatrix3x3<double> const *src, std::size_t n) noexcept
+	{
+		for (std::size_t i = 0; i < n; i++)
+		{
+			dst[i] = transpose(src[i]);
+		}
+	}
+
+	inline void transpose_batch(TMatrix4x3<double> *dst,
+				    TMatrix3x4<double> const *src, std::size_t n) noexcept
+	{
+		for (std::size_t i = 0; i < n; i++)
+		{
+			dst[i] = transpose(src[i]);
+		}
+	}
+
+	inline void transpose_batch(TMatrix2x4<double> *dst,
+				    TMatrix4x2<double> const *src, std::size_t n) noexcept
+	{
+		for (std::size_t i = 0; i < n; i++)
+		{
+			dst[i] = transpose(src[i]);
+		}
+	}
+
+	inline void transpose_batch(TMatrix3x4<double> *dst,
+				    TMatrix4x3<double> const *src, std::size_t n) noexcept
+	{
+		for (std::size_t i = 0; i < n; i++)
+		{
+			dst[i] = transpose(src[i]);
+		}
+	}
+
+	inline void transpose_batch(TMatrix4x4<double> *dst,
+				    TMatrix4x4<double> const *src, std::size_t n) noexcept
+	{
+		for (std::size_t i = 0; i < n; i++)
+		{
+			dst[i] = transpose(src[i]);
+		}
+	}
+
+	inline void transpose_batch(TMatrix4x4SoA<float> const &dst,
+				    TMatrix4x4<float> const *src, std::size_t n) noexcept
+	{
+		std::size_t i = 0;
+
+		for (; i + 4 <= n; i += 4)
+		{
+			__m128 m[16];
+
+			_load4x4_soa_ps(src + i, m);
+
+			for (auto k = 0; k < 16; k++)
+			{
+				_mm_storeu_ps(dst.data[k] + i, m[k]);
+			}
+		}
+
+		for (; i < n; i++)
+		{
+			for (auto k = 0; k < 16; k++)
+			{
+				dst.data[k][i] = src[i].data[k / 4].data[k % 4];
+			}
+		}
+	}
+
+	inline void transpose_batch(TMatrix4x4<float> *dst,
+				    TMatrix4x4SoA<float const> const &src, std::size_t n) noexcept
+	{
+		std::size_t i = 0;
+
+		for (; i + 4 <= n; i += 4)
+		{
+			__m128 m[16];
+
+			for (auto k = 0; k < 16; k++)
+			{
+				m[k] = _mm_loadu_ps(src.data[k] + i);
+			}
+
+			_store4x4_soa_ps(dst + i, m);
+		}
+
+		for (; i < n; i++)
+		{
+			for (auto k = 0; k < 16; k++)
+			{
+				dst[i].data[k / 4].data[k % 4] = src.data[k][i];
+			}
+		}
+	}
+}
+
+// ------------------------------------------------------------------------- //
+
+namespace micro::math::simd
+{
+	//
+	// Column-major matrices multiply a vector by broadcasting its components
+	// against the columns, no horizontal adds are needed.
+	//
+
+	inline TVector4<float> __vectorcall operator*(TMatrix4x4<float, ColumnMajor> const &m,
+						      TVector4<float> const &v) noexcept
+	{
+		TVector4<float> r;
+
+		auto const A = _mm_loadu_ps(m.data[0].data);
+		auto const B = _mm_loadu_ps(m.data[1].data);
+		auto const C = _mm_loadu_ps(m.data[2].data);
+		auto const D = _mm_loadu_ps(m.data[3].data);
+
+		_mm_storeu_ps(r.data, _m4x4_mul_ps(_mm_loadu_ps(v.data), A, B, C, D));
+
+		return r;
+	}
+
+	inline TMatrix4x4<float, ColumnMajor> operator*(TMatrix4x4<float, ColumnMajor> const &a,
+							TMatrix4x4<float, ColumnMajor> const &b) noexcept
+	{
+		TMatrix4x4<float, ColumnMajor> r;
+
+		auto const A0 = _mm_loadu_ps(a.data[0].data);
+		auto const A1 = _mm_loadu_ps(a.data[1].data);
+		auto const A2 = _mm_loadu_ps(a.data[2].data);
+		auto const A3 = _mm_loadu_ps(a.data[3].data);
+		auto const B0 = _mm_loadu_ps(b.data[0].data);
+		auto const B1 = _mm_loadu_ps(b.data[1].data);
+		auto const B2 = _mm_loadu_ps(b.data[2].data);
+		auto const B3 = _mm_loadu_ps(b.data[3].data);
+
+		_mm_storeu_ps(r.data[0].data, _m4x4_mul_ps(B0, A0, A1, A2, A3));
+		_mm_storeu_ps(r.data[1].data, _m4x4_mul_ps(B1, A0, A1, A2, A3));
+		_mm_storeu_ps(r.data[2].data, _m4x4_mul_ps(B2, A0, A1, A2, A3));
+		_mm_storeu_ps(r.data[3].data, _m4x4_mul_ps(B3, A0, A1, A2, A3));
+
+		return r;
+	}
+
+	inline void transform_batch(TVector4<float> *dst,
+				    TMatrix4x4<float, ColumnMajor> const &m,
+				    TVector4<float> const *src, std::size_t n) noexcept
+	{
+		auto const A = _mm_loadu_ps(m.data[0].data);
+		auto const B = _mm_loadu_ps(m.data[1].data);
+		auto const C = _mm_loadu_ps(m.data[2].data);
+		auto const D = _mm_loadu_ps(m.data[3].data);
+
+		for (std::size_t i = 0; i < n; i++)
+		{
+			_mm_storeu_ps(dst[i].data, _m4x4_mul_ps(_mm_loadu_ps(src[i].data), A, B, C, D));
+		}
+	}
+
+	// ----------------------------------------------------------------- //
+
+#ifdef __AVX__
+	inline TVector4<double> __vectorcall operator*(TMatrix4x4<double, ColumnMajor> const &m,
+						       TVector4<double> const &v) noexcept
+	{
+		TVector4<double> r;
+
+		auto const A = _mm256_loadu_pd(m.data[0].data);
+		auto const B = _mm256_loadu_pd(m.data[1].data);
+		auto const C = _mm256_loadu_pd(m.data[2].data);
+		auto const D = _mm256_loadu_pd(m.data[3].data);
+
+		_mm256_storeu_pd(r.data, _m4x4_mul_pd(_mm256_loadu_pd(v.data), A, B, C, D));
+
+		return r;
+	}
+
+	inline TMatrix4x4<double, ColumnMajor> operator*(TMatrix4x4<double, ColumnMajor> const &a,
+							 TMatrix4x4<double, ColumnMajor> const &b) noexcept
+	{
+		TMatrix4x4<double, ColumnMajor> r;
+
+		auto const A0 = _mm256_loadu_pd(a.data[0].data);
+		auto const A1 = _mm256_loadu_pd(a.data[1].data);
+		auto const A2 = _mm256_loadu_pd(a.data[2].data);
+		auto const A3 = _mm256_loadu_pd(a.data[3].data);
+
+		for (auto j = 0; j < 4; j++)
+		{
+			_mm256_storeu_pd(r.data[j].data, _m4x4_mul_pd(_mm256_loadu_pd(b.data[j].data), A0, A1, A2, A3));
+		}
+
+		return r;
+	}
+
+	inline void transform_batch(TVector4<double> *dst,
+				    TMatrix4x4<double, ColumnMajor> const &m,
+				    TVector4<double> const *src, std::size_t n) noexcept
+	{
+		auto const A = _mm256_loadu_pd(m.data[0].data);
+		auto const B = _mm256_loadu_pd(m.data[1].data);
+		auto const C = _mm256_loadu_pd(m.data[2].data);
+		auto const D = _mm256_loadu_pd(m.data[3].data);
+
+		for (std::size_t i = 0; i < n; i++)
+		{
+			_mm256_storeu_pd(dst[i].data, _m4x4_mul_pd(_mm256_loadu_pd(src[i].data), A, B, C, D));
+		}
+	}
+#else
+	inline TVector4<double> __vectorcall operator*(TMatrix4x4<double, ColumnMajor> const &m,
+						       TVector4<double> const &v) noexcept
+	{
+		TVector4<double> r;
+
+		auto const A = _mm_loadu_pd(m.data[0].data + 0); // xy
+		auto const B = _mm_loadu_pd(m.data[1].data + 0); // xy
+		auto const C = _mm_loadu_pd(m.data[2].data + 0); // xy
+		auto const D = _mm_loadu_pd(m.data[3].data + 0); // xy
+		auto const E = _mm_loadu_pd(m.data[0].data + 2); // zw
+		auto const F = _mm_loadu_pd(m.data[1].data + 2); // zw
+		auto const G = _mm_loadu_pd(m.data[2].data + 2); // zw
+		auto const H = _mm_loadu_pd(m.data[3].data + 2); // zw
+
+		_mm_storeu_pd(r.data + 0, _m4_mul_pd(v.data, A, B, C, D));
+		_mm_storeu_pd(r.data + 2, _m4_mul_pd(v.data, E, F, G, H));
+
+		return r;
+	}
+
+	inline TMatrix4x4<double, ColumnMajor> operator*(TMatrix4x4<double, ColumnMajor> const &a,
+							 TMatrix4x4<double, ColumnMajor> const &b) noexcept
+	{
+		TMatrix4x4<double, ColumnMajor> r;
+
+		for (auto j = 0; j < 4; j++)
+		{
+			r.data[j] = a * b.data[j];
+		}
+
+		return r;
+	}
+
+	inline void transform_batch(TVector4<double> *dst,
+				    TMatrix4x4<double, ColumnMajor> const &m,
+				    TVector4<double> const *src, std::size_t n) noexcept
+	{
+		auto const A = _mm_loadu_pd(m.data[0].data + 0); // xy
+		auto const B = _mm_loadu_pd(m.data[1].data + 0); // xy
+		auto const C = _mm_loadu_pd(m.data[2].data + 0); // xy
+		auto const D = _mm_loadu_pd(m.data[3].data + 0); // xy
+		auto const E = _mm_loadu_pd(m.data[0].data + 2); // zw
+		auto const F = _mm_loadu_pd(m.data[1].data + 2); // zw
+		auto const G = _mm_loadu_pd(m.data[2].data + 2); // zw
+		auto const H = _mm_loadu_pd(m.data[3].data + 2); // zw
+
+		for (std::size_t i = 0; i < n; i++)
+		{
+			auto const v = src[i];
+
+			_mm_storeu_pd(dst[i].data + 0, _m4_mul_pd(v.data, A, B, C, D));
+			_mm_storeu_pd(dst[i].data + 2, _m4_mul_pd(v.data, E, F, G, H));
+		}
+	}
+#endif
+}
+
+// ------------------------------------------------------------------------- //
+
+namespace micro::math::simd
+{
+	//
+	// Row-major matrix x vector. A single product multiplies the rows by the
+	// vector and sums the four products horizontally, which costs fewer
+	// shuffles than transposing the matrix. The batch forms transpose once
+	// for the whole array and then run x * c0 + y * c1 + ... over the
+	// columns, with no horizontal sums.
+	//
+
+	/**
+	 * @return the lane sums of a, b, c and d, in that order
+	 */
+	inline __m128 __vectorcall _hsum4_ps(__m128 const a,
+					     __m128 const b,
+					     __m128 const c,
+					     __m128 const d) noexcept
+	{
+#ifdef __SSE3__
+		return _mm_hadd_ps(_mm_hadd_ps(a, b), _mm_hadd_ps(c, d));
+#else
+		auto const A = _mm_add_ps(_mm_unpacklo_ps(a, b), _mm_unpackhi_ps(a, b)); // a02 b02 a13 b13
+		auto const B = _mm_add_ps(_mm_unpacklo_ps(c, d), _mm_unpackhi_ps(c, d)); // c02 d02 c13 d13
+
+		return _mm_add_ps(_mm_movelh_ps(A, B), _mm_movehl_ps(B, A));
+#endif
+	}
+
+	inline TVector2<float> __vectorcall operator*(TMatrix2x2<float> const &m,
+						      TVector2<float> const &v) noexcept
+	{
+		TVector2<float> r;
+
+		auto const A = _mm_loadu_ps(reinterpret_cast<float const *>(&m)); // abcd
+		auto const V = _load2_ps(v);					  // xy00
+		auto const C = _mm_shuffle_ps(A, A, _MM_SHUFFLE(3, 1, 2, 0));	  // ac bd
+		auto const D = _mm_mul_ps(C, _mm_shuffle_ps(V, V, _MM_SHUFFLE(1, 1, 0, 0)));
+
+		_store2_ps(r, _mm_add_ps(D, _mm_movehl_ps(D, D))); // x * ac + y * bd
+
+		return r;
+	}
+
+	inline TVector3<float> __vectorcall operator*(TMatrix3x3<float> const &m,
+						      TVector3<float> const &v) noexcept
+	{
+		TVector3<float> r;
+
+		auto const V = _load3_ps(v);
+		auto const X = _mm_mul_ps(_load3_ps(m.data[0]), V);
+		auto const Y = _mm_mul_ps(_load3_ps(m.data[1]), V);
+		auto const Z = _mm_mul_ps(_load3_ps(m.data[2]), V);
+
+		_store3_ps(r, _hsum4_ps(X, Y, Z, Z));
+
+		return r;
+	}
+
+	inline TVector3<float> __vectorcall operator*(TMatrix3x4<float> const &m,
+						      TVector4<float> const &v) noexcept
+	{
+		TVector3<float> r;
+
+		auto const V = _mm_loadu_ps(v.data);
+		auto const X = _mm_mul_ps(_mm_loadu_ps(m.data[0].data), V);
+		auto const Y = _mm_mul_ps(_mm_loadu_ps(m.data[1].data), V);
+		auto const Z = _mm_mul_ps(_mm_loadu_ps(m.data[2].data), V);
+
+		_store3_ps(r, _hsum4_ps(X, Y, Z, Z));
+
+		return r;
+	}
+
+	inline TVector4<float> __vectorcall operator*(TMatrix4x4<float> const &m,
+						      TVector4<float> const &v) noexcept
+	{
+		TVector4<float> r;
+
+		auto const V = _mm_loadu_ps(v.data);
+		auto const X = _mm_mul_ps(_mm_loadu_ps(m.data[0].data), V);
+		auto const Y = _mm_mul_ps(_mm_loadu_ps(m.data[1].data), V);
+		auto const Z = _mm_mul_ps(_mm_loadu_ps(m.data[2].data), V);
+		auto const W = _mm_mul_ps(_mm_loadu_ps(m.data[3].data), V);
+
+		_mm_storeu_ps(r.data, _hsum4_ps(X, Y, Z, W));
+
+		return r;
+	}
+
+	inline void transform_batch(TVector4<float> *dst,
+				    TMatrix4x4<float> const &m,
+				    TVector4<float> const *src, std::size_t n) noexcept
+	{
+		auto A = _mm_loadu_ps(m.data[0].data);
+		auto B = _mm_loadu_ps(m.data[1].data);
+		auto C = _mm_loadu_ps(m.data[2].data);
+		auto D = _mm_loadu_ps(m.data[3].data);
+
+		_MM_TRANSPOSE4_PS(A, B, C, D);
+
+		for (std::size_t i = 0; i < n; i++)
+		{
+			_mm_storeu_ps(dst[i].data, _m4x4_mul_ps(_mm_loadu_ps(src[i].data), A, B, C, D));
+		}
+	}
+
+	inline void transform_batch(TVector3<float> *dst,
+				    TMatrix3x3<float> const &m,
+				    TVector3<float> const *src, std::size_t n) noexcept
+	{
+		auto A = _load3_ps(m.data[0]);
+		auto B = _load3_ps(m.data[1]);
+		auto C = _load3_ps(m.data[2]);
+		auto D = _mm_setzero_ps();
+
+		_MM_TRANSPOSE4_PS(A, B, C, D);
+
+		for (std::size_t i = 0; i < n; i++)
+		{
+			_store3_ps(dst[i], _m3x3_mul_ps(_load3_ps(src[i]), A, B, C));
+		}
+	}
+
+	// ----------------------------------------------------------------- //
+
+	inline TVector2<double> __vectorcall operator*(TMatrix2x2<double> const &m,
+						       TVector2<double> const &v) noexcept
+	{
+		TVector2<double> r;
+
+		auto const A = _mm_loadu_pd(m.data[0].data); // ab
+		auto const B = _mm_loadu_pd(m.data[1].data); // cd
+		auto const C = _mm_unpacklo_pd(A, B);	     // ac
+		auto const D = _mm_unpackhi_pd(A, B);	     // bd
+
+		_mm_storeu_pd(r.data, _mm_add_pd(_mm_mul_pd(C, _mm_set1_pd(v.x())), _mm_mul_pd(D, _mm_set1_pd(v.y()))));
+
+		return r;
+	}
+
+#ifdef __AVX__
+	/**
+	 * @brief Columns of a 4 x 4 double matrix with rows a, b, c, d
+	 */
+	inline void __vectorcall _m4x4_cols_pd(__m256d &a,
+					       __m256d &b,
+					       __m256d &c,
+					       __m256d &d) noexcept
+	{
+		auto const E = _mm256_unpacklo_pd(a, b); // A11 A21 A13 A23
+		auto const F = _mm256_unpackhi_pd(a, b); // A12 A22 A14 A24
+		auto const G = _mm256_unpacklo_pd(c, d); // A31 A41 A33 A43
+		auto const H = _mm256_unpackhi_pd(c, d); // A32 A42 A34 A44
+
+		a = _mm256_permute2f128_pd(E, G, 0x20);
+		b = _mm256_permute2f128_pd(F, H, 0x20);
+		c = _mm256_permute2f128_pd(E, G, 0x31);
+		d = _mm256_permute2f128_pd(F, H, 0x31);
+	}
+
+	inline void transform_batch(TVector4<double> *dst,
+				    TMatrix4x4<double> const &m,
+				    TVector4<double> const *src, std::size_t n) noexcept
+	{
+		auto A = _mm256_loadu_pd(m.data[0].data);
+		auto B = _mm256_loadu_pd(m.data[1].data);
+		auto C = _mm256_loadu_pd(m.data[2].data);
+		auto D = _mm256_loadu_pd(m.data[3].data);
+
+		_m4x4_cols_pd(A, B, C, D);
+
+		for (std::size_t i = 0; i < n; i++)
+		{
+			_mm256_storeu_pd(dst[i].data, _m4x4_mul_pd(_mm256_loadu_pd(src[i].data), A, B, C, D));
+		}
+	}
+#endif
+}
+
+// ------------------------------------------------------------------------- //
+
+namespace micro::math::simd
+{
+	inline TVector4<float> __vectorcall operator*(PreparedTransform<TMatrix4x4<float>> const &p,
+						      TVector4<float> const &v) noexcept
+	{
+		TVector4<float> r;
+
+		auto const A = _mm_load_ps(p.data[0].data);
+		auto const B = _mm_load_ps(p.data[1].data);
+		auto const C = _mm_load_ps(p.data[2].data);
+		auto const D = _mm_load_ps(p.data[3].data);
+
+		_mm_storeu_ps(r.data, _m4x4_mul_ps(_mm_loadu_ps(v.data), A, B, C, D));
+
+		return r;
+	}
+
+#ifdef __AVX__
+	/**
+	 * @brief Transforms two vectors per 256-bit register, the columns are
+	 *        repeated in both halves and the components broadcast in-lane
+	 */
+	inline void transform_batch(TVector4<float> *dst,
+				    PreparedTransform<TMatrix4x4<float>> const &m,
+				    TVector4<float> const *src, std::size_t n) noexcept
+	{
+		auto const A = _mm256_broadcast_ps(reinterpret_cast<__m128 const *>(m.data[0].data));
+		auto const B = _mm256_broadcast_ps(reinterpret_cast<__m128 const *>(m.data[1].data));
+		auto const C = _mm256_broadcast_ps(reinterpret_cast<__m128 const *>(m.data[2].data));
+		auto const D = _mm256_broadcast_ps(reinterpret_cast<__m128 const *>(m.data[3].data));
+
+		std::size_t i = 0;
+
+		for (; i + 2 <= n; i += 2)
+		{
+			auto const V = _mm256_loadu_ps(src[i].data); // xyzw xyzw
+
+			auto const X = _mm256_mul_ps(_mm256_permute_ps(V, 0b00'00'00'00), A);
+			auto const Y = _mm256_mul_ps(_mm256_permute_ps(V, 0b01'01'01'01), B);
+			auto const Z = _mm256_mul_ps(_mm256_permute_ps(V, 0b10'10'10'10), C);
+			auto const W = _mm256_mul_ps(_mm256_permute_ps(V, 0b11'11'11'11), D);
+
+			_mm256_storeu_ps(dst[i].data, _mm256_add_ps(_mm256_add_ps(X, Z), _mm256_add_ps(Y, W)));
+		}
+
+		for (; i < n; i++)
+		{
+			dst[i] = m * src[i];
+		}
+	}
+
+	inline TVector4<double> __vectorcall operator*(PreparedTransform<TMatrix4x4<double>> const &p,
+						       TVector4<double> const &v) noexcept
+	{
+		TVector4<double> r;
+
+		auto const A = _mm256_load_pd(p.data[0].data);
+		auto const B = _mm256_load_pd(p.data[1].data);
+		auto const C = _mm256_load_pd(p.data[2].data);
+		auto const D = _mm256_load_pd(p.data[3].data);
+
+		_mm256_storeu_pd(r.data, _m4x4_mul_pd(_mm256_loadu_pd(v.data), A, B, C, D));
+
+		return r;
+	}
+
+	inline void transform_batch(TVector4<double> *dst,
+				    PreparedTransform<TMatrix4x4<double>> const &m,
+				    TVector4<double> const *src, std::size_t n) noexcept
+	{
+		auto const A = _mm256_load_pd(m.data[0].data);
+		auto const B = _mm256_load_pd(m.data[1].data);
+		auto const C = _mm256_load_pd(m.data[2].data);
+		auto const D = _mm256_load_pd(m.data[3].data);
+
+		for (std::size_t i = 0; i < n; i++)
+		{
+			_mm256_storeu_pd(dst[i].data, _m4x4_mul_pd(_mm256_loadu_pd(src[i].data), A, B, C, D));
+		}
+	}
+#else
+	inline void transform_batch(TVector4<float> *dst,
+				    PreparedTransform<TMatrix4x4<float>> const &m,
+				    TVector4<float> const *src, std::size_t n) noexcept
+	{
+		auto const A = _mm_load_ps(m.data[0].data);
+		auto const B = _mm_load_ps(m.data[1].data);
+		auto const C = _mm_load_ps(m.data[2].data);
+		auto const D = _mm_load_ps(m.data[3].data);
+
+		for (std::size_t i = 0; i < n; i++)
+		{
+			_mm_storeu_ps(dst[i].data, _m4x4_mul_ps(_mm_loadu_ps(src[i].data), A, B, C, D));
+		}
+	}
+#endif
+}
+
+// ------------------------------------------------------------------------- //
+
+#include <libmath/project.hh>
+
+namespace micro::math::simd
+{
+	/**
+	 * @brief 1 / a refined with one Newton-Raphson step
+	 */
+	inline __m128 __vectorcall _rcp_nr_ps(__m128 const a) noexcept
+	{
+		auto const R = _mm_rcp_ps(a);
+
+		return _mm_mul_ps(R, _mm_sub_ps(_mm_set1_ps(2.f), _mm_mul_ps(a, R)));
+	}
+
+	/**
+	 * @brief Projects four points at a time in SoA form, the matrix elements
+	 *        are splatted once and the flags of four vertices are packed into
+	 *        a single 32-bit store
+	 */
+	inline std::size_t project_batch(TVector4<float> *clip,
+					 TVector3<float> *ndc,
+					 TVector3<float> *screen,
+					 std::uint8_t *flags,
+					 TMatrix4x4<float> const &m,
+					 TViewport<float> const &v,
+					 TVector3<float> const *src, std::size_t n,
+					 std::uint32_t *visible = nullptr) noexcept
+	{
+		__m128 M[4][4];
+
+		for (auto r = 0; r < 4; r++)
+		{
+			for (auto c = 0; c < 4; c++)
+			{
+				M[r][c] = _mm_set1_ps(m.data[r].data[c]);
+			}
+		}
+
+		auto const nil = _mm_setzero_ps();
+		auto const neg = _mm_set1_ps(-0.f);
+		auto const hw = _mm_set1_ps(v.w() / 2.f);
+		auto const hh = _mm_set1_ps(v.h() / 2.f);
+		auto const ox = _mm_set1_ps(v.x() + v.w() / 2.f);
+		auto const oy = _mm_set1_ps(v.y() + v.h() / 2.f);
+
+		auto const L = _mm_set1_epi32(clip_left);
+		auto const R = _mm_set1_epi32(clip_right);
+		auto const B = _mm_set1_epi32(clip_bottom);
+		auto const T = _mm_set1_epi32(clip_top);
+		auto const N = _mm_set1_epi32(clip_near);
+		auto const F = _mm_set1_epi32(clip_far);
+
+		std::size_t i = 0;
+		std::size_t k = 0;
+
+		for (; i + 4 <= n; i += 4)
+		{
+			auto x = _load3_ps(src[i + 0]);
+			auto y = _load3_ps(src[i + 1]);
+			auto z = _load3_ps(src[i + 2]);
+			auto w = _load3_ps(src[i + 3]);
+
+			_MM_TRANSPOSE4_PS(x, y, z, w);
+
+			auto const X = _mm_add_ps(_mm_add_ps(_mm_mul_ps(M[0][0], x), _mm_mul_ps(M[0][1], y)), _mm_add_ps(_mm_mul_ps(M[0][2], z), M[0][3]));
+			auto const Y = _mm_add_ps(_mm_add_ps(_mm_mul_ps(M[1][0], x), _mm_mul_ps(M[1][1], y)), _mm_add_ps(_mm_mul_ps(M[1][2], z), M[1][3]));
+			auto const Z = _mm_add_ps(_mm_add_ps(_mm_mul_ps(M[2][0], x), _mm_mul_ps(M[2][1], y)), _mm_add_ps(_mm_mul_ps(M[2][2], z), M[2][3]));
+			auto const W = _mm_add_ps(_mm_add_ps(_mm_mul_ps(M[3][0], x), _mm_mul_ps(M[3][1], y)), _mm_add_ps(_mm_mul_ps(M[3][2], z), M[3][3]));
+
+			//
+			// outcodes
+			//
+
+			auto const V = _mm_xor_ps(W, neg);
+			auto const C = _mm_or_si128(_mm_or_si128(_mm_or_si128(_mm_and_si128(_mm_castps_si128(_mm_cmplt_ps(X, V)), L),
+									       _mm_and_si128(_mm_castps_si128(_mm_cmpgt_ps(X, W)), R)),
+								 _mm_or_si128(_mm_and_si128(_mm_castps_si128(_mm_cmplt_ps(Y, V)), B),
+									      _mm_and_si128(_mm_castps_si128(_mm_cmpgt_ps(Y, W)), T))),
+						    _mm_or_si128(_mm_and_si128(_mm_castps_si128(_mm_cmplt_ps(Z, nil)), N),
+								 _mm_and_si128(_mm_castps_si128(_mm_cmpgt_ps(Z, W)), F)));
+
+			if (flags)
+			{
+				auto const P = _mm_packs_epi32(C, C);
+				auto const o = _mm_cvtsi128_si32(_mm_packus_epi16(P, P));
+
+				std::memcpy(flags + i, &o, sizeof(o));
+			}
+
+			auto const bits = _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(C, _mm_setzero_si128())));
+
+			for (auto l = 0; l < 4; l++)
+			{
+				if (visible)
+				{
+					visible[k] = std::uint32_t(i + l);
+				}
+
+				k += (bits >> l) & 1;
+			}
+
+			if (clip)
+			{
+				auto a = X;
+				auto b = Y;
+				auto c = Z;
+				auto d = W;
+
+				_MM_TRANSPOSE4_PS(a, b, c, d);
+
+				_mm_storeu_ps(clip[i + 0].data, a);
+				_mm_storeu_ps(clip[i + 1].data, b);
+				_mm_storeu_ps(clip[i + 2].data, c);
+				_mm_storeu_ps(clip[i + 3].data, d);
+			}
+
+			if (ndc || screen)
+			{
+				auto const Q = _rcp_nr_ps(W);
+
+				auto a = _mm_mul_ps(X, Q);
+				auto b = _mm_mul_ps(Y, Q);
+				auto c = _mm_mul_ps(Z, Q);
+
+				if (screen)
+				{
+					auto s = _mm_add_ps(ox, _mm_mul_ps(a, hw));
+					auto t = _mm_sub_ps(oy, _mm_mul_ps(b, hh));
+					auto u = c;
+					auto d = nil;
+
+					_MM_TRANSPOSE4_PS(s, t, u, d);
+
+					_store3_ps(screen[i + 0], s);
+					_store3_ps(screen[i + 1], t);
+					_store3_ps(screen[i + 2], u);
+					_store3_ps(screen[i + 3], d);
+				}
+
+				if (ndc)
+				{
+					auto d = nil;
+
+					_MM_TRANSPOSE4_PS(a, b, c, d);
+
+					_store3_ps(ndc[i + 0], a);
+					_store3_ps(ndc[i + 1], b);
+					_store3_ps(ndc[i + 2], c);
+					_store3_ps(ndc[i + 3], d);
+				}
+			}
+		}
+
+		if (i < n)
+		{
+			auto const j = k;
+
+			k += micro::math::project_batch<float>(clip ? clip + i : nullptr,
+							       ndc ? ndc + i : nullptr,
+							       screen ? screen + i : nullptr,
+							       flags ? flags + i : nullptr,
+							       m, v, src + i, n - i,
+							       visible ? visible + j : nullptr);
+
+			for (auto l = j; visible && l < k; l++)
+			{
+				visible[l] += std::uint32_t(i);
+			}
+		}
+
+		return k;
+	}
+}
+
+// ------------------------------------------------------------------------- //
+
+namespace micro::math::simd
+{
+	/**
+	 * @brief Rotation-scale part of four TRS matrices in SoA form, m[r * 4 + c]
+	 *        holds element (r, c), column 3 is left to the caller
+	 */
+	inline void __vectorcall _trs_soa_ps(__m128 m[16],
+					     __m128 const qx, __m128 const qy, __m128 const qz, __m128 const qw,
+					     __m128 const sx, __m128 const sy, __m128 const sz) noexcept
+	{
+		auto const one = _mm_set1_ps(1.f);
+
+		auto const x = _mm_add_ps(qx, qx);
+		auto const y = _mm_add_ps(qy, qy);
+		auto const z = _mm_add_ps(qz, qz);
+		auto const a = _mm_mul_ps(qx, x);
+		auto const b = _mm_mul_ps(qy, y);
+		auto const c = _mm_mul_ps(qz, z);
+		auto const d = _mm_mul_ps(qx, y);
+		auto const e = _mm_mul_ps(qx, z);
+		auto const f = _mm_mul_ps(qy, z);
+		auto const g = _mm_mul_ps(qw, x);
+		auto const h = _mm_mul_ps(qw, y);
+		auto const i = _mm_mul_ps(qw, z);
+
+		m[0] = _mm_mul_ps(_mm_sub_ps(_mm_sub_ps(one, b), c), sx);
+		m[1] = _mm_mul_ps(_mm_sub_ps(d, i), sy);
+		m[2] = _mm_mul_ps(_mm_add_ps(e, h), sz);
+		m[4] = _mm_mul_ps(_mm_add_ps(d, i), sx);
+		m[5] = _mm_mul_ps(_mm_sub_ps(_mm_sub_ps(one, a), c), sy);
+		m[6] = _mm_mul_ps(_mm_sub_ps(f, g), sz);
+		m[8] = _mm_mul_ps(_mm_sub_ps(e, h), sx);
+		m[9] = _mm_mul_ps(_mm_add_ps(f, g), sy);
+		m[10] = _mm_mul_ps(_mm_sub_ps(_mm_sub_ps(one, a), b), sz);
+	}
+
+	inline void trs_batch(TMatrix4x4<float> *dst,
+			      TVector3SoA<float const> const &t,
+			      TVector4SoA<float const> const &q,
+			      TVector3SoA<float const> const &s, std::size_t n) noexcept
+	{
+		std::size_t i = 0;
+
+		for (; i + 4 <= n; i += 4)
+		{
+			__m128 m[16];
+
+			_trs_soa_ps(m,
+				    _mm_loadu_ps(q.x() + i), _mm_loadu_ps(q.y() + i), _mm_loadu_ps(q.z() + i), _mm_loadu_ps(q.w() + i),
+				    _mm_loadu_ps(s.x() + i), _mm_loadu_ps(s.y() + i), _mm_loadu_ps(s.z() + i));
+
+			m[3] = _mm_loadu_ps(t.x() + i);
+			m[7] = _mm_loadu_ps(t.y() + i);
+			m[11] = _mm_loadu_ps(t.z() + i);
+			m[12] = _mm_setzero_ps();
+			m[13] = _mm_setzero_ps();
+			m[14] = _mm_setzero_ps();
+			m[15] = _mm_set1_ps(1.f);
+
+			_store4x4_soa_ps(dst + i, m);
+		}
+
+		if (i < n)
+		{
+			micro::math::trs_batch<float>(dst + i,
+						      TVector3SoA<float const>{{t.x() + i, t.y() + i, t.z() + i}},
+						      TVector4SoA<float const>{{q.x() + i, q.y() + i, q.z() + i, q.w() + i}},
+						      TVector3SoA<float const>{{s.x() + i, s.y() + i, s.z() + i}}, n - i);
+		}
+	}
+
+	inline void trs_batch(TMatrix3x4<float> *dst,
+			      TVector3SoA<float const> const &t,
+			      TVector4SoA<float const> const &q,
+			      TVector3SoA<float const> const &s, std::size_t n) noexcept
+	{
+		std::size_t i = 0;
+
+		for (; i + 4 <= n; i += 4)
+		{
+			__m128 m[16];
+
+			_trs_soa_ps(m,
+				    _mm_loadu_ps(q.x() + i), _mm_loadu_ps(q.y() + i), _mm_loadu_ps(q.z() + i), _mm_loadu_ps(q.w() + i),
+				    _mm_loadu_ps(s.x() + i), _mm_loadu_ps(s.y() + i), _mm_loadu_ps(s.z() + i));
+
+			m[3] = _mm_loadu_ps(t.x() + i);
+			m[7] = _mm_loadu_ps(t.y() + i);
+			m[11] = _mm_loadu_ps(t.z() + i);
+
+			for (auto r = 0; r < 3; r++)
+			{
+				auto A = m[r * 4 + 0];
+				auto B = m[r * 4 + 1];
+				auto C = m[r * 4 + 2];
+				auto D = m[r * 4 + 3];
+
+				_MM_TRANSPOSE4_PS(A, B, C, D);
+
+				_mm_storeu_ps(dst[i + 0].data[r].data, A);
+				_mm_storeu_ps(dst[i + 1].data[r].data, B);
+				_mm_storeu_ps(dst[i + 2].data[r].data, C);
+				_mm_storeu_ps(dst[i + 3].data[r].data, D);
+			}
+		}
+
+		if (i < n)
+		{
+			micro::math::trs_batch<float>(dst + i,
+						      TVector3SoA<float const>{{t.x() + i, t.y() + i, t.z() + i}},
+						      TVector4SoA<float const>{{q.x() + i, q.y() + i, q.z() + i, q.w() + i}},
+						      TVector3SoA<float const>{{s.x() + i, s.y() + i, s.z() + i}}, n - i);
+		}
+	}
+}
+
+// ------------------------------------------------------------------------- //
+
+#include <libmath/origin.hh>
+
+namespace micro::math::simd
+{
+#ifndef __AVX__
+	inline void rebase_batch(TVector3<float> *dst,
+				 TVector3<double> const *src,
+				 TVector3<double> const &origin, std::size_t n) noexcept
+	{
+		auto const O0 = _mm_setr_pd(origin.x(), origin.y());
+		auto const O1 = _mm_set_sd(origin.z());
+
+		for (std::size_t i = 0; i < n; i++)
+		{
+			auto const A = _mm_cvtpd_ps(_mm_sub_pd(_mm_loadu_pd(src[i].data), O0));	   // xy00
+			auto const B = _mm_cvtpd_ps(_mm_sub_sd(_mm_load_sd(src[i].data + 2), O1)); // z000
+
+			_store3_ps(dst[i], _mm_movelh_ps(A, B));
+		}
+	}
+
+	inline void rebase_batch(TMatrix3x4<float> *dst,
+				 TMatrix3x4<double> const *src,
+				 TVector3<double> const &origin, std::size_t n) noexcept
+	{
+		__m128d const O[3] = {_mm_setr_pd(0., origin.x()),
+				      _mm_setr_pd(0., origin.y()),
+				      _mm_setr_pd(0., origin.z())};
+
+		for (std::size_t i = 0; i < n; i++)
+		{
+			for (int r = 0; r < 3; r++)
+			{
+				auto const A = _mm_cvtpd_ps(_mm_loadu_pd(src[i].data[r].data + 0));
+				auto const B = _mm_cvtpd_ps(_mm_sub_pd(_mm_loadu_pd(src[i].data[r].data + 2), O[r]));
+
+				_mm_storeu_ps(dst[i].data[r].data, _mm_movelh_ps(A, B));
+			}
+		}
+	}
+#endif
+}
+
+// ------------------------------------------------------------------------- //
+
+namespace micro::math::simd
+{
+#ifdef __AVX__
+	inline void cast_batch(double *dst, float const *src, std::size_t n) noexcept
+	{
+		std::size_t i = 0;
+
+		for (; i + 8 <= n; i += 8)
+		{
+			_mm256_storeu_pd(dst + i + 0, _mm256_cvtps_pd(_mm_loadu_ps(src + i + 0)));
+			_mm256_storeu_pd(dst + i + 4, _mm256_cvtps_pd(_mm_loadu_ps(src + i + 4)));
+		}
+
+		if (i + 4 <= n)
+		{
+			_mm256_storeu_pd(dst + i, _mm256_cvtps_pd(_mm_loadu_ps(src + i)));
+
+			i += 4;
+		}
+
+		micro::math::cast_batch(dst + i, src + i, n - i);
+	}
+
+	inline void cast_batch(float *dst, double const *src, std::size_t n) noexcept
+	{
+		std::size_t i = 0;
+
+		for (; i + 8 <= n; i += 8)
+		{
+			auto const A = _mm256_cvtpd_ps(_mm256_loadu_pd(src + i + 0));
+			auto const B = _mm256_cvtpd_ps(_mm256_loadu_pd(src + i + 4));
+
+			_mm256_storeu_ps(dst + i, _mm256_insertf128_ps(_mm256_castps128_ps256(A), B, 1));
+		}
+
+		if (i + 4 <= n)
+		{
+			_mm_storeu_ps(dst + i, _mm256_cvtpd_ps(_mm256_loadu_pd(src + i)));
+
+			i += 4;
+		}
+
+		micro::math::cast_batch(dst + i, src + i, n - i);
+	}
+
+	inline void cast_batch(float *dst, std::int32_t const *src, std::size_t n) noexcept
+	{
+		std::size_t i = 0;
+
+		for (; i + 8 <= n; i += 8)
+		{
+			auto const A = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(src + i));
+
+			_mm256_storeu_ps(dst + i, _mm256_cvtepi32_ps(A));
+		}
+
+		if (i + 4 <= n)
+		{
+			_mm_storeu_ps(dst + i, _mm_cvtepi32_ps(_mm_loadu_si128(reinterpret_cast<__m128i const *>(src + i))));
+
+			i += 4;
+		}
+
+		micro::math::cast_batch(dst + i, src + i, n - i);
+	}
+
+	inline void cast_batch(std::int32_t *dst, float const *src, std::size_t n) noexcept
+	{
+		std::size_t i = 0;
+
+		for (; i + 8 <= n; i += 8)
+		{
+			auto const A = _mm256_cvttps_epi32(_mm256_loadu_ps(src + i));
+
+			_mm256_storeu_si256(reinterpret_cast<__m256i *>(dst + i), A);
+		}
+
+		if (i + 4 <= n)
+		{
+			_mm_storeu_si128(reinterpret_cast<__m128i *>(dst + i), _mm_cvttps_epi32(_mm_loadu_ps(src + i)));
+
+			i += 4;
+		}
+
+		micro::math::cast_batch(dst + i, src + i, n - i);
+	}
+#else
+	inline void cast_batch(double *dst, float const *src, std::size_t n) noexcept
+	{
+		std::size_t i = 0;
+
+		for (; i + 4 <= n; i += 4)
+		{
+			auto const A = _mm_loadu_ps(src + i);
+
+			_mm_storeu_pd(dst + i + 0, _mm_cvtps_pd(A));
+			_mm_storeu_pd(dst + i + 2, _mm_cvtps_pd(_mm_movehl_ps(A, A)));
+		}
+
+		micro::math::cast_batch(dst + i, src + i, n - i);
+	}
+
+	inline void cast_batch(float *dst, double const *src, std::size_t n) noexcept
+	{
+		std::size_t i = 0;
+
+		for (; i + 4 <= n; i += 4)
+		{
+			auto const A = _mm_cvtpd_ps(_mm_loadu_pd(src + i + 0));
+			auto const B = _mm_cvtpd_ps(_mm_loadu_pd(src + i + 2));
+
+			_mm_storeu_ps(dst + i, _mm_movelh_ps(A, B));
+		}
+
+		micro::math::cast_batch(dst + i, src + i, n - i);
+	}
+
+	inline void cast_batch(float *dst, std::int32_t const *src, std::size_t n) noexcept
+	{
+		std::size_t i = 0;
+
+		for (; i + 4 <= n; i += 4)
+		{
+			auto const A = _mm_loadu_si128(reinterpret_cast<__m128i const *>(src + i));
+
+			_mm_storeu_ps(dst + i, _mm_cvtepi32_ps(A));
+		}
+
+		micro::math::cast_batch(dst + i, src + i, n - i);
+	}
+
+	inline void cast_batch(std::int32_t *dst, float const *src, std::size_t n) noexcept
+	{
+		std::size_t i = 0;
+
+		for (; i + 4 <= n; i += 4)
+		{
+			auto const A = _mm_cvttps_epi32(_mm_loadu_ps(src + i));
+
+			_mm_storeu_si128(reinterpret_cast<__m128i *>(dst + i), A);
+		}
+
+		micro::math::cast_batch(dst + i, src + i, n - i);
+	}
+#endif
+
+	/**
+	 * @brief Vector and matrix spans, converted as one run of scalars
+	 *        through the kernels above (or the generic one for the other
+	 *        type pairs), @see micro::math::cast_batch
+	 */
+	template <template <class, class...> class S, class U, class T, class... A>
+	inline void cast_batch(S<U, A...> *dst, S<T, A...> const *src, std::size_t n) noexcept
+	{
+		using micro::math::cast_batch;
+		using micro::math::simd::cast_batch;
+
+		constexpr auto N = sizeof(S<U, A...>) / sizeof(U);
+
+		static_assert(sizeof(S<U, A...>) == N * sizeof(U) && sizeof(S<T, A...>) == N * sizeof(T), "padded types");
+		static_assert(std::is_standard_layout_v<S<U, A...>> && std::is_standard_layout_v<S<T, A...>>);
+
+		cast_batch(reinterpret_cast<U *>(dst), reinterpret_cast<T const *>(src), n * N);
+	}
+}
+
+// ------------------------------------------------------------------------- //
+
+#include <libmath/serialize.hh>
+
+namespace micro::math::simd
+{
+	inline std::size_t serialize_quantized(std::uint8_t *dst, float const *src, std::size_t n, float lo, float hi) noexcept
+	{
+		auto const L = _mm_set1_ps(lo);
+		auto const S = _mm_set1_ps(65535.f / (hi - lo));
+		auto const M = _mm_set1_ps(65535.f);
+		auto const B = _mm_set1_epi32(32768);
+		auto const F = _mm_set1_epi16(-32768);
+		auto const nil = _mm_setzero_ps();
+
+		std::size_t i = 0;
+
+		for (; i + 8 <= n; i += 8)
+		{
+			auto const X = _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(src + i + 0), L), S);
+			auto const Y = _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(src + i + 4), L), S);
+			auto const A = _mm_cvtps_epi32(_mm_min_ps(_mm_max_ps(X, nil), M));
+			auto const C = _mm_cvtps_epi32(_mm_min_ps(_mm_max_ps(Y, nil), M));
+
+			//
+			// SSE2 only has a signed 32 -> 16 bit pack, bias by 32768
+			//
+
+			auto const Q = _mm_xor_si128(_mm_packs_epi32(_mm_sub_epi32(A, B), _mm_sub_epi32(C, B)), F);
+
+			_mm_storeu_si128(reinterpret_cast<__m128i *>(dst + i * 2), Q);
+		}
+
+		if (i + 4 <= n)
+		{
+			auto const X = _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(src + i), L), S);
+			auto const A = _mm_sub_epi32(_mm_cvtps_epi32(_mm_min_ps(_mm_max_ps(X, nil), M)), B);
+
+			_mm_storel_epi64(reinterpret_cast<__m128i *>(dst + i * 2), _mm_xor_si128(_mm_packs_epi32(A, A), F));
+
+			i += 4;
+		}
+
+		return micro::math::serialize_quantized(dst + i * 2, src + i, n - i, lo, hi) + i * 2;
+	}
+
+	inline std::size_t deserialize_quantized(float *dst, std::uint8_t const *src, std::size_t n, float lo, float hi) noexcept
+	{
+		auto const L = _mm_set1_ps(lo);
+		auto const S = _mm_set1_ps((hi - lo) / 65535.f);
+		auto const nil = _mm_setzero_si128();
+
+		std::size_t i = 0;
+
+		for (; i + 8 <= n; i += 8)
+		{
+			auto const Q = _mm_loadu_si128(reinterpret_cast<__m128i const *>(src + i * 2));
+			auto const A = _mm_cvtepi32_ps(_mm_unpacklo_epi16(Q, nil));
+			auto const B = _mm_cvtepi32_ps(_mm_unpackhi_epi16(Q, nil));
+
+			_mm_storeu_ps(dst + i + 0, _mm_add_ps(_mm_mul_ps(A, S), L));
+			_mm_storeu_ps(dst + i + 4, _mm_add_ps(_mm_mul_ps(B, S), L));
+		}
+
+		if (i + 4 <= n)
+		{
+			auto const Q = _mm_loadl_epi64(reinterpret_cast<__m128i const *>(src + i * 2));
+
+			_mm_storeu_ps(dst + i, _mm_add_ps(_mm_mul_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(Q, nil)), S), L));
+
+			i += 4;
+		}
+
+		return micro::math::deserialize_quantized(dst + i, src + i * 2, n - i, lo, hi) + i * 2;
+	}
+
+	/**
+	 * @brief Vectors and matrices, one run of n times their scalar count
+	 *        through the kernels above, @see micro::math::serialize_quantized
+	 */
+	template <template <class, class...> class S, class... A>
+	inline std::size_t serialize_quantized(std::uint8_t *dst, S<float, A...> const *src, std::size_t n, float lo, float hi) noexcept
+	{
+		static_assert(std::is_standard_layout_v<S<float, A...>>);
+
+		return serialize_quantized(dst, reinterpret_cast<float const *>(src), n * TSerialShape<S<float, A...>>::count, lo, hi);
+	}
+
+	template <template <class, class...> class S, class... A>
+	inline std::size_t deserialize_quantized(S<float, A...> *dst, std::uint8_t const *src, std::size_t n, float lo, float hi) noexcept
+	{
+		static_assert(std::is_standard_layout_v<S<float, A...>>);
+
+		return deserialize_quantized(reinterpret_cast<float *>(dst), src, n * TSerialShape<S<float, A...>>::count, lo, hi);
+	}
+}
+
+// ------------------------------------------------------------------------- //
+
+#include <libmath/animation.hh>
+
+namespace micro::math::simd
+{
+	inline void interpolate_batch(TVector3SoA<float> const &dst,
+				      TAnimationKeys<float> const &k, float t, std::size_t n) noexcept
+	{
+		auto const x = _mm_set1_ps(t);
+		auto const nil = _mm_setzero_ps();
+		auto const one = _mm_set1_ps(1.f);
+
+		std::size_t i = 0;
+
+		for (; i + 4 <= n; i += 4)
+		{
+			auto const a = _mm_min_ps(_mm_max_ps(_mm_mul_ps(_mm_sub_ps(x, _mm_loadu_ps(k.time + i)), _mm_loadu_ps(k.rate + i)), nil), one);
+
+			for (auto j = 0; j < 3; j++)
+			{
+				_mm_storeu_ps(dst.data[j] + i, _mm_add_ps(_mm_loadu_ps(k.value[j] + i), _mm_mul_ps(_mm_loadu_ps(k.delta[j] + i), a)));
+			}
+		}
+
+		if (i < n)
+		{
+			micro::math::interpolate_batch<float>(TVector3SoA<float>{{dst.x() + i, dst.y() + i, dst.z() + i}}, k + i, t, n - i);
+		}
+	}
+
+	inline void nlerp_batch(TVector4SoA<float> const &dst,
+				TAnimationKeys<float> const &k, float t, std::size_t n) noexcept
+	{
+		auto const x = _mm_set1_ps(t);
+		auto const nil = _mm_setzero_ps();
+		auto const one = _mm_set1_ps(1.f);
+
+		std::size_t i = 0;
+
+		for (; i + 4 <= n; i += 4)
+		{
+			auto const a = _mm_min_ps(_mm_max_ps(_mm_mul_ps(_mm_sub_ps(x, _mm_loadu_ps(k.time + i)), _mm_loadu_ps(k.rate + i)), nil), one);
+
+			__m128 q[4];
+
+			for (auto j = 0; j < 4; j++)
+			{
+				q[j] = _mm_add_ps(_mm_loadu_ps(k.value[j] + i), _mm_mul_ps(_mm_loadu_ps(k.delta[j] + i), a));
+			}
+
+			auto const l = _mm_sqrt_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(q[0], q[0]), _mm_mul_ps(q[1], q[1])),
+							      _mm_add_ps(_mm_mul_ps(q[2], q[2]), _mm_mul_ps(q[3], q[3]))));
+
+			for (auto j = 0; j < 4; j++)
+			{
+				_mm_storeu_ps(dst.data[j] + i, _mm_div_ps(q[j], l));
+			}
+		}
+
+		if (i < n)
+		{
+			micro::math::nlerp_batch<float>(TVector4SoA<float>{{dst.x() + i, dst.y() + i, dst.z() + i, dst.w() + i}}, k + i, t, n - i);
+		}
+	}
+
+	/**
+	 * @brief sample_clip over the kernels above and trs_batch
+	 */
+	template <class M>
+	inline void sample_clip(M *dst, TAnimationCursor<float> &c, float t) noexcept
+	{
+		auto const n = c.bones();
+		auto const &p = c;
+
+		c.seek(t);
+
+		interpolate_batch(c.translation(), c.keys(animation_translation), t, n);
+		nlerp_batch(c.rotation(), c.keys(animation_rotation), t, n);
+		interpolate_batch(c.scale(), c.keys(animation_scale), t, n);
+
+		trs_batch(dst, p.translation(), p.rotation(), p.scale(), n);
+	}
+}
+
+// ------------------------------------------------------------------------- //
+
+#ifdef __AVX__
+#	include <libmath/simd/avx.hh>
+#endif
+
 #endif
\ No newline at end of file
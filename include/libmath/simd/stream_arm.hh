@@ -0,0 +1,49 @@
+#ifndef MICRO_LIBMATH_SIMD_STREAM_ARM_HH__GUARD
+#define MICRO_LIBMATH_SIMD_STREAM_ARM_HH__GUARD
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <libmath/stream.hh>
+#include <libmath/simd/arm.hh>
+
+//
+// stream.hh pipelines on the NEON batch kernels. Kept apart from arm.hh so
+// that only streaming users pull in <thread> and the POSIX or CRT I/O headers.
+//
+
+namespace micro::math::simd
+{
+	inline bool transform_stream(int in, int out,
+				     TMatrix4x4<float> const &m, std::size_t chunk, StreamStats *stats = nullptr)
+	{
+		return micro::math::stream_chunks<TVector4<float>, TVector4<float>>(in, out, chunk, [&m](TVector4<float> *dst, TVector4<float> const *src, std::size_t n)
+		{
+			transform_batch(dst, m, src, n);
+
+			return n;
+		}, stats);
+	}
+
+	inline bool project_stream(int in, int out,
+				   TMatrix4x4<float> const &m,
+				   TViewport<float> const &v, std::size_t chunk, StreamStats *stats = nullptr)
+	{
+		std::vector<std::uint32_t> visible(chunk);
+
+		return micro::math::stream_chunks<TVector3<float>, TVector3<float>>(in, out, chunk, [&](TVector3<float> *dst, TVector3<float> const *src, std::size_t n)
+		{
+			auto const k = project_batch(nullptr, nullptr, dst, nullptr, m, v, src, n, visible.data());
+
+			for (std::size_t i = 0; i < k; i++)
+			{
+				dst[i] = dst[visible[i]];
+			}
+
+			return k;
+		}, stats);
+	}
+}
+
+#endif
\ No newline at end of file
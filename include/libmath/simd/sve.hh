@@ -0,0 +1,326 @@
+#ifndef MICRO_LIBMATH_SIMD_SVE_HH__GUARD
+#define MICRO_LIBMATH_SIMD_SVE_HH__GUARD
+
+#include <cstddef>
+#include <cstdint>
+#include <arm_sve.h>
+
+#include <libmath/batch.hh>
+#include <libmath/simd/arm.hh>
+
+//
+// Batch kernels for the Scalable Vector Extension. Every loop is driven by a
+// whilelt predicate, so the last partial vector runs through the same code
+// as the others and the binary scales with the hardware vector length.
+// Fixed-size operations are still served by the NEON overloads in arm.hh.
+//
+
+namespace micro::math::simd
+{
+	static_assert(sizeof(TVector3<float>) == 3 * sizeof(float));
+	static_assert(sizeof(TVector4<float>) == 4 * sizeof(float));
+	static_assert(sizeof(TMatrix4x4<float>) == 16 * sizeof(float));
+	static_assert(sizeof(TVector3<double>) == 3 * sizeof(double));
+	static_assert(sizeof(TVector4<double>) == 4 * sizeof(double));
+	static_assert(sizeof(TMatrix4x4<double>) == 16 * sizeof(double));
+
+	/**
+	 * @brief Dot product of a matrix row with deinterleaved vectors
+	 *
+	 * @return r.x * x + r.y * y + r.z * z + r.w * w
+	 */
+	inline svfloat32_t _mv4_f32(svbool_t const pg,
+				    TVector4<float> const &r,
+				    svfloat32_t const x,
+				    svfloat32_t const y,
+				    svfloat32_t const z,
+				    svfloat32_t const w) noexcept
+	{
+		auto const A = svmul_n_f32_x(pg, x, r.x());
+		auto const B = svmla_n_f32_x(pg, A, y, r.y());
+		auto const C = svmla_n_f32_x(pg, B, z, r.z());
+		auto const D = svmla_n_f32_x(pg, C, w, r.w());
+
+		return D;
+	}
+
+	inline svfloat64_t _mv4_f64(svbool_t const pg,
+				    TVector4<double> const &r,
+				    svfloat64_t const x,
+				    svfloat64_t const y,
+				    svfloat64_t const z,
+				    svfloat64_t const w) noexcept
+	{
+		auto const A = svmul_n_f64_x(pg, x, r.x());
+		auto const B = svmla_n_f64_x(pg, A, y, r.y());
+		auto const C = svmla_n_f64_x(pg, B, z, r.z());
+		auto const D = svmla_n_f64_x(pg, C, w, r.w());
+
+		return D;
+	}
+
+	/**
+	 * @brief Dot product of a matrix row with deinterleaved vectors
+	 *
+	 * @return r.x * x + r.y * y + r.z * z
+	 */
+	inline svfloat32_t _mv3_f32(svbool_t const pg,
+				    TVector3<float> const &r,
+				    svfloat32_t const x,
+				    svfloat32_t const y,
+				    svfloat32_t const z) noexcept
+	{
+		auto const A = svmul_n_f32_x(pg, x, r.x());
+		auto const B = svmla_n_f32_x(pg, A, y, r.y());
+		auto const C = svmla_n_f32_x(pg, B, z, r.z());
+
+		return C;
+	}
+
+	inline svfloat64_t _mv3_f64(svbool_t const pg,
+				    TVector3<double> const &r,
+				    svfloat64_t const x,
+				    svfloat64_t const y,
+				    svfloat64_t const z) noexcept
+	{
+		auto const A = svmul_n_f64_x(pg, x, r.x());
+		auto const B = svmla_n_f64_x(pg, A, y, r.y());
+		auto const C = svmla_n_f64_x(pg, B, z, r.z());
+
+		return C;
+	}
+
+	// ------------------------- MV arithmetic ------------------------- //
+
+	inline void transform_batch(TVector4<float> *dst,
+				    TMatrix4x4<float> const &m,
+				    TVector4<float> const *src, std::size_t n) noexcept
+	{
+		for (std::uint64_t i = 0; i < n; i += svcntw())
+		{
+			auto const pg = svwhilelt_b32_u64(i, n);
+			auto const V = svld4_f32(pg, src[i].data); // x, y, z, w of svcntw() vectors
+
+			auto const X = svget4_f32(V, 0);
+			auto const Y = svget4_f32(V, 1);
+			auto const Z = svget4_f32(V, 2);
+			auto const W = svget4_f32(V, 3);
+
+			svst4_f32(pg, dst[i].data, svcreate4_f32(_mv4_f32(pg, m.data[0], X, Y, Z, W),
+								 _mv4_f32(pg, m.data[1], X, Y, Z, W),
+								 _mv4_f32(pg, m.data[2], X, Y, Z, W),
+								 _mv4_f32(pg, m.data[3], X, Y, Z, W)));
+		}
+	}
+
+	inline void transform_batch(TVector4<double> *dst,
+				    TMatrix4x4<double> const &m,
+				    TVector4<double> const *src, std::size_t n) noexcept
+	{
+		for (std::uint64_t i = 0; i < n; i += svcntd())
+		{
+			auto const pg = svwhilelt_b64_u64(i, n);
+			auto const V = svld4_f64(pg, src[i].data);
+
+			auto const X = svget4_f64(V, 0);
+			auto const Y = svget4_f64(V, 1);
+			auto const Z = svget4_f64(V, 2);
+			auto const W = svget4_f64(V, 3);
+
+			svst4_f64(pg, dst[i].data, svcreate4_f64(_mv4_f64(pg, m.data[0], X, Y, Z, W),
+								 _mv4_f64(pg, m.data[1], X, Y, Z, W),
+								 _mv4_f64(pg, m.data[2], X, Y, Z, W),
+								 _mv4_f64(pg, m.data[3], X, Y, Z, W)));
+		}
+	}
+
+	inline void transform_batch(TVector3<float> *dst,
+				    TMatrix3x3<float> const &m,
+				    TVector3<float> const *src, std::size_t n) noexcept
+	{
+		for (std::uint64_t i = 0; i < n; i += svcntw())
+		{
+			auto const pg = svwhilelt_b32_u64(i, n);
+			auto const V = svld3_f32(pg, src[i].data);
+
+			auto const X = svget3_f32(V, 0);
+			auto const Y = svget3_f32(V, 1);
+			auto const Z = svget3_f32(V, 2);
+
+			svst3_f32(pg, dst[i].data, svcreate3_f32(_mv3_f32(pg, m.data[0], X, Y, Z),
+								 _mv3_f32(pg, m.data[1], X, Y, Z),
+								 _mv3_f32(pg, m.data[2], X, Y, Z)));
+		}
+	}
+
+	inline void transform_batch(TVector3<double> *dst,
+				    TMatrix3x3<double> const &m,
+				    TVector3<double> const *src, std::size_t n) noexcept
+	{
+		for (std::uint64_t i = 0; i < n; i += svcntd())
+		{
+			auto const pg = svwhilelt_b64_u64(i, n);
+			auto const V = svld3_f64(pg, src[i].data);
+
+			auto const X = svget3_f64(V, 0);
+			auto const Y = svget3_f64(V, 1);
+			auto const Z = svget3_f64(V, 2);
+
+			svst3_f64(pg, dst[i].data, svcreate3_f64(_mv3_f64(pg, m.data[0], X, Y, Z),
+								 _mv3_f64(pg, m.data[1], X, Y, Z),
+								 _mv3_f64(pg, m.data[2], X, Y, Z)));
+		}
+	}
+
+	// ------------------------- SoA arithmetic ------------------------ //
+
+	inline void dot_batch(float *dst,
+			      TVector3SoA<float const> const &a,
+			      TVector3SoA<float const> const &b, std::size_t n) noexcept
+	{
+		for (std::uint64_t i = 0; i < n; i += svcntw())
+		{
+			auto const pg = svwhilelt_b32_u64(i, n);
+			auto const X = svmul_f32_x(pg, svld1_f32(pg, a.x() + i), svld1_f32(pg, b.x() + i));
+			auto const Y = svmla_f32_x(pg, X, svld1_f32(pg, a.y() + i), svld1_f32(pg, b.y() + i));
+			auto const Z = svmla_f32_x(pg, Y, svld1_f32(pg, a.z() + i), svld1_f32(pg, b.z() + i));
+
+			svst1_f32(pg, dst + i, Z);
+		}
+	}
+
+	inline void dot_batch(double *dst,
+			      TVector3SoA<double const> const &a,
+			      TVector3SoA<double const> const &b, std::size_t n) noexcept
+	{
+		for (std::uint64_t i = 0; i < n; i += svcntd())
+		{
+			auto const pg = svwhilelt_b64_u64(i, n);
+			auto const X = svmul_f64_x(pg, svld1_f64(pg, a.x() + i), svld1_f64(pg, b.x() + i));
+			auto const Y = svmla_f64_x(pg, X, svld1_f64(pg, a.y() + i), svld1_f64(pg, b.y() + i));
+			auto const Z = svmla_f64_x(pg, Y, svld1_f64(pg, a.z() + i), svld1_f64(pg, b.z() + i));
+
+			svst1_f64(pg, dst + i, Z);
+		}
+	}
+
+	inline void normalize_batch(TVector3SoA<float> const &dst,
+				    TVector3SoA<float const> const &src, std::size_t n) noexcept
+	{
+		for (std::uint64_t i = 0; i < n; i += svcntw())
+		{
+			auto const pg = svwhilelt_b32_u64(i, n);
+			auto const X = svld1_f32(pg, src.x() + i);
+			auto const Y = svld1_f32(pg, src.y() + i);
+			auto const Z = svld1_f32(pg, src.z() + i);
+			auto const L = svsqrt_f32_x(pg, svmla_f32_x(pg, svmla_f32_x(pg, svmul_f32_x(pg, X, X), Y, Y), Z, Z));
+
+			svst1_f32(pg, dst.x() + i, svdiv_f32_x(pg, X, L));
+			svst1_f32(pg, dst.y() + i, svdiv_f32_x(pg, Y, L));
+			svst1_f32(pg, dst.z() + i, svdiv_f32_x(pg, Z, L));
+		}
+	}
+
+	inline void normalize_batch(TVector3SoA<double> const &dst,
+				    TVector3SoA<double const> const &src, std::size_t n) noexcept
+	{
+		for (std::uint64_t i = 0; i < n; i += svcntd())
+		{
+			auto const pg = svwhilelt_b64_u64(i, n);
+			auto const X = svld1_f64(pg, src.x() + i);
+			auto const Y = svld1_f64(pg, src.y() + i);
+			auto const Z = svld1_f64(pg, src.z() + i);
+			auto const L = svsqrt_f64_x(pg, svmla_f64_x(pg, svmla_f64_x(pg, svmul_f64_x(pg, X, X), Y, Y), Z, Z));
+
+			svst1_f64(pg, dst.x() + i, svdiv_f64_x(pg, X, L));
+			svst1_f64(pg, dst.y() + i, svdiv_f64_x(pg, Y, L));
+			svst1_f64(pg, dst.z() + i, svdiv_f64_x(pg, Z, L));
+		}
+	}
+
+	// ------------------------- MM arithmetic ------------------------- //
+
+	/**
+	 * @brief Computes one column of the product for a vector of rows
+	 *
+	 * @param a rows of the left matrices, deinterleaved by column
+	 * @param b first element of the column in the right matrix
+	 * @param o offset of the right matrix of each row
+	 *
+	 * @return a.0 * b[o] + a.1 * b[o + 4] + a.2 * b[o + 8] + a.3 * b[o + 12]
+	 */
+	inline svfloat32_t _m4x4_col_f32(svbool_t const pg,
+					 svfloat32x4_t const a,
+					 float const *b,
+					 svuint32_t const o) noexcept
+	{
+		auto const A = svmul_f32_x(pg, svget4_f32(a, 0), svld1_gather_u32index_f32(pg, b + 0x0, o));
+		auto const B = svmla_f32_x(pg, A, svget4_f32(a, 1), svld1_gather_u32index_f32(pg, b + 0x4, o));
+		auto const C = svmla_f32_x(pg, B, svget4_f32(a, 2), svld1_gather_u32index_f32(pg, b + 0x8, o));
+		auto const D = svmla_f32_x(pg, C, svget4_f32(a, 3), svld1_gather_u32index_f32(pg, b + 0xC, o));
+
+		return D;
+	}
+
+	inline svfloat64_t _m4x4_col_f64(svbool_t const pg,
+					 svfloat64x4_t const a,
+					 double const *b,
+					 svuint64_t const o) noexcept
+	{
+		auto const A = svmul_f64_x(pg, svget4_f64(a, 0), svld1_gather_u64index_f64(pg, b + 0x0, o));
+		auto const B = svmla_f64_x(pg, A, svget4_f64(a, 1), svld1_gather_u64index_f64(pg, b + 0x4, o));
+		auto const C = svmla_f64_x(pg, B, svget4_f64(a, 2), svld1_gather_u64index_f64(pg, b + 0x8, o));
+		auto const D = svmla_f64_x(pg, C, svget4_f64(a, 3), svld1_gather_u64index_f64(pg, b + 0xC, o));
+
+		return D;
+	}
+
+	/**
+	 * @brief Each lane computes one row of the product, rows of the left and
+	 *        destination matrices are contiguous so only the right matrices
+	 *        are gathered
+	 */
+	inline void multiply_batch(TMatrix4x4<float> *dst,
+				   TMatrix4x4<float> const *a,
+				   TMatrix4x4<float> const *b, std::size_t n) noexcept
+	{
+		auto const A = reinterpret_cast<float const *>(a);
+		auto const B = reinterpret_cast<float const *>(b);
+		auto const D = reinterpret_cast<float *>(dst);
+
+		for (std::uint64_t q = 0; q < 4 * n; q += svcntw())
+		{
+			auto const pg = svwhilelt_b32_u64(q, 4 * n);
+			auto const R = svld4_f32(pg, A + 4 * q);
+			auto const O = svlsl_n_u32_x(pg, svlsr_n_u32_x(pg, svindex_u32(static_cast<std::uint32_t>(q), 1), 2), 4); // 16 * (row / 4)
+
+			svst4_f32(pg, D + 4 * q, svcreate4_f32(_m4x4_col_f32(pg, R, B + 0, O),
+							       _m4x4_col_f32(pg, R, B + 1, O),
+							       _m4x4_col_f32(pg, R, B + 2, O),
+							       _m4x4_col_f32(pg, R, B + 3, O)));
+		}
+	}
+
+	inline void multiply_batch(TMatrix4x4<double> *dst,
+				   TMatrix4x4<double> const *a,
+				   TMatrix4x4<double> const *b, std::size_t n) noexcept
+	{
+		auto const A = reinterpret_cast<double const *>(a);
+		auto const B = reinterpret_cast<double const *>(b);
+		auto const D = reinterpret_cast<double *>(dst);
+
+		for (std::uint64_t q = 0; q < 4 * n; q += svcntd())
+		{
+			auto const pg = svwhilelt_b64_u64(q, 4 * n);
+			auto const R = svld4_f64(pg, A + 4 * q);
+			auto const O = svlsl_n_u64_x(pg, svlsr_n_u64_x(pg, svindex_u64(q, 1), 2), 4);
+
+			svst4_f64(pg, D + 4 * q, svcreate4_f64(_m4x4_col_f64(pg, R, B + 0, O),
+							       _m4x4_col_f64(pg, R, B + 1, O),
+							       _m4x4_col_f64(pg, R, B + 2, O),
+							       _m4x4_col_f64(pg, R, B + 3, O)));
+		}
+	}
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,306 @@
+#ifndef MICRO_LIBMATH_STREAM_HH__GUARD
+#define MICRO_LIBMATH_STREAM_HH__GUARD
+
+#include <cerrno>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#ifdef _WIN32
+#	include <io.h>
+#else
+#	include <unistd.h>
+#endif
+
+#include "batch.hh"
+#include "project.hh"
+
+namespace micro::math
+{
+	struct StreamStats
+	{
+		std::uint64_t read = 0;	   // input records
+		std::uint64_t written = 0; // output records
+	};
+
+	/**
+	 * @brief Reads up to bytes from fd, short only at end of file
+	 *
+	 * @return Number of bytes read, -1 on error
+	 */
+	inline std::ptrdiff_t read_full(int fd, void *dst, std::size_t bytes) noexcept
+	{
+		auto *p = static_cast<unsigned char *>(dst);
+
+		std::size_t done = 0;
+
+		while (done < bytes)
+		{
+#ifdef _WIN32
+			auto const r = ::_read(fd, p + done, unsigned(bytes - done < 0x40000000 ? bytes - done : 0x40000000));
+#else
+			auto const r = ::read(fd, p + done, bytes - done);
+#endif
+
+			if (r < 0 && errno == EINTR)
+			{
+				continue;
+			}
+
+			if (r < 0)
+			{
+				return -1;
+			}
+
+			if (r == 0)
+			{
+				break;
+			}
+
+			done += std::size_t(r);
+		}
+
+		return std::ptrdiff_t(done);
+	}
+
+	inline bool write_full(int fd, void const *src, std::size_t bytes) noexcept
+	{
+		auto const *p = static_cast<unsigned char const *>(src);
+
+		std::size_t done = 0;
+
+		while (done < bytes)
+		{
+#ifdef _WIN32
+			auto const r = ::_write(fd, p + done, unsigned(bytes - done < 0x40000000 ? bytes - done : 0x40000000));
+#else
+			auto const r = ::write(fd, p + done, bytes - done);
+#endif
+
+			if (r < 0 && errno == EINTR)
+			{
+				continue;
+			}
+
+			if (r <= 0)
+			{
+				return false;
+			}
+
+			done += std::size_t(r);
+		}
+
+		return true;
+	}
+
+	/**
+	 * @brief Runs f over a stream of V records chunk by chunk and writes
+	 *        the U records it produces
+	 *
+	 * Memory is bounded by two input chunks and one output chunk. One
+	 * reader thread fills the two input chunks in turn and hands each over
+	 * under a condition variable, so the compute and the writes overlap
+	 * the reads.
+	 *
+	 * @param f std::size_t(U *dst, V const *src, std::size_t n), returns
+	 *          the number of records written to dst (at most n)
+	 *
+	 * @return false on an I/O error, a trailing partial record or a zero
+	 *         chunk
+	 */
+	template <class U, class V, class F>
+	inline bool stream_chunks(int in, int out, std::size_t chunk, F &&f, StreamStats *stats = nullptr)
+	{
+		if (chunk == 0)
+		{
+			return false;
+		}
+
+		std::vector<V> src[2] = {std::vector<V>(chunk), std::vector<V>(chunk)};
+		std::vector<U> dst(chunk);
+
+		std::ptrdiff_t got[2] = {};
+		bool full[2] = {};
+		bool stop = false;
+
+		std::mutex lock;
+		std::condition_variable cv;
+
+		//
+		// the reader stops after a short read, which is end of file or an
+		// error, or when the consumer gives up
+		//
+
+		std::thread reader([&]()
+		{
+			for (int k = 0;; k ^= 1)
+			{
+				{
+					std::unique_lock<std::mutex> l{lock};
+
+					cv.wait(l, [&]() { return stop || !full[k]; });
+
+					if (stop)
+					{
+						return;
+					}
+				}
+
+				auto const r = read_full(in, src[k].data(), chunk * sizeof(V));
+
+				{
+					std::lock_guard<std::mutex> l{lock};
+
+					got[k] = r;
+					full[k] = true;
+				}
+
+				cv.notify_all();
+
+				if (r != std::ptrdiff_t(chunk * sizeof(V)))
+				{
+					return;
+				}
+			}
+		});
+
+		auto const run = [&]()
+		{
+			for (int k = 0;; k ^= 1)
+			{
+				std::ptrdiff_t g = 0;
+
+				{
+					std::unique_lock<std::mutex> l{lock};
+
+					cv.wait(l, [&]() { return full[k]; });
+
+					g = got[k];
+				}
+
+				if (g < 0 || std::size_t(g) % sizeof(V) != 0)
+				{
+					return false;
+				}
+
+				auto const n = std::size_t(g) / sizeof(V);
+
+				if (n == 0)
+				{
+					return true;
+				}
+
+				auto const m = f(dst.data(), src[k].data(), n);
+
+				//
+				// src[k] is consumed, the reader refills it during the write
+				//
+
+				{
+					std::lock_guard<std::mutex> l{lock};
+
+					full[k] = false;
+				}
+
+				cv.notify_all();
+
+				if (!write_full(out, dst.data(), m * sizeof(U)))
+				{
+					return false;
+				}
+
+				if (stats)
+				{
+					stats->read += n;
+					stats->written += m;
+				}
+
+				if (n < chunk)
+				{
+					return true;
+				}
+			}
+		};
+
+		auto const join = [&]()
+		{
+			{
+				std::lock_guard<std::mutex> l{lock};
+
+				stop = true;
+			}
+
+			cv.notify_all();
+			reader.join();
+		};
+
+		bool ok = false;
+
+		try
+		{
+			ok = run();
+		}
+		catch (...)
+		{
+			join();
+			throw;
+		}
+
+		join();
+
+		return ok;
+	}
+
+	// ---------------------------- Pipelines -------------------------- //
+
+	/**
+	 * @brief Streams TVector4 records through m
+	 */
+	template <class T>
+	inline bool transform_stream(int in, int out,
+				     TMatrix4x4<T> const &m, std::size_t chunk, StreamStats *stats = nullptr)
+	{
+		return stream_chunks<TVector4<T>, TVector4<T>>(in, out, chunk, [&m](TVector4<T> *dst, TVector4<T> const *src, std::size_t n)
+		{
+			transform_batch(dst, m, src, n);
+
+			return n;
+		}, stats);
+	}
+
+	/**
+	 * @brief Streams TVector3 points through a view-projection matrix,
+	 *        drops the ones outside the clip volume and writes the screen
+	 *        position of the others, in input order
+	 */
+	template <class T>
+	inline bool project_stream(int in, int out,
+				   TMatrix4x4<T> const &m,
+				   TViewport<T> const &v, std::size_t chunk, StreamStats *stats = nullptr)
+	{
+		std::vector<std::uint32_t> visible(chunk);
+
+		return stream_chunks<TVector3<T>, TVector3<T>>(in, out, chunk, [&](TVector3<T> *dst, TVector3<T> const *src, std::size_t n)
+		{
+			auto const k = project_batch(static_cast<TVector4<T> *>(nullptr),
+						     static_cast<TVector3<T> *>(nullptr), dst,
+						     static_cast<std::uint8_t *>(nullptr), m, v, src, n, visible.data());
+
+			//
+			// visible[i] >= i, compaction in place is safe
+			//
+
+			for (std::size_t i = 0; i < k; i++)
+			{
+				dst[i] = dst[visible[i]];
+			}
+
+			return k;
+		}, stats);
+	}
+}
+
+#endif
\ No newline at end of file
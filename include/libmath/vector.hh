@@ -21,6 +21,8 @@ namespace micro::math
 	using Vector3 = TVector3<float>;
 	using Vector4 = TVector4<float>;
 
+	using Vector4A = TVector4A<float>;
+
 	// ----------------------------------------------------------------- //
 
 	template<class V>
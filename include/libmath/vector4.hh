@@ -37,6 +37,21 @@ namespace micro::math
 		type data[4] = {};
 	};
 
+	/**
+	 * @brief TVector4 placed on its natural SIMD boundary (16 bytes for
+	 *        float, 32 bytes for double) so kernels can use aligned loads
+	 */
+	template <class T>
+	struct alignas(sizeof(T) * 4) TVector4A : TVector4<T>
+	{
+		using TVector4<T>::TVector4;
+
+		constexpr TVector4A() noexcept = default;
+		constexpr TVector4A(TVector4<T> const &v) noexcept : TVector4<T>(v)
+		{
+		}
+	};
+
 	// ------------------------- VV arithmetic ------------------------- //
 
 	template <class T>
@@ -0,0 +1,250 @@
+#include <cmath>
+#include <stdexcept>
+#include <iostream>
+#include <vector>
+
+#include <libmath/animation.hh>
+#include <libmath/matrix.hh>
+#include <libmath/vector.hh>
+
+#ifdef WITH_SSE_INTRINSICS
+#	include <libmath/simd/sse.hh>
+#endif
+
+#ifdef WITH_ARM_INTRINSICS
+#	include <libmath/simd/arm.hh>
+#endif
+
+using namespace micro::math;
+using namespace micro::math::simd;
+
+#define STRINGIFY(s) #s
+#define STRINGIZE(s) STRINGIFY(s)
+
+constexpr std::size_t B = 7;
+constexpr std::size_t F = 121;
+constexpr float RATE = 30.f;
+
+void test_decompose();
+void test_compress();
+void test_sample();
+void test_single();
+
+/**
+ * @brief Bone b in frame f, some bones hold still, some move linearly and
+ *        the rest along curves
+ */
+inline Matrix4x4 frame(std::size_t b, float f) noexcept
+{
+	auto const u = normalize(Vector3{1.f, float(b), 2.f});
+	auto const k = float(b % 3);
+
+	return trs4x4(Vector3{float(b), k * f * .05f, std::sin(f * .02f * k)},
+		      u, k * std::sin(f * .03f) * 2.f,
+		      Vector3{1.f, 1.f + k * f * .002f, 1.f});
+}
+
+int main(int argc, char *argv[])
+{
+	(void)argc;
+	(void)argv;
+
+	try
+	{
+		test_decompose();
+		test_compress();
+		test_sample();
+		test_single();
+	}
+	catch (std::exception const &e)
+	{
+		std::cerr << "=============================== CAUGHT EXCEPTION ===============================" << std::endl;
+		std::cerr << e.what() << std::endl;
+		std::cerr << "================================================================================" << std::endl;
+
+		return 1;
+	}
+
+	return 0;
+}
+
+void test_decompose()
+{
+	for (auto angle : {0.f, .5f, 2.f, 3.1f, -2.5f})
+	{
+		for (auto const &u : {Vector3{1.f, 0.f, 0.f}, Vector3{0.f, 1.f, 0.f}, Vector3{0.f, 0.f, 1.f}, normalize(Vector3{1.f, -2.f, 3.f})})
+		{
+			auto const m = trs4x4(Vector3{1.f, -2.f, 3.f}, u, angle, Vector3{2.f, .5f, 1.5f});
+
+			Vector3 t;
+			Vector4 q;
+			Vector3 s;
+
+			decompose4x4(m, t, q, s);
+
+			auto const r = trs4x4(t, q, s);
+
+			for (std::size_t j = 0; j < 16; j++)
+			{
+				if (std::abs(r.data[j / 4].data[j % 4] - m.data[j / 4].data[j % 4]) > 1E-5f)
+				{
+					throw std::logic_error("@see " __FILE__ ":" STRINGIZE(__LINE__));
+				}
+			}
+		}
+	}
+}
+
+void test_compress()
+{
+	std::vector<Matrix4x4> m(B * F);
+
+	for (std::size_t f = 0; f < F; f++)
+	{
+		for (std::size_t b = 0; b < B; b++)
+		{
+			m[f * B + b] = frame(b, float(f));
+		}
+	}
+
+	AnimationClip c;
+
+	if (c.compress(m.data(), 0, F, RATE, 1E-3f) || c.bones() != 0 ||
+	    !c.compress(m.data(), B, F, RATE, 1E-3f) || c.bones() != B ||
+	    std::abs(c.duration() - 4.f) > 1E-6f)
+	{
+		throw std::logic_error("@see " __FILE__ ":" STRINGIZE(__LINE__));
+	}
+
+	//
+	// static and linear tracks keep their two end keys
+	//
+
+	std::size_t keys[B * animation_channels] = {};
+
+	for (auto const &k : c.keys())
+	{
+		keys[k.track]++;
+	}
+
+	for (std::size_t b = 0; b < B; b += 3)
+	{
+		if (keys[animation_translation * B + b] != 2 || keys[animation_rotation * B + b] != 2 || keys[animation_scale * B + b] != 2)
+		{
+			throw std::logic_error("@see " __FILE__ ":" STRINGIZE(__LINE__));
+		}
+	}
+
+	if (keys[animation_scale * B + 1] != 2 || keys[animation_rotation * B + 1] <= 2 ||
+	    c.size() * 4 > sizeof(Matrix4x4) * B * F)
+	{
+		throw std::logic_error("@see " __FILE__ ":" STRINGIZE(__LINE__));
+	}
+}
+
+void test_sample()
+{
+	std::vector<Matrix4x4> m(B * F);
+
+	for (std::size_t f = 0; f < F; f++)
+	{
+		for (std::size_t b = 0; b < B; b++)
+		{
+			m[f * B + b] = frame(b, float(f));
+		}
+	}
+
+	AnimationClip c;
+
+	c.compress(m.data(), B, F, RATE, 1E-3f);
+
+	AnimationCursor a{c};
+	AnimationCursor g{c};
+
+	Matrix4x4 r[B];
+	Matrix4x4 s[B];
+	Matrix3x4 p[B];
+
+	//
+	// forward at every frame and halfway between them, then backwards
+	//
+
+	for (std::size_t i = 0; i < F * 2 + 40; i++)
+	{
+		auto const f = i < F * 2 - 1 ? float(i) * .5f : float(F * 2 + 40 - i) * 1.5f;
+		auto const t = f / RATE;
+
+		sample_clip(r, a, t);
+		sample_clip(p, a, t);
+		micro::math::sample_clip(s, g, t);
+
+		for (std::size_t b = 0; b < B; b++)
+		{
+			auto const e = frame(b, f);
+
+			for (std::size_t j = 0; j < 16; j++)
+			{
+				if (std::abs(r[b].data[j / 4].data[j % 4] - e.data[j / 4].data[j % 4]) > 1E-2f ||
+				    std::abs(r[b].data[j / 4].data[j % 4] - s[b].data[j / 4].data[j % 4]) > 1E-5f ||
+				    (j < 12 && r[b].data[j / 4].data[j % 4] != p[b].data[j / 4].data[j % 4]))
+				{
+					throw std::logic_error("@see " __FILE__ ":" STRINGIZE(__LINE__));
+				}
+			}
+		}
+	}
+
+	//
+	// outside the clip the end keys hold
+	//
+
+	sample_clip(r, a, 10.f);
+	sample_clip(s, g, -1.f);
+
+	for (std::size_t b = 0; b < B; b++)
+	{
+		auto const e = frame(b, float(F - 1));
+		auto const h = frame(b, 0.f);
+
+		for (std::size_t j = 0; j < 16; j++)
+		{
+			if (std::abs(r[b].data[j / 4].data[j % 4] - e.data[j / 4].data[j % 4]) > 1E-2f ||
+			    std::abs(s[b].data[j / 4].data[j % 4] - h.data[j / 4].data[j % 4]) > 1E-2f)
+			{
+				throw std::logic_error("@see " __FILE__ ":" STRINGIZE(__LINE__));
+			}
+		}
+	}
+}
+
+void test_single()
+{
+	Vector3 const t[2] = {Vector3{1.f, 2.f, 3.f}, Vector3{-1.f, 0.f, 5.f}};
+	Vector4 const q[2] = {Vector4{0.f, 0.f, 0.f, 1.f}, normalize(Vector4{1.f, 1.f, 0.f, 1.f})};
+	Vector3 const s[2] = {Vector3{1.f, 1.f, 1.f}, Vector3{2.f, 2.f, 2.f}};
+
+	AnimationClip c;
+
+	if (!c.compress(t, q, s, 2, 1, RATE, 1E-3f) || c.keys().size() != 2 * 2 * animation_channels || c.duration() != 0.f)
+	{
+		throw std::logic_error("@see " __FILE__ ":" STRINGIZE(__LINE__));
+	}
+
+	AnimationCursor a{c};
+	Matrix4x4 r[2];
+
+	sample_clip(r, a, .5f);
+
+	for (std::size_t b = 0; b < 2; b++)
+	{
+		auto const e = trs4x4(t[b], q[b], s[b]);
+
+		for (std::size_t j = 0; j < 16; j++)
+		{
+			if (std::abs(r[b].data[j / 4].data[j % 4] - e.data[j / 4].data[j % 4]) > 1E-4f)
+			{
+				throw std::logic_error("@see " __FILE__ ":" STRINGIZE(__LINE__));
+			}
+		}
+	}
+}
\ No newline at end of file
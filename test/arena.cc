@@ -0,0 +1,121 @@
+#include <cstdint>
+#include <stdexcept>
+#include <iostream>
+
+#include <libmath/arena.hh>
+#include <libmath/matrix.hh>
+#include <libmath/vector.hh>
+
+using namespace micro::math;
+
+#define STRINGIFY(s) #s
+#define STRINGIZE(s) STRINGIFY(s)
+
+void test_arena();
+void test_pool();
+
+inline bool aligned(void const *p)
+{
+	return reinterpret_cast<std::uintptr_t>(p) % cache_line == 0;
+}
+
+int main(int argc, char *argv[])
+{
+	(void)argc;
+	(void)argv;
+
+	try
+	{
+		test_arena();
+		test_pool();
+	}
+	catch (std::exception const &e)
+	{
+		std::cerr << "=============================== CAUGHT EXCEPTION ===============================" << std::endl;
+		std::cerr << e.what() << std::endl;
+		std::cerr << "================================================================================" << std::endl;
+
+		return 1;
+	}
+
+	return 0;
+}
+
+void test_arena()
+{
+	Arena arena(4096);
+
+	auto const a = arena.allocate<Matrix4x4>(10);
+	auto const b = arena.allocate<Vector3>(7);
+	auto const c = arena.allocate<Matrix3x4>(3);
+
+	if (!a || !aligned(a) ||
+	    !b || !aligned(b) ||
+	    !c || !aligned(c))
+	{
+		throw std::logic_error("@see " __FILE__ ":" STRINGIZE(__LINE__));
+	}
+
+	if (reinterpret_cast<std::byte *>(b) < reinterpret_cast<std::byte *>(a + 10) ||
+	    reinterpret_cast<std::byte *>(c) < reinterpret_cast<std::byte *>(b + 7))
+	{
+		throw std::logic_error("@see " __FILE__ ":" STRINGIZE(__LINE__));
+	}
+
+	if (arena.allocate<Vector4>(4096) != nullptr)
+	{
+		throw std::logic_error("@see " __FILE__ ":" STRINGIZE(__LINE__));
+	}
+
+	auto const peak = arena.used();
+	auto const mark = arena.mark();
+
+	arena.allocate<Vector4>(4);
+	arena.rewind(mark);
+
+	if (arena.used() != peak || arena.high_water() <= peak)
+	{
+		throw std::logic_error("@see " __FILE__ ":" STRINGIZE(__LINE__));
+	}
+
+	arena.reset();
+
+	if (arena.used() != 0 || arena.allocate<Matrix4x4>(1) != a)
+	{
+		throw std::logic_error("@see " __FILE__ ":" STRINGIZE(__LINE__));
+	}
+}
+
+void test_pool()
+{
+	TPool<Matrix4x4> pool(16, 4);
+
+	Matrix4x4 *blocks[4];
+
+	for (auto &b : blocks)
+	{
+		if (!(b = pool.allocate()) || !aligned(b))
+		{
+			throw std::logic_error("@see " __FILE__ ":" STRINGIZE(__LINE__));
+		}
+	}
+
+	if (pool.allocate() != nullptr || pool.used() != 4 || pool.high_water() != 4)
+	{
+		throw std::logic_error("@see " __FILE__ ":" STRINGIZE(__LINE__));
+	}
+
+	pool.release(blocks[2]);
+
+	if (pool.allocate() != blocks[2])
+	{
+		throw std::logic_error("@see " __FILE__ ":" STRINGIZE(__LINE__));
+	}
+
+	pool.reset();
+
+	if (pool.used() != 0 || pool.high_water() != 4 || pool.allocate() != blocks[0])
+	{
+		throw std::logic_error("@see " __FILE__ ":" STRINGIZE(__LINE__));
+	}
+}
\ No newline at end of file
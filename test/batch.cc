@@ -0,0 +1,664 @@
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <stdexcept>
+#include <iostream>
+
+#include <libmath/batch.hh>
+#include <libmath/matrix.hh>
+#include <libmath/vector.hh>
+
+#ifdef WITH_SSE_INTRINSICS
+#	include <libmath/simd/sse.hh>
+#endif
+
+#ifdef WITH_ARM_INTRINSICS
+#	include <libmath/simd/arm.hh>
+#endif
+
+#ifdef WITH_SVE_INTRINSICS
+#	include <libmath/simd/sve.hh>
+#endif
+
+using namespace micro::math;
+using namespace micro::math::simd;
+
+constexpr float EPS = 4E-5f;
+
+#define STRINGIFY(s) #s
+#define STRINGIZE(s) STRINGIFY(s)
+
+constexpr std::size_t N = 37;
+
+volatile Matrix4x4 A = {-3.66351f, -3.06202f, -3.03546f, -1.30268f,
+			+2.29979f, -4.47526f, +1.08899f, -0.98770f,
+			+4.14048f, -3.73218f, +1.79211f, -0.17394f,
+			+4.88430f, -2.29981f, +3.70524f, +3.74895f};
+
+void test_mvm();
+void test_f64();
+
+template <class T>
+void test_soa();
+void test_mmm();
+
+template <class M>
+void test_bmm();
+
+template <class M>
+void test_inv();
+
+template <class M>
+void test_trn();
+void test_aos();
+void test_ptf();
+void test_trs();
+void test_cast();
+
+inline bool eq(float a,
+	       float b) noexcept
+{
+	return std::abs(a - b) <= EPS ||
+	       std::abs(a - b) <= EPS * std::max(std::abs(a), std::abs(b));
+}
+
+inline float value(std::size_t i, std::size_t j) noexcept
+{
+	return std::sin(float(i * 7 + j)) * 4.f;
+}
+
+template <class M>
+inline M product(M const &a,
+		 M const &b) noexcept
+{
+	return a * b;
+}
+
+template <class T>
+inline TMatrix3x4<T> product(TMatrix3x4<T> const &a,
+			     TMatrix3x4<T> const &b) noexcept
+{
+	return compose3x4(a, b);
+}
+
+int main(int argc, char *argv[])
+{
+	(void)argc;
+	(void)argv;
+
+	try
+	{
+		test_mvm();
+		test_f64();
+		test_soa<float>();
+		test_soa<double>();
+		test_mmm();
+		test_bmm<Matrix2x2>();
+		test_bmm<TMatrix2x2<double>>();
+		test_bmm<Matrix3x3>();
+		test_bmm<TMatrix3x3<double>>();
+		test_bmm<Matrix3x4>();
+		test_bmm<TMatrix3x4<double>>();
+		test_bmm<Matrix4x4>();
+		test_bmm<TMatrix4x4<double>>();
+		test_inv<Matrix2x2>();
+		test_inv<TMatrix2x2<double>>();
+		test_inv<Matrix3x3>();
+		test_inv<TMatrix3x3<double>>();
+		test_inv<Matrix4x4>();
+		test_inv<TMatrix4x4<double>>();
+		test_trn<Matrix2x2>();
+		test_trn<TMatrix2x2<double>>();
+		test_trn<Matrix2x3>();
+		test_trn<TMatrix2x3<double>>();
+		test_trn<Matrix2x4>();
+		test_trn<TMatrix2x4<double>>();
+		test_trn<Matrix3x2>();
+		test_trn<TMatrix3x2<double>>();
+		test_trn<Matrix3x3>();
+		test_trn<TMatrix3x3<double>>();
+		test_trn<Matrix3x4>();
+		test_trn<TMatrix3x4<double>>();
+		test_trn<Matrix4x2>();
+		test_trn<TMatrix4x2<double>>();
+		test_trn<Matrix4x3>();
+		test_trn<TMatrix4x3<double>>();
+		test_trn<Matrix4x4>();
+		test_trn<TMatrix4x4<double>>();
+		test_aos();
+		test_ptf();
+		test_trs();
+		test_cast();
+	}
+	catch (std::exception const &e)
+	{
+		std::cerr << "=============================== CAUGHT EXCEPTION ===============================" << std::endl;
+		std::cerr << e.what() << std::endl;
+		std::cerr << "================================================================================" << std::endl;
+
+		return 1;
+	}
+
+	return 0;
+}
+
+void test_mvm()
+{
+	auto a = const_cast<Matrix4x4 const &>(A);
+	auto b = Matrix3x3{a._11(), a._12(), a._13(),
+			   a._21(), a._22(), a._23(),
+			   a._31(), a._32(), a._33()};
+
+	Vector4 u[N];
+	Vector4 v[N];
+	Vector3 s[N];
+	Vector3 t[N];
+
+	for (std::size_t i = 0; i < N; i++)
+	{
+		u[i] = Vector4{value(i, 0), value(i, 1), value(i, 2), value(i, 3)};
+		s[i] = Vector3{value(i, 0), value(i, 1), value(i, 2)};
+	}
+
+	transform_batch(v, a, u, N);
+	transform_batch(t, b, s, N);
+
+	for (std::size_t i = 0; i < N; i++)
+	{
+		auto const x = a * u[i];
+		auto const y = b * s[i];
+
+		if (!eq(v[i].x(), x.x()) || !eq(v[i].y(), x.y()) || !eq(v[i].z(), x.z()) || !eq(v[i].w(), x.w()) ||
+		    !eq(t[i].x(), y.x()) || !eq(t[i].y(), y.y()) || !eq(t[i].z(), y.z()))
+		{
+			throw std::logic_error("@see " __FILE__ ":" STRINGIZE(__LINE__));
+		}
+	}
+}
+
+void test_f64()
+{
+	auto const a = const_cast<Matrix4x4 const &>(A);
+	auto const b = Matrix3x3{a._11(), a._12(), a._13(),
+				 a._21(), a._22(), a._23(),
+				 a._31(), a._32(), a._33()};
+	auto const c = Matrix3x4{a.data[0], a.data[1], a.data[2]};
+	auto const g = TMatrix3x4<double>{vector_cast<double>(a.data[0]), vector_cast<double>(a.data[1]), vector_cast<double>(a.data[2])};
+
+	for (std::size_t i = 0; i < N; i++)
+	{
+		auto const p = Vector3{value(i, 0), value(i, 1), value(i, 2)};
+		auto const q = Vector3{value(i, 3), value(i, 4) + 5.f, value(i, 5)};
+		auto const r = Vector4{value(i, 6), value(i, 7), value(i, 8), value(i, 9) + 5.f};
+		auto const u = vector_cast<double>(p);
+		auto const v = vector_cast<double>(q);
+		auto const w = vector_cast<double>(r);
+
+		Vector3 const x[] = {p + q, p - q, p * q, p / q, p ^ q, b * p};
+		TVector3<double> const y[] = {u + v, u - v, u * v, u / v, u ^ v, matrix_cast<double>(b) * u};
+
+		Vector4 const s[] = {r + r, r - r * r, r * r, r / r};
+		TVector4<double> const t[] = {w + w, w - w * w, w * w, w / w};
+
+		for (std::size_t j = 0; j < 6 * 3; j++)
+		{
+			if (!eq(float(y[j / 3].data[j % 3]), x[j / 3].data[j % 3]))
+			{
+				throw std::logic_error("@see " __FILE__ ":" STRINGIZE(__LINE__));
+			}
+		}
+
+		for (std::size_t j = 0; j < 4 * 4; j++)
+		{
+			if (!eq(float(t[j / 4].data[j % 4]), s[j / 4].data[j % 4]))
+			{
+				throw std::logic_error("@see " __FILE__ ":" STRINGIZE(__LINE__));
+			}
+		}
+
+		if (!eq(float(dot(u, v)), dot(p, q)) || !eq(float(dot(w, w)), dot(r, r)))
+		{
+			throw std::logic_error("@see " __FILE__ ":" STRINGIZE(__LINE__));
+		}
+	}
+
+	auto const m = b * b;
+	auto const n = matrix_cast<double>(b) * matrix_cast<double>(b);
+	auto const k = c * a;
+	auto const l = g * matrix_cast<double>(a);
+	auto const e = compose3x4(c, c);
+	auto const f = compose3x4(g, g);
+
+	for (std::size_t j = 0; j < 12; j++)
+	{
+		if ((j < 9 && !eq(float(n.data[j / 3].data[j % 3]), m.data[j / 3].data[j % 3])) ||
+		    !eq(float(l.data[j / 4].data[j % 4]), k.data[j / 4].data[j % 4]) ||
+		    !eq(float(f.data[j / 4].data[j % 4]), e.data[j / 4].data[j % 4]))
+		{
+			throw std::logic_error("@see " __FILE__ ":" STRINGIZE(__LINE__));
+		}
+	}
+}
+
+template <class T>
+void test_soa()
+{
+	T x[N], y[N], z[N];
+	T u[N], v[N], w[N];
+	T d[N];
+
+	for (std::size_t i = 0; i < N; i++)
+	{
+		x[i] = T(value(i, 0));
+		y[i] = T(value(i, 1));
+		z[i] = T(value(i, 2) + 5.f);
+	}
+
+	auto const a = TVector3SoA<T const>{{x, y, z}};
+
+	dot_batch(d, a, a, N);
+	normalize_batch(TVector3SoA<T>{{u, v, w}}, a, N);
+
+	for (std::size_t i = 0; i < N; i++)
+	{
+		auto const p = Vector3{float(x[i]), float(y[i]), float(z[i])};
+		auto const q = normalize(p);
+
+		if (!eq(float(d[i]), dot(p, p)) ||
+		    !eq(float(u[i]), q.x()) || !eq(float(v[i]), q.y()) || !eq(float(w[i]), q.z()))
+		{
+			throw std::logic_error("@see " __FILE__ ":" STRINGIZE(__LINE__));
+		}
+	}
+}
+
+void test_mmm()
+{
+	Matrix4x4 a[N];
+	Matrix4x4 b[N];
+	Matrix4x4 c[N];
+
+	for (std::size_t i = 0; i < N; i++)
+	{
+		for (std::size_t j = 0; j < 16; j++)
+		{
+			a[i].data[j / 4].data[j % 4] = value(i, j);
+			b[i].data[j / 4].data[j % 4] = value(i + N, j);
+		}
+	}
+
+	multiply_batch(c, a, b, N);
+
+	for (std::size_t i = 0; i < N; i++)
+	{
+		auto const m = a[i] * b[i];
+
+		for (std::size_t j = 0; j < 16; j++)
+		{
+			if (!eq(c[i].data[j / 4].data[j % 4], m.data[j / 4].data[j % 4]))
+			{
+				throw std::logic_error("@see " __FILE__ ":" STRINGIZE(__LINE__));
+			}
+		}
+	}
+}
+
+template <class M>
+void test_bmm()
+{
+	constexpr std::size_t R = sizeof(M::data) / sizeof(M::data[0]);
+	constexpr std::size_t C = sizeof(M::data[0].data) / sizeof(M::data[0].data[0]);
+
+	M a[N];
+	M b[N];
+	M c[N];
+	M d[N];
+	M e[N];
+	M f[N];
+
+	for (std::size_t i = 0; i < N; i++)
+	{
+		for (std::size_t j = 0; j < R * C; j++)
+		{
+			a[i].data[j / C].data[j % C] = value(i, j);
+			b[i].data[j / C].data[j % C] = value(i + N, j);
+		}
+
+		f[i] = a[i];
+	}
+
+	multiply_batch(c, a, b, N);
+	multiply_batch(d, a[1], b, N);
+	multiply_batch(e, a, b[1], N);
+	multiply_batch(f, f, b, N); // in place
+
+	for (std::size_t i = 0; i < N; i++)
+	{
+		auto const p = product(a[i], b[i]);
+		auto const q = product(a[1], b[i]);
+		auto const r = product(a[i], b[1]);
+
+		for (std::size_t j = 0; j < R * C; j++)
+		{
+			if (!eq(c[i].data[j / C].data[j % C], p.data[j / C].data[j % C]) ||
+			    !eq(d[i].data[j / C].data[j % C], q.data[j / C].data[j % C]) ||
+			    !eq(e[i].data[j / C].data[j % C], r.data[j / C].data[j % C]) ||
+			    !eq(f[i].data[j / C].data[j % C], p.data[j / C].data[j % C]))
+			{
+				throw std::logic_error("@see " __FILE__ ":" STRINGIZE(__LINE__));
+			}
+		}
+	}
+}
+
+template <class M>
+void test_inv()
+{
+	using T = typename M::type;
+
+	constexpr std::size_t R = sizeof(M::data) / sizeof(M::data[0]);
+
+	M a[N];
+	M b[N];
+	M c[N];
+	T d[N];
+	bool s[N];
+
+	for (std::size_t i = 0; i < N; i++)
+	{
+		for (std::size_t j = 0; j < R * R; j++)
+		{
+			a[i].data[j / R].data[j % R] = value(i, j) + (j % (R + 1) == 0 ? T(8) : T(0));
+		}
+
+		c[i] = a[i];
+	}
+
+	a[5].data[0] = {};
+	c[5] = a[5];
+
+	det_batch(d, a, N);
+	inverse_batch(b, a, N, s);
+	inverse_batch(c, c, N); // in place
+
+	for (std::size_t i = 0; i < N; i++)
+	{
+		if (!eq(d[i], det(a[i])) || s[i] != (i == 5))
+		{
+			throw std::logic_error("@see " __FILE__ ":" STRINGIZE(__LINE__));
+		}
+
+		if (i == 5)
+		{
+			continue;
+		}
+
+		auto const p = inverse(a[i]);
+		auto const q = a[i] * b[i];
+
+		for (std::size_t j = 0; j < R * R; j++)
+		{
+			if (!eq(b[i].data[j / R].data[j % R], p.data[j / R].data[j % R]) ||
+			    !eq(c[i].data[j / R].data[j % R], p.data[j / R].data[j % R]) ||
+			    !eq(q.data[j / R].data[j % R], j % (R + 1) == 0 ? 1.f : 0.f))
+			{
+				throw std::logic_error("@see " __FILE__ ":" STRINGIZE(__LINE__));
+			}
+		}
+	}
+}
+
+template <class M>
+void test_trn()
+{
+	constexpr std::size_t R = sizeof(M::data) / sizeof(M::data[0]);
+	constexpr std::size_t C = sizeof(M::data[0].data) / sizeof(M::data[0].data[0]);
+
+	M a[N];
+	decltype(transpose(a[0])) b[N];
+
+	for (std::size_t i = 0; i < N; i++)
+	{
+		for (std::size_t j = 0; j < R * C; j++)
+		{
+			a[i].data[j / C].data[j % C] = value(i, j);
+		}
+	}
+
+	transpose_batch(b, a, N);
+
+	for (std::size_t i = 0; i < N; i++)
+	{
+		for (std::size_t j = 0; j < R * C; j++)
+		{
+			if (b[i].data[j % C].data[j / C] != a[i].data[j / C].data[j % C])
+			{
+				throw std::logic_error("@see " __FILE__ ":" STRINGIZE(__LINE__));
+			}
+		}
+	}
+}
+
+void test_aos()
+{
+	Matrix4x4 a[N];
+	Matrix4x4 b[N];
+
+	float soa[16][N];
+
+	for (std::size_t i = 0; i < N; i++)
+	{
+		for (std::size_t j = 0; j < 16; j++)
+		{
+			a[i].data[j / 4].data[j % 4] = value(i, j);
+		}
+	}
+
+	TMatrix4x4SoA<float> dst;
+	TMatrix4x4SoA<float const> src;
+
+	for (std::size_t k = 0; k < 16; k++)
+	{
+		dst.data[k] = soa[k];
+		src.data[k] = soa[k];
+	}
+
+	transpose_batch(dst, a, N);
+	transpose_batch(b, src, N);
+
+	for (std::size_t i = 0; i < N; i++)
+	{
+		for (std::size_t j = 0; j < 16; j++)
+		{
+			if (soa[j][i] != a[i].data[j / 4].data[j % 4] ||
+			    b[i].data[j / 4].data[j % 4] != a[i].data[j / 4].data[j % 4])
+			{
+				throw std::logic_error("@see " __FILE__ ":" STRINGIZE(__LINE__));
+			}
+		}
+	}
+}
+
+void test_ptf()
+{
+	auto a = const_cast<Matrix4x4 const &>(A);
+
+	auto const p = PreparedTransform<Matrix4x4>{a};
+	auto const q = PreparedTransform<TMatrix4x4<double>>{matrix_cast<double>(a)};
+
+	Vector4 u[N];
+	Vector4 v[N];
+	TVector4<double> s[N];
+	TVector4<double> t[N];
+
+	for (std::size_t i = 0; i < N; i++)
+	{
+		u[i] = Vector4{value(i, 0), value(i, 1), value(i, 2), value(i, 3)};
+		s[i] = vector_cast<double>(u[i]);
+	}
+
+	transform_batch(v, p, u, N);
+	transform_batch(t, q, s, N);
+
+	for (std::size_t i = 0; i < N; i++)
+	{
+		auto const x = a * u[i];
+		auto const y = p * u[i];
+		auto const z = vector_cast<float>(q * s[i]);
+
+		for (int j = 0; j < 4; j++)
+		{
+			if (!eq(v[i].data[j], x.data[j]) || !eq(y.data[j], x.data[j]) ||
+			    !eq(float(t[i].data[j]), x.data[j]) || !eq(z.data[j], x.data[j]))
+			{
+				throw std::logic_error("@see " __FILE__ ":" STRINGIZE(__LINE__));
+			}
+		}
+	}
+}
+
+void test_trs()
+{
+	float t[3][N];
+	float q[4][N];
+	float s[3][N];
+
+	for (std::size_t i = 0; i < N; i++)
+	{
+		auto const u = normalize(Vector3{value(i, 0), value(i, 1), value(i, 2)});
+		auto const a = value(i, 3);
+
+		for (int j = 0; j < 3; j++)
+		{
+			t[j][i] = value(i, j + 4);
+			s[j][i] = 1.f + std::abs(value(i, j + 7));
+			q[j][i] = u.data[j] * std::sin(a / 2.f);
+		}
+
+		q[3][i] = std::cos(a / 2.f);
+	}
+
+	Matrix4x4 m[N];
+	Matrix3x4 n[N];
+
+	TVector3SoA<float const> const T{{t[0], t[1], t[2]}};
+	TVector4SoA<float const> const Q{{q[0], q[1], q[2], q[3]}};
+	TVector3SoA<float const> const S{{s[0], s[1], s[2]}};
+
+	trs_batch(m, T, Q, S, N);
+	trs_batch(n, T, Q, S, N);
+
+	for (std::size_t i = 0; i < N; i++)
+	{
+		auto const u = normalize(Vector3{value(i, 0), value(i, 1), value(i, 2)});
+		auto const r = translate4x4(t[0][i], t[1][i], t[2][i]) *
+			       rotate4x4(Vector4{q[0][i], q[1][i], q[2][i], q[3][i]}) *
+			       scale4x4(s[0][i], s[1][i], s[2][i]);
+		auto const k = trs4x4(Vector3{t[0][i], t[1][i], t[2][i]}, u, value(i, 3), Vector3{s[0][i], s[1][i], s[2][i]});
+		auto const l = trs3x4(Vector3{t[0][i], t[1][i], t[2][i]}, u, value(i, 3), Vector3{s[0][i], s[1][i], s[2][i]});
+
+		for (int j = 0; j < 16; j++)
+		{
+			auto const x = r.data[j / 4].data[j % 4];
+
+			if (!eq(m[i].data[j / 4].data[j % 4], x) || !eq(k.data[j / 4].data[j % 4], x) ||
+			    (j < 12 && (!eq(n[i].data[j / 4].data[j % 4], x) || !eq(l.data[j / 4].data[j % 4], x))))
+			{
+				throw std::logic_error("@see " __FILE__ ":" STRINGIZE(__LINE__));
+			}
+		}
+	}
+}
+
+void test_cast()
+{
+	TMatrix4x4<double> a[N];
+	TMatrix3x4<double> b[N];
+	TVector3<double> c[N];
+	TVector4A<double> d[N];
+	std::int32_t e[N * 3];
+
+	for (std::size_t i = 0; i < N; i++)
+	{
+		for (std::size_t j = 0; j < 16; j++)
+		{
+			a[i].data[j / 4].data[j % 4] = double(value(i, j)) / 3.;
+		}
+
+		b[i] = TMatrix3x4<double>{a[i].data[0], a[i].data[1], a[i].data[2]};
+		c[i] = TVector3<double>{a[i]._11(), a[i]._22(), a[i]._33()};
+		d[i] = TVector4A<double>{a[i]._41(), a[i]._42(), a[i]._43(), a[i]._44()};
+
+		for (std::size_t j = 0; j < 3; j++)
+		{
+			e[i * 3 + j] = std::int32_t(value(i, j) * 1000.f);
+		}
+	}
+
+	Matrix4x4 p[N];
+	Matrix3x4 q[N];
+	Vector3 r[N];
+	TVector4A<float> s[N];
+	TVector3<std::int32_t> t[N];
+	TVector3<double> u[N];
+	Vector3 o[N];
+	float v[N * 3];
+	std::int32_t w[N * 3];
+
+	//
+	// the vector and matrix spans run as 3 N, 12 N and 16 N scalars, wide
+	// enough for the 4 and 8 lane kernels
+	//
+
+	cast_batch(p, a, N);
+	cast_batch(q, b, N);
+	cast_batch(r, c, N);
+	cast_batch(s, d, N);
+	cast_batch(t, r, N);
+
+	//
+	// r goes through memory the compiler can't see into, so the float round
+	// trip of u can't be folded away
+	//
+
+	for (std::size_t i = 0; i < N; i++)
+	{
+		for (std::size_t j = 0; j < 3; j++)
+		{
+			volatile float x = r[i].data[j];
+
+			o[i].data[j] = x;
+		}
+	}
+
+	cast_batch(u, o, N);
+	cast_batch(v, e, N * 3);
+	cast_batch(w, v, N * 3);
+
+	for (std::size_t i = 0; i < N; i++)
+	{
+		for (std::size_t j = 0; j < 16; j++)
+		{
+			auto const x = a[i].data[j / 4].data[j % 4];
+
+			if (p[i].data[j / 4].data[j % 4] != float(x) ||
+			    (j < 12 && q[i].data[j / 4].data[j % 4] != float(x)) ||
+			    (j >= 12 && s[i].data[j % 4] != float(x)))
+			{
+				throw std::logic_error("@see " __FILE__ ":" STRINGIZE(__LINE__));
+			}
+		}
+
+		for (std::size_t j = 0; j < 3; j++)
+		{
+			if (r[i].data[j] != float(c[i].data[j]) ||
+			    t[i].data[j] != std::int32_t(r[i].data[j]) ||
+			    u[i].data[j] != double(r[i].data[j]) ||
+			    v[i * 3 + j] != float(e[i * 3 + j]) ||
+			    w[i * 3 + j] != e[i * 3 + j])
+			{
+				throw std::logic_error("@see " __FILE__ ":" STRINGIZE(__LINE__));
+			}
+		}
+	}
+}
\ No newline at end of file
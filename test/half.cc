@@ -0,0 +1,191 @@
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <iostream>
+
+#include <libmath/half.hh>
+#include <libmath/matrix.hh>
+#include <libmath/vector.hh>
+
+#ifdef WITH_SSE_INTRINSICS
+#	include <libmath/simd/sse.hh>
+#endif
+
+#ifdef WITH_ARM_INTRINSICS
+#	include <libmath/simd/arm.hh>
+#endif
+
+using namespace micro::math;
+using namespace micro::math::simd;
+
+#define STRINGIFY(s) #s
+#define STRINGIZE(s) STRINGIFY(s)
+
+volatile Matrix4x4 A = {-0.66351f, -0.06202f, -0.03546f, -1.30268f,
+			+0.29979f, -0.47526f, +0.08899f, -0.98770f,
+			+0.14048f, -0.73218f, +0.79211f, -0.17394f,
+			+0.00000f, +0.00000f, +0.00000f, +1.00000f};
+
+void test_half();
+void test_bf16();
+void test_batch();
+void test_transform();
+
+inline bool eq(float a,
+	       float b,
+	       float eps) noexcept
+{
+	return std::abs(a - b) <= eps ||
+	       std::abs(a - b) <= eps * std::max(std::abs(a), std::abs(b));
+}
+
+int main(int argc, char *argv[])
+{
+	(void)argc;
+	(void)argv;
+
+	try
+	{
+		test_half();
+		test_bf16();
+		test_batch();
+		test_transform();
+	}
+	catch (std::exception const &e)
+	{
+		std::cerr << "=============================== CAUGHT EXCEPTION ===============================" << std::endl;
+		std::cerr << e.what() << std::endl;
+		std::cerr << "================================================================================" << std::endl;
+
+		return 1;
+	}
+
+	return 0;
+}
+
+void test_half()
+{
+	if (pack<half>(1.f).bits != 0x3C00 ||
+	    pack<half>(-2.f).bits != 0xC000 ||
+	    pack<half>(65504.f).bits != 0x7BFF ||
+	    pack<half>(65520.f).bits != 0x7C00 ||
+	    pack<half>(std::numeric_limits<float>::infinity()).bits != 0x7C00 ||
+	    pack<half>(5.9604645E-8f).bits != 0x0001 ||
+	    pack<half>(1.f + 1.f / 2048.f).bits != 0x3C00 ||
+	    pack<half>(1.f + 3.f / 2048.f).bits != 0x3C02)
+	{
+		throw std::logic_error("@see " __FILE__ ":" STRINGIZE(__LINE__));
+	}
+
+	for (std::uint32_t i = 0; i < 0x10000; i++)
+	{
+		auto const h = half{static_cast<std::uint16_t>(i)};
+		auto const f = unpack(h);
+
+		if (std::isnan(f) ? (i & 0x7C00) != 0x7C00 : pack<half>(f).bits != i)
+		{
+			throw std::logic_error("@see " __FILE__ ":" STRINGIZE(__LINE__));
+		}
+	}
+}
+
+void test_bf16()
+{
+	if (pack<bfloat16>(1.f).bits != 0x3F80 ||
+	    pack<bfloat16>(-2.f).bits != 0xC000 ||
+	    pack<bfloat16>(1.f + 1.f / 256.f).bits != 0x3F80 ||
+	    pack<bfloat16>(1.f + 3.f / 256.f).bits != 0x3F82 ||
+	    !std::isnan(unpack(pack<bfloat16>(std::numeric_limits<float>::quiet_NaN()))))
+	{
+		throw std::logic_error("@see " __FILE__ ":" STRINGIZE(__LINE__));
+	}
+
+	if (!eq(unpack(pack<bfloat16>(3.14159265f)), 3.14159265f, 1.f / 128.f))
+	{
+		throw std::logic_error("@see " __FILE__ ":" STRINGIZE(__LINE__));
+	}
+}
+
+void test_batch()
+{
+	float src[37];
+	float out[37];
+	half h[37];
+	bfloat16 b[37];
+
+	for (int i = 0; i < 37; i++)
+	{
+		src[i] = std::sin(float(i)) * float(i * i);
+	}
+
+	src[5] = std::numeric_limits<float>::infinity();
+	src[9] = 1E-6f;
+
+	pack_batch(h, src, 37);
+	pack_batch(b, src, 37);
+
+	for (int i = 0; i < 37; i++)
+	{
+		if (h[i].bits != pack<half>(src[i]).bits ||
+		    b[i].bits != pack<bfloat16>(src[i]).bits)
+		{
+			throw std::logic_error("@see " __FILE__ ":" STRINGIZE(__LINE__));
+		}
+	}
+
+	unpack_batch(out, h, 37);
+
+	for (int i = 0; i < 37; i++)
+	{
+		if (out[i] != unpack(h[i]))
+		{
+			throw std::logic_error("@see " __FILE__ ":" STRINGIZE(__LINE__));
+		}
+	}
+
+	unpack_batch(out, b, 37);
+
+	for (int i = 0; i < 37; i++)
+	{
+		if (out[i] != unpack(b[i]))
+		{
+			throw std::logic_error("@see " __FILE__ ":" STRINGIZE(__LINE__));
+		}
+	}
+}
+
+void test_transform()
+{
+	auto a = const_cast<Matrix4x4 const &>(A);
+
+	Vector4h h[11];
+	Vector4h g[11];
+	Vector4bf b[11];
+	Vector4bf c[11];
+
+	for (int i = 0; i < 11; i++)
+	{
+		h[i] = pack<half>(Vector4{std::cos(float(i)), std::sin(float(i)), float(i) / 11.f, 1.f});
+		b[i] = pack<bfloat16>(unpack(h[i]));
+	}
+
+	transform_batch(g, a, h, 11);
+	transform_batch(c, a, b, 11);
+
+	for (int i = 0; i < 11; i++)
+	{
+		auto const x = a * unpack(h[i]);
+		auto const y = unpack(g[i]);
+		auto const z = unpack(c[i]);
+
+		for (int j = 0; j < 4; j++)
+		{
+			if (!eq(x.data[j], y.data[j], 1.f / 1024.f) ||
+			    !eq(x.data[j], z.data[j], 1.f / 128.f))
+			{
+				throw std::logic_error("@see " __FILE__ ":" STRINGIZE(__LINE__));
+			}
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,199 @@
+#include <cmath>
+#include <cstdio>
+#include <stdexcept>
+#include <iostream>
+#include <utility>
+
+#include <libmath/batch.hh>
+#include <libmath/mapped.hh>
+#include <libmath/matrix.hh>
+#include <libmath/vector.hh>
+
+#ifdef WITH_SSE_INTRINSICS
+#	include <libmath/simd/sse.hh>
+#endif
+
+#ifdef WITH_ARM_INTRINSICS
+#	include <libmath/simd/arm.hh>
+#endif
+
+using namespace micro::math;
+using namespace micro::math::simd;
+
+#define STRINGIFY(s) #s
+#define STRINGIZE(s) STRINGIFY(s)
+
+constexpr std::size_t N = 37;
+
+constexpr char const *PATH = "libmath-test-mapped.bin";
+
+void test_roundtrip();
+void test_reject();
+
+inline float value(std::size_t i, std::size_t j) noexcept
+{
+	return std::sin(float(i * 7 + j)) * 4.f;
+}
+
+int main(int argc, char *argv[])
+{
+	(void)argc;
+	(void)argv;
+
+	try
+	{
+		test_roundtrip();
+		test_reject();
+	}
+	catch (std::exception const &e)
+	{
+		std::remove(PATH);
+
+		std::cerr << "=============================== CAUGHT EXCEPTION ===============================" << std::endl;
+		std::cerr << e.what() << std::endl;
+		std::cerr << "================================================================================" << std::endl;
+
+		return 1;
+	}
+
+	std::remove(PATH);
+
+	return 0;
+}
+
+void test_roundtrip()
+{
+	Matrix4x4 m[N];
+	Vector4 v[N];
+
+	for (std::size_t i = 0; i < N; i++)
+	{
+		for (std::size_t j = 0; j < 16; j++)
+		{
+			m[i].data[j / 4].data[j % 4] = value(i, j);
+		}
+
+		v[i] = Vector4{value(i, 0), value(i, 1), value(i, 2), 1.f};
+	}
+
+	if (!write_mapped(PATH, m, N))
+	{
+		throw std::logic_error("@see " __FILE__ ":" STRINGIZE(__LINE__));
+	}
+
+	TMappedSpan<Matrix4x4> a{PATH};
+
+	if (!a || a.size() != N || reinterpret_cast<std::uintptr_t>(a.data()) % cache_line != 0)
+	{
+		throw std::logic_error("@see " __FILE__ ":" STRINGIZE(__LINE__));
+	}
+
+	auto const b = std::move(a);
+
+	if (a || b.size() != N)
+	{
+		throw std::logic_error("@see " __FILE__ ":" STRINGIZE(__LINE__));
+	}
+
+	for (std::size_t i = 0; i < N; i++)
+	{
+		Vector4 t[1];
+
+		transform_batch(t, b[i], v + i, 1);
+
+		auto const r = m[i] * v[i];
+
+		for (std::size_t j = 0; j < 16; j++)
+		{
+			if (b[i].data[j / 4].data[j % 4] != m[i].data[j / 4].data[j % 4])
+			{
+				throw std::logic_error("@see " __FILE__ ":" STRINGIZE(__LINE__));
+			}
+		}
+
+		for (int j = 0; j < 4; j++)
+		{
+			if (std::abs(t[0].data[j] - r.data[j]) > 1E-4f)
+			{
+				throw std::logic_error("@see " __FILE__ ":" STRINGIZE(__LINE__));
+			}
+		}
+	}
+
+	//
+	// vector spans go straight into the batch kernels
+	//
+
+	if (!write_mapped(PATH, v, N))
+	{
+		throw std::logic_error("@see " __FILE__ ":" STRINGIZE(__LINE__));
+	}
+
+	TMappedSpan<Vector4> c{PATH};
+	Vector4 t[N];
+
+	transform_batch(t, m[0], c.data(), c.size());
+
+	for (std::size_t i = 0; i < N; i++)
+	{
+		auto const r = m[0] * v[i];
+
+		for (int j = 0; j < 4; j++)
+		{
+			if (std::abs(t[i].data[j] - r.data[j]) > 1E-4f)
+			{
+				throw std::logic_error("@see " __FILE__ ":" STRINGIZE(__LINE__));
+			}
+		}
+	}
+}
+
+void test_reject()
+{
+	Vector3 v[N] = {};
+
+	if (!write_mapped(PATH, v, N))
+	{
+		throw std::logic_error("@see " __FILE__ ":" STRINGIZE(__LINE__));
+	}
+
+	//
+	// shape, scalar type and layout must all match
+	//
+
+	if (TMappedSpan<Vector4>{PATH} || TMappedSpan<TVector3<double>>{PATH} ||
+	    TMappedSpan<TVector3<std::int32_t>>{PATH} || !TMappedSpan<Vector3>{PATH})
+	{
+		throw std::logic_error("@see " __FILE__ ":" STRINGIZE(__LINE__));
+	}
+
+	Matrix4x4 m[2] = {};
+
+	write_mapped(PATH, m, 2);
+
+	if (TMappedSpan<Matrix4x4C>{PATH} || !TMappedSpan<Matrix4x4>{PATH})
+	{
+		throw std::logic_error("@see " __FILE__ ":" STRINGIZE(__LINE__));
+	}
+
+	//
+	// truncated file
+	//
+
+	unsigned char buffer[cache_line + sizeof(Matrix4x4) * 2];
+
+	auto *f = std::fopen(PATH, "rb");
+	auto const size = std::fread(buffer, 1, sizeof(buffer), f);
+
+	std::fclose(f);
+
+	f = std::fopen(PATH, "wb");
+
+	std::fwrite(buffer, 1, size - 1, f);
+	std::fclose(f);
+
+	if (size != sizeof(buffer) || TMappedSpan<Matrix4x4>{PATH} || TMappedSpan<Matrix4x4>{"libmath-test-missing.bin"})
+	{
+		throw std::logic_error("@see " __FILE__ ":" STRINGIZE(__LINE__));
+	}
+}
\ No newline at end of file
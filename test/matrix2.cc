@@ -229,6 +229,13 @@ void test_mvm()
 	{
 		throw std::logic_error("@see " __FILE__ ":" STRINGIZE(__LINE__));
 	}
+
+	if (!eq(a * d, Vector2{a._11() * d.x() + a._12() * d.y(),
+			       a._21() * d.x() + a._22() * d.y()}) ||
+	    !eq(vector_cast<float>(matrix_cast<double>(a) * vector_cast<double>(d)), a * d))
+	{
+		throw std::logic_error("@see " __FILE__ ":" STRINGIZE(__LINE__));
+	}
 }
 
 void test_det()
@@ -40,6 +40,8 @@ void test_mvm();
 void test_sub();
 void test_det();
 void test_inv();
+void test_adj();
+void test_nrm();
 
 inline bool eq(Vector3 const &a,
 	       Vector3 const &b) 
@@ -84,6 +86,8 @@ int main(int argc, char *argv[])
 		test_sub();
 		test_det();
 		test_inv();
+		test_adj();
+		test_nrm();
 	}
 	catch (std::exception const &e)
 	{
@@ -239,6 +243,24 @@ void test_mvm()
 	{
 		throw std::logic_error("@see " __FILE__ ":" STRINGIZE(__LINE__));
 	}
+
+	if (!eq(a * d, Vector3{dot(a.data[0], d), dot(a.data[1], d), dot(a.data[2], d)}))
+	{
+		throw std::logic_error("@see " __FILE__ ":" STRINGIZE(__LINE__));
+	}
+
+	auto const f = Matrix3x4{a._11(), a._12(), a._13(), e.x(),
+				 a._21(), a._22(), a._23(), e.y(),
+				 a._31(), a._32(), a._33(), e.z()};
+	auto const g = TMatrix3x4<double>{a._11(), a._12(), a._13(), e.x(),
+					  a._21(), a._22(), a._23(), e.y(),
+					  a._31(), a._32(), a._33(), e.z()};
+
+	if (!eq(f * Vector4{d.x(), d.y(), d.z(), 1.f}, a * d + e) ||
+	    !eq(vector_cast<float>(g * TVector4<double>{d.x(), d.y(), d.z(), 1.}), a * d + e))
+	{
+		throw std::logic_error("@see " __FILE__ ":" STRINGIZE(__LINE__));
+	}
 }
 
 void test_det()
@@ -311,4 +333,42 @@ void test_inv()
 			throw std::logic_error("@see " __FILE__ ":" STRINGIZE(__LINE__));
 		}
 	}
+}
+
+void test_adj()
+{
+	auto a = const_cast<Matrix3x3 const &>(A);
+	auto b = const_cast<Matrix3x3 const &>(B);
+	auto c = const_cast<Matrix3x3 const &>(C);
+
+	if (!eq(adjoint(a) * a, det(a) * identity3x3<float>()) ||
+	    !eq(adjoint(b) * b, det(b) * identity3x3<float>()) ||
+	    !eq(adjoint(c) * c, det(c) * identity3x3<float>()) ||
+	    !eq(a * adjoint(a), det(a) * identity3x3<float>()) ||
+	    !eq(b * adjoint(b), det(b) * identity3x3<float>()) ||
+	    !eq(c * adjoint(c), det(c) * identity3x3<float>()))
+	{
+		throw std::logic_error("@see " __FILE__ ":" STRINGIZE(__LINE__));
+	}
+}
+
+void test_nrm()
+{
+	auto a = const_cast<Matrix3x3 const &>(A);
+	auto b = const_cast<Matrix3x3 const &>(B);
+
+	auto const m = Matrix4x4{a._11(), a._12(), a._13(), +7.f,
+				 a._21(), a._22(), a._23(), -3.f,
+				 a._31(), a._32(), a._33(), +5.f,
+				 0.f, 0.f, 0.f, 1.f};
+	auto const n = Matrix4x4{b._11(), b._12(), b._13(), 0.f,
+				 b._21(), b._22(), b._23(), 0.f,
+				 b._31(), b._32(), b._33(), 0.f,
+				 1.f, 2.f, 3.f, 1.f};
+
+	if (!eq(normal_matrix(m), transpose(inverse(a))) ||
+	    !eq(normal_matrix(n), transpose(inverse(b))))
+	{
+		throw std::logic_error("@see " __FILE__ ":" STRINGIZE(__LINE__));
+	}
 }
\ No newline at end of file
@@ -2,6 +2,7 @@
 #include <stdexcept>
 #include <iostream>
 
+#include <libmath/batch.hh>
 #include <libmath/matrix.hh>
 #include <libmath/vector.hh>
 
@@ -43,6 +44,9 @@ void test_mvm();
 void test_sub();
 void test_det();
 void test_inv();
+void test_aln();
+void test_stm();
+void test_col();
 
 inline bool eq(Vector4 const &a,
 	       Vector4 const &b) 
@@ -91,6 +95,9 @@ int main(int argc, char *argv[])
 		test_sub();
 		test_det();
 		test_inv();
+		test_aln();
+		test_stm();
+		test_col();
 	}
 	catch (std::exception const &e)
 	{
@@ -246,6 +253,12 @@ void test_mvm()
 	{
 		throw std::logic_error("@see " __FILE__ ":" STRINGIZE(__LINE__));
 	}
+
+	if (!eq(a * d, Vector4{dot(a.data[0], d), dot(a.data[1], d), dot(a.data[2], d), dot(a.data[3], d)}) ||
+	    !eq(vector_cast<float>(matrix_cast<double>(a) * vector_cast<double>(d)), a * d))
+	{
+		throw std::logic_error("@see " __FILE__ ":" STRINGIZE(__LINE__));
+	}
 }
 
 void test_det()
@@ -318,4 +331,220 @@ void test_inv()
 			throw std::logic_error("@see " __FILE__ ":" STRINGIZE(__LINE__));
 		}
 	}
+}
+
+void test_aln()
+{
+	static_assert(alignof(Matrix4x4A) == 64);
+	static_assert(alignof(TMatrix4x4A<double>) == 64);
+
+	auto a = const_cast<Matrix4x4 const &>(A);
+	auto b = const_cast<Matrix4x4 const &>(B);
+
+	Matrix4x4A const x = a;
+	Matrix4x4A const y = b;
+
+	if (!eq(x * y, a * b) ||
+	    !eq(y * x, b * a) ||
+	    !eq(transpose(x), transpose(a)))
+	{
+		throw std::logic_error("@see " __FILE__ ":" STRINGIZE(__LINE__));
+	}
+
+#if defined(WITH_SSE_INTRINSICS) || defined(WITH_ARM_INTRINSICS)
+	alignas(64) float o[4][4];
+
+	storea(o, x);
+
+	if (!eq(Matrix4x4{o[0][0], o[0][1], o[0][2], o[0][3],
+			  o[1][0], o[1][1], o[1][2], o[1][3],
+			  o[2][0], o[2][1], o[2][2], o[2][3],
+			  o[3][0], o[3][1], o[3][2], o[3][3]}, a))
+	{
+		throw std::logic_error("@see " __FILE__ ":" STRINGIZE(__LINE__));
+	}
+#endif
+}
+
+void test_stm()
+{
+#if defined(WITH_SSE_INTRINSICS) || defined(WITH_ARM_INTRINSICS)
+	auto a = const_cast<Matrix4x4 const &>(A);
+	auto b = const_cast<Matrix4x4 const &>(B);
+	auto c = const_cast<Matrix4x4 const &>(C);
+
+	Matrix4x4 src[9] = {a, b, c, a * b, b * c, c * a, a + b, b + c, c + a};
+
+	alignas(64) float dst[9][4][4];
+
+	stream_batch(dst, src, 9);
+
+	for (int i = 0; i < 9; i++)
+	{
+		auto const &o = dst[i];
+
+		if (!eq(Matrix4x4{o[0][0], o[0][1], o[0][2], o[0][3],
+				  o[1][0], o[1][1], o[1][2], o[1][3],
+				  o[2][0], o[2][1], o[2][2], o[2][3],
+				  o[3][0], o[3][1], o[3][2], o[3][3]}, src[i]))
+		{
+			throw std::logic_error("@see " __FILE__ ":" STRINGIZE(__LINE__));
+		}
+	}
+
+	//
+	// the other shapes are plain copies too, one vector per matrix row
+	//
+
+	Vector4 v[36];
+	Matrix3x4 m[9];
+
+	for (int i = 0; i < 36; i++)
+	{
+		v[i] = src[i / 4].data[i % 4];
+	}
+
+	for (int i = 0; i < 9; i++)
+	{
+		m[i].data[0] = src[i].data[0];
+		m[i].data[1] = src[i].data[1];
+		m[i].data[2] = src[i].data[2];
+	}
+
+	alignas(64) float vd[36][4];
+	alignas(64) float md[9][3][4];
+
+	stream_batch(vd, v, 36);
+	stream_batch(md, m, 9);
+
+	for (int i = 0; i < 144; i++)
+	{
+		if (vd[i / 4][i % 4] != v[i / 4].data[i % 4])
+		{
+			throw std::logic_error("@see " __FILE__ ":" STRINGIZE(__LINE__));
+		}
+	}
+
+	for (int i = 0; i < 108; i++)
+	{
+		if (md[i / 12][i / 4 % 3][i % 4] != m[i / 12].data[i / 4 % 3].data[i % 4])
+		{
+			throw std::logic_error("@see " __FILE__ ":" STRINGIZE(__LINE__));
+		}
+	}
+#endif
+
+#ifdef WITH_SSE_INTRINSICS
+	Matrix4x4A l[9];
+
+	for (int i = 0; i < 9; i++)
+	{
+		l[i] = src[i];
+	}
+
+	stream_batch(dst, l, 9);
+
+	for (int i = 0; i < 144; i++)
+	{
+		if (dst[i / 16][i / 4 % 4][i % 4] != l[i / 16].data[i / 4 % 4].data[i % 4])
+		{
+			throw std::logic_error("@see " __FILE__ ":" STRINGIZE(__LINE__));
+		}
+	}
+#endif
+
+#ifdef WITH_AVX_INTRINSICS
+	TVector4<double> w[36];
+	TMatrix4x4<double> p[9];
+	TMatrix4x4A<double> q[9];
+
+	for (int i = 0; i < 36; i++)
+	{
+		w[i] = vector_cast<double>(v[i]);
+	}
+
+	for (int i = 0; i < 9; i++)
+	{
+		p[i] = matrix_cast<double>(src[i]);
+		q[i] = p[i];
+	}
+
+	alignas(64) double wd[36][4];
+	alignas(64) double pd[9][4][4];
+	alignas(64) double qd[9][4][4];
+
+	stream_batch(wd, w, 36);
+	stream_batch(pd, p, 9);
+	stream_batch(qd, q, 9);
+
+	for (int i = 0; i < 144; i++)
+	{
+		if (wd[i / 4][i % 4] != w[i / 4].data[i % 4] ||
+		    pd[i / 16][i / 4 % 4][i % 4] != p[i / 16].data[i / 4 % 4].data[i % 4] ||
+		    qd[i / 16][i / 4 % 4][i % 4] != q[i / 16].data[i / 4 % 4].data[i % 4])
+		{
+			throw std::logic_error("@see " __FILE__ ":" STRINGIZE(__LINE__));
+		}
+	}
+#endif
+}
+
+void test_col()
+{
+	auto a = const_cast<Matrix4x4 const &>(A);
+	auto b = const_cast<Matrix4x4 const &>(B);
+
+	auto d = const_cast<Vector4 const &>(D);
+	auto e = const_cast<Vector4 const &>(E);
+
+	auto const p = column_major(a);
+	auto const q = column_major(b);
+
+	for (int i = 0; i < 16; i++)
+	{
+		if (p.data[i % 4].data[i / 4] != a.data[i / 4].data[i % 4])
+		{
+			throw std::logic_error("@see " __FILE__ ":" STRINGIZE(__LINE__));
+		}
+	}
+
+	if (!eq(row_major(p * q), a * b) ||
+	    !eq(row_major(transpose(p)), transpose(a)) ||
+	    !eq(p * d, a * d) ||
+	    !eq(p * e, a * e))
+	{
+		throw std::logic_error("@see " __FILE__ ":" STRINGIZE(__LINE__));
+	}
+
+	if (!eq(row_major(p + q), a + b) ||
+	    !eq(row_major(p - q), a - b) ||
+	    !eq(row_major(-p), -a) ||
+	    !eq(det(p), det(a)) ||
+	    !eq(row_major(inverse(p)), inverse(a)))
+	{
+		throw std::logic_error("@see " __FILE__ ":" STRINGIZE(__LINE__));
+	}
+
+	Vector4 src[5] = {d, e, d + e, d - e, d * e};
+	Vector4 dst[5];
+
+	transform_batch(dst, p, src, 5);
+
+	for (int i = 0; i < 5; i++)
+	{
+		if (!eq(dst[i], a * src[i]))
+		{
+			throw std::logic_error("@see " __FILE__ ":" STRINGIZE(__LINE__));
+		}
+	}
+
+	auto const r = column_major(matrix_cast<double>(a));
+	auto const s = column_major(matrix_cast<double>(b));
+	auto const t = vector_cast<double>(d);
+
+	if (!eq(matrix_cast<float>(row_major(r * s)), a * b) ||
+	    !eq(vector_cast<float>(r * t), a * d))
+	{
+		throw std::logic_error("@see " __FILE__ ":" STRINGIZE(__LINE__));
+	}
 }
\ No newline at end of file
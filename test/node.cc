@@ -0,0 +1,177 @@
+#include <cmath>
+#include <stdexcept>
+#include <iostream>
+
+#include <libmath/matrix.hh>
+#include <libmath/node.hh>
+#include <libmath/vector.hh>
+
+#ifdef WITH_SSE_INTRINSICS
+#	include <libmath/simd/sse.hh>
+#endif
+
+#ifdef WITH_ARM_INTRINSICS
+#	include <libmath/simd/arm.hh>
+#endif
+
+using namespace micro::math;
+using namespace micro::math::simd;
+
+#define STRINGIFY(s) #s
+#define STRINGIZE(s) STRINGIFY(s)
+
+void test_local();
+void test_world();
+void test_dirty();
+
+inline bool eq(Matrix4x4 const &a,
+	       Matrix4x4 const &b,
+	       float eps = 1E-5f) noexcept
+{
+	for (int i = 0; i < 16; i++)
+	{
+		if (std::abs(a.data[i / 4].data[i % 4] - b.data[i / 4].data[i % 4]) > eps)
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+int main(int argc, char *argv[])
+{
+	(void)argc;
+	(void)argv;
+
+	try
+	{
+		test_local();
+		test_world();
+		test_dirty();
+	}
+	catch (std::exception const &e)
+	{
+		std::cerr << "=============================== CAUGHT EXCEPTION ===============================" << std::endl;
+		std::cerr << e.what() << std::endl;
+		std::cerr << "================================================================================" << std::endl;
+
+		return 1;
+	}
+
+	return 0;
+}
+
+void test_local()
+{
+	auto const u = normalize(Vector3{1.f, 2.f, -.5f});
+
+	TransformNode a{Vector3{1.f, -2.f, 3.f}};
+
+	a.set_rotation(u, .7f);
+	a.set_scale(Vector3{2.f, .5f, 3.f});
+
+	auto const m = translate4x4(1.f, -2.f, 3.f) * rotate4x4(u, .7f) * scale4x4(2.f, .5f, 3.f);
+
+	if (!eq(a.local(), m) || !eq(a.world(), m))
+	{
+		throw std::logic_error("@see " __FILE__ ":" STRINGIZE(__LINE__));
+	}
+
+	auto const &w = a.world3x4();
+
+	for (int i = 0; i < 12; i++)
+	{
+		if (w.data[i / 4].data[i % 4] != a.world().data[i / 4].data[i % 4])
+		{
+			throw std::logic_error("@see " __FILE__ ":" STRINGIZE(__LINE__));
+		}
+	}
+}
+
+void test_world()
+{
+	TransformNode a{Vector3{0.f, 5.f, 0.f}, Vector4{0.f, 0.f, std::sin(.4f), std::cos(.4f)}};
+	TransformNode b{Vector3{1.f, 0.f, 0.f}, Vector4{0.f, 0.f, 0.f, 1.f}, Vector3{2.f, 2.f, 2.f}};
+	TransformNode c{Vector3{0.f, 0.f, -3.f}};
+
+	b.set_parent(&a);
+	c.set_parent(&b);
+
+	if (!eq(c.world(), a.local() * b.local() * c.local()) ||
+	    !eq(b.world(), a.local() * b.local()))
+	{
+		throw std::logic_error("@see " __FILE__ ":" STRINGIZE(__LINE__));
+	}
+
+	a.set_translation(Vector3{-1.f, 0.f, 4.f});
+
+	if (!eq(c.world(), a.local() * b.local() * c.local()))
+	{
+		throw std::logic_error("@see " __FILE__ ":" STRINGIZE(__LINE__));
+	}
+
+	c.set_parent(&a);
+
+	if (!eq(c.world(), a.local() * c.local()))
+	{
+		throw std::logic_error("@see " __FILE__ ":" STRINGIZE(__LINE__));
+	}
+}
+
+void test_dirty()
+{
+	TransformNode a{Vector3{1.f, 0.f, 0.f}};
+	TransformNode b{Vector3{0.f, 1.f, 0.f}};
+	TransformNode c{Vector3{0.f, 0.f, 1.f}};
+
+	b.set_parent(&a);
+	c.set_parent(&a);
+
+	b.world();
+	c.world();
+
+	auto const ga = a.generation();
+	auto const gb = b.generation();
+	auto const gc = c.generation();
+
+	//
+	// static hierarchy, nothing is rebuilt
+	//
+
+	b.world();
+	c.world3x4();
+
+	if (ga != 1 || gb != 1 || gc != 1 ||
+	    a.generation() != ga || b.generation() != gb || c.generation() != gc)
+	{
+		throw std::logic_error("@see " __FILE__ ":" STRINGIZE(__LINE__));
+	}
+
+	//
+	// a child change stays local, a parent change reaches both children
+	//
+
+	b.set_scale(Vector3{2.f, 2.f, 2.f});
+	b.world();
+	c.world();
+
+	if (a.generation() != ga || b.generation() != gb + 1 || c.generation() != gc)
+	{
+		throw std::logic_error("@see " __FILE__ ":" STRINGIZE(__LINE__));
+	}
+
+	a.set_translation(Vector3{0.f, 0.f, 0.f});
+	b.world();
+	c.world();
+
+	if (a.generation() != ga + 1 || b.generation() != gb + 2 || c.generation() != gc + 1)
+	{
+		throw std::logic_error("@see " __FILE__ ":" STRINGIZE(__LINE__));
+	}
+
+	if (!eq(c.world(), translate4x4(0.f, 0.f, 1.f)))
+	{
+		throw std::logic_error("@see " __FILE__ ":" STRINGIZE(__LINE__));
+	}
+}
\ No newline at end of file
@@ -0,0 +1,215 @@
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <stdexcept>
+#include <iostream>
+
+#include <libmath/aabb.hh>
+#include <libmath/matrix.hh>
+#include <libmath/occlusion.hh>
+#include <libmath/project.hh>
+#include <libmath/vector.hh>
+
+#ifdef WITH_SSE_INTRINSICS
+#	include <libmath/simd/sse.hh>
+#	include <libmath/simd/occlusion_sse.hh>
+#endif
+
+#ifdef WITH_ARM_INTRINSICS
+#	include <libmath/simd/arm.hh>
+#	include <libmath/simd/occlusion_arm.hh>
+#endif
+
+using namespace micro::math;
+using namespace micro::math::simd;
+
+#define STRINGIFY(s) #s
+#define STRINGIZE(s) STRINGIFY(s)
+
+void test_raster();
+void test_wide();
+void test_query();
+
+inline bool eq(float a,
+	       float b,
+	       float eps = 1E-5f) noexcept
+{
+	return std::abs(a - b) <= eps;
+}
+
+inline Matrix4x4 camera() noexcept
+{
+	return perspFOV_projection4x4(1.2f, 2.f, .5f, 100.f) *
+	       lookat4x4(Vector3{0.f, 1.f, 0.f}, Vector3{0.f, 0.f, 1.f}, Vector3{0.f, 0.f, 0.f});
+}
+
+/**
+ * @brief Renders a 20 x 10 wall at z = 20 and a triangle on top of it
+ */
+inline void render(OcclusionBuffer &b, unsigned threads)
+{
+	Vector3 const v[7] = {{-10.f, -5.f, 20.f}, {10.f, -5.f, 20.f}, {10.f, 5.f, 20.f}, {-10.f, 5.f, 20.f},
+			      {-2.f, -2.f, 15.f}, {2.f, -2.f, 15.f}, {0.f, 3.f, 15.f}};
+	std::uint32_t const i[9] = {0, 1, 2, 0, 2, 3, 4, 6, 5};
+
+	Vector3 screen[7];
+	std::uint8_t flags[7];
+
+	project_batch(static_cast<Vector4 *>(nullptr), static_cast<Vector3 *>(nullptr),
+		      screen, flags, camera(), b.viewport(), v, 7);
+
+	clear(b);
+	bin_triangles(b, screen, flags, i, 3);
+	rasterize(b, threads);
+}
+
+int main(int argc, char *argv[])
+{
+	(void)argc;
+	(void)argv;
+
+	try
+	{
+		test_raster();
+		test_wide();
+		test_query();
+	}
+	catch (std::exception const &e)
+	{
+		std::cerr << "=============================== CAUGHT EXCEPTION ===============================" << std::endl;
+		std::cerr << e.what() << std::endl;
+		std::cerr << "================================================================================" << std::endl;
+
+		return 1;
+	}
+
+	return 0;
+}
+
+void test_raster()
+{
+	OcclusionBuffer a{250, 124};
+	OcclusionBuffer b{250, 124};
+	OcclusionBuffer c{250, 124};
+
+	render(a, 1);
+	render(b, 4);
+
+	c.triangles = a.triangles;
+	c.bins = a.bins;
+
+	micro::math::rasterize<float>(c, 1);
+
+	if (a.tiles() != 32 * 16 || a.depth != b.depth || a.tile_min != b.tile_min || a.tile_max != b.tile_max)
+	{
+		throw std::logic_error("@see " __FILE__ ":" STRINGIZE(__LINE__));
+	}
+
+	//
+	// the SIMD and generic rasterisers round every multiply-add the same way,
+	// fused where the target has FMA, whatever the contraction setting
+	//
+
+	if (a.depth != c.depth || a.tile_min != c.tile_min || a.tile_max != c.tile_max)
+	{
+		throw std::logic_error("@see " __FILE__ ":" STRINGIZE(__LINE__));
+	}
+
+	//
+	// the centre tiles are covered by the near triangle, the corners are empty
+	//
+
+	auto const n = camera() * Vector4{0.f, 0.f, 15.f, 1.f};
+	auto const f = camera() * Vector4{0.f, 0.f, 20.f, 1.f};
+	auto const t = (124 / 2 / 8) * a.tiles_x + 250 / 2 / 8;
+
+	if (!eq(a.tile_min[t], n.z() / n.w()) || !eq(a.tile_max[t], n.z() / n.w()) ||
+	    a.tile_min[0] != 1.f || a.tile_max[a.tiles() - 1] != 1.f)
+	{
+		throw std::logic_error("@see " __FILE__ ":" STRINGIZE(__LINE__));
+	}
+
+	if (std::count_if(a.depth.begin(), a.depth.end(), [&](float d) { return eq(d, f.z() / f.w()); }) == 0)
+	{
+		throw std::logic_error("@see " __FILE__ ":" STRINGIZE(__LINE__));
+	}
+}
+
+void test_wide()
+{
+	//
+	// a 400 x 200 wall at z = 20 has every vertex outside the viewport and
+	// still covers all of it
+	//
+
+	Vector3 const v[4] = {{-200.f, -100.f, 20.f}, {200.f, -100.f, 20.f}, {200.f, 100.f, 20.f}, {-200.f, 100.f, 20.f}};
+	std::uint32_t const i[6] = {0, 1, 2, 0, 2, 3};
+
+	OcclusionBuffer a{250, 124};
+	OcclusionBuffer b{250, 124};
+
+	Vector3 screen[4];
+	std::uint8_t flags[4];
+
+	project_batch(static_cast<Vector4 *>(nullptr), static_cast<Vector3 *>(nullptr),
+		      screen, flags, camera(), a.viewport(), v, 4);
+
+	if (flags[0] == 0 || (flags[0] & clip_near) != 0)
+	{
+		throw std::logic_error("@see " __FILE__ ":" STRINGIZE(__LINE__));
+	}
+
+	clear(a);
+	bin_triangles(a, screen, flags, i, 2);
+	rasterize(a, 1);
+
+	b.triangles = a.triangles;
+	b.bins = a.bins;
+
+	micro::math::rasterize<float>(b, 1);
+
+	auto const f = camera() * Vector4{0.f, 0.f, 20.f, 1.f};
+
+	for (std::size_t t = 0; t < a.tiles(); t++)
+	{
+		if (!eq(a.tile_max[t], f.z() / f.w()) || !eq(b.tile_max[t], f.z() / f.w()))
+		{
+			throw std::logic_error("@see " __FILE__ ":" STRINGIZE(__LINE__));
+		}
+	}
+
+	if (!occluded(a, camera(), AABB{Vector3{-50.f, -20.f, 30.f}, Vector3{50.f, 20.f, 40.f}}))
+	{
+		throw std::logic_error("@see " __FILE__ ":" STRINGIZE(__LINE__));
+	}
+}
+
+void test_query()
+{
+	OcclusionBuffer b{250, 124};
+
+	render(b, 2);
+
+	auto const m = camera();
+
+	if (!occluded(b, m, AABB{Vector3{-1.f, -1.f, 40.f}, Vector3{1.f, 1.f, 42.f}}) ||
+	    !occluded(b, m, AABB{Vector3{-8.f, -4.f, 21.f}, Vector3{8.f, 4.f, 60.f}}) ||
+	    !occluded(b, m * translate4x4(0.f, 0.f, 30.f), AABB{Vector3{-1.f, -1.f, 0.f}, Vector3{1.f, 1.f, 1.f}}))
+	{
+		throw std::logic_error("@see " __FILE__ ":" STRINGIZE(__LINE__));
+	}
+
+	//
+	// in front, beside, straddling the near plane, behind the camera
+	//
+
+	if (occluded(b, m, AABB{Vector3{-1.f, -1.f, 10.f}, Vector3{1.f, 1.f, 11.f}}) ||
+	    occluded(b, m, AABB{Vector3{-3.f, -1.f, 16.f}, Vector3{3.f, 1.f, 17.f}}) ||
+	    occluded(b, m, AABB{Vector3{30.f, -1.f, 40.f}, Vector3{32.f, 1.f, 42.f}}) ||
+	    occluded(b, m, AABB{Vector3{-8.f, -4.f, 19.f}, Vector3{8.f, 4.f, 60.f}}) ||
+	    occluded(b, m, AABB{Vector3{-1.f, -1.f, 0.f}, Vector3{1.f, 1.f, 40.f}}) ||
+	    occluded(b, m, AABB{Vector3{-1.f, -1.f, -10.f}, Vector3{1.f, 1.f, -5.f}}))
+	{
+		throw std::logic_error("@see " __FILE__ ":" STRINGIZE(__LINE__));
+	}
+}
\ No newline at end of file
@@ -0,0 +1,140 @@
+#include <cmath>
+#include <stdexcept>
+#include <iostream>
+
+#include <libmath/matrix.hh>
+#include <libmath/origin.hh>
+#include <libmath/vector.hh>
+
+#ifdef WITH_SSE_INTRINSICS
+#	include <libmath/simd/sse.hh>
+#endif
+
+#ifdef WITH_ARM_INTRINSICS
+#	include <libmath/simd/arm.hh>
+#endif
+
+using namespace micro::math;
+using namespace micro::math::simd;
+
+#define STRINGIFY(s) #s
+#define STRINGIZE(s) STRINGIFY(s)
+
+constexpr std::size_t N = 37;
+
+volatile TVector3<double> O = {6378137.25, -1234567.75, 9876543.5};
+
+void test_snap();
+void test_batch();
+void test_view();
+
+inline double value(std::size_t i, std::size_t j) noexcept
+{
+	return std::sin(double(i * 7 + j)) * 100.;
+}
+
+int main(int argc, char *argv[])
+{
+	(void)argc;
+	(void)argv;
+
+	try
+	{
+		test_snap();
+		test_batch();
+		test_view();
+	}
+	catch (std::exception const &e)
+	{
+		std::cerr << "=============================== CAUGHT EXCEPTION ===============================" << std::endl;
+		std::cerr << e.what() << std::endl;
+		std::cerr << "================================================================================" << std::endl;
+
+		return 1;
+	}
+
+	return 0;
+}
+
+void test_snap()
+{
+	auto const o = snap_origin(TVector3<double>{1030.5, -10.25, 999.75}, 1024.);
+
+	if (o.x() != 1024. || o.y() != -1024. || o.z() != 0.)
+	{
+		throw std::logic_error("@see " __FILE__ ":" STRINGIZE(__LINE__));
+	}
+}
+
+void test_batch()
+{
+	auto const o = const_cast<TVector3<double> const &>(O);
+
+	TVector3<double> p[N];
+	TVector3<float> q[N];
+	TMatrix3x4<double> m[N];
+	TMatrix3x4<float> k[N];
+
+	for (std::size_t i = 0; i < N; i++)
+	{
+		p[i] = o + TVector3<double>{value(i, 0), value(i, 1), value(i, 2)};
+
+		for (int j = 0; j < 3; j++)
+		{
+			m[i].data[j] = TVector4<double>{value(i, j * 4 + 3), value(i, j * 4 + 4), value(i, j * 4 + 5), p[i].data[j]};
+		}
+	}
+
+	rebase_batch(q, p, o, N);
+	rebase_batch(k, m, o, N);
+
+	for (std::size_t i = 0; i < N; i++)
+	{
+		for (int j = 0; j < 3; j++)
+		{
+			//
+			// exact: the subtraction is done in double, only then rounded
+			//
+
+			if (q[i].data[j] != float(p[i].data[j] - o.data[j]))
+			{
+				throw std::logic_error("@see " __FILE__ ":" STRINGIZE(__LINE__));
+			}
+
+			for (int c = 0; c < 4; c++)
+			{
+				if (k[i].data[j].data[c] != (c < 3 ? float(m[i].data[j].data[c]) : q[i].data[j]))
+				{
+					throw std::logic_error("@see " __FILE__ ":" STRINGIZE(__LINE__));
+				}
+			}
+		}
+	}
+}
+
+void test_view()
+{
+	auto const o = const_cast<TVector3<double> const &>(O);
+	auto const eye = o + TVector3<double>{10., 2., -3.};
+	auto const fwd = normalize(TVector3<double>{1., -.5, 2.});
+	auto const top = normalize(TVector3<double>{0., 1., 0.} - fwd * fwd.y());
+
+	auto const view = lookto4x4(top, fwd, eye);
+	auto const rel = rebase_view<float>(view, o);
+
+	for (std::size_t i = 0; i < N; i++)
+	{
+		auto const p = o + TVector3<double>{value(i, 0), value(i, 1), value(i, 2)};
+		auto const q = rebase<float>(p, o);
+		auto const a = view * TVector4<double>{p.x(), p.y(), p.z(), 1.};
+		auto const b = rel * Vector4{q.x(), q.y(), q.z(), 1.f};
+
+		for (int j = 0; j < 4; j++)
+		{
+			if (std::abs(a.data[j] - double(b.data[j])) > 1E-4)
+			{
+				throw std::logic_error("@see " __FILE__ ":" STRINGIZE(__LINE__));
+			}
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,167 @@
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <stdexcept>
+#include <iostream>
+
+#include <libmath/matrix.hh>
+#include <libmath/project.hh>
+#include <libmath/vector.hh>
+
+#ifdef WITH_SSE_INTRINSICS
+#	include <libmath/simd/sse.hh>
+#endif
+
+#ifdef WITH_ARM_INTRINSICS
+#	include <libmath/simd/arm.hh>
+#endif
+
+using namespace micro::math;
+using namespace micro::math::simd;
+
+#define STRINGIFY(s) #s
+#define STRINGIZE(s) STRINGIFY(s)
+
+constexpr std::size_t N = 37;
+
+void test_flags();
+void test_project();
+
+inline bool eq(float a,
+	       float b,
+	       float eps = 1E-4f) noexcept
+{
+	return std::abs(a - b) <= eps ||
+	       std::abs(a - b) <= eps * std::max(std::abs(a), std::abs(b));
+}
+
+inline Vector3 position(std::size_t i) noexcept
+{
+	return Vector3{std::sin(float(i) * 1.7f) * 40.f,
+		       std::cos(float(i) * 2.3f) * 20.f,
+		       float(i * 13 % 131) - 10.f};
+}
+
+int main(int argc, char *argv[])
+{
+	(void)argc;
+	(void)argv;
+
+	try
+	{
+		test_flags();
+		test_project();
+	}
+	catch (std::exception const &e)
+	{
+		std::cerr << "=============================== CAUGHT EXCEPTION ===============================" << std::endl;
+		std::cerr << e.what() << std::endl;
+		std::cerr << "================================================================================" << std::endl;
+
+		return 1;
+	}
+
+	return 0;
+}
+
+void test_flags()
+{
+	if (clip_flags(Vector4{0.f, 0.f, .5f, 1.f}) != 0 ||
+	    clip_flags(Vector4{-2.f, 0.f, .5f, 1.f}) != clip_left ||
+	    clip_flags(Vector4{2.f, 2.f, .5f, 1.f}) != (clip_right | clip_top) ||
+	    clip_flags(Vector4{0.f, -2.f, -1.f, 1.f}) != (clip_bottom | clip_near) ||
+	    clip_flags(Vector4{0.f, 0.f, 2.f, 1.f}) != clip_far)
+	{
+		throw std::logic_error("@see " __FILE__ ":" STRINGIZE(__LINE__));
+	}
+
+	auto const s = viewport(Viewport{10.f, 20.f, 640.f, 480.f}, Vector3{-1.f, 1.f, .25f});
+	auto const t = viewport(Viewport{10.f, 20.f, 640.f, 480.f}, Vector3{1.f, -1.f, .75f});
+
+	if (s.x() != 10.f || s.y() != 20.f || s.z() != .25f ||
+	    t.x() != 650.f || t.y() != 500.f || t.z() != .75f)
+	{
+		throw std::logic_error("@see " __FILE__ ":" STRINGIZE(__LINE__));
+	}
+}
+
+void test_project()
+{
+	auto const m = perspFOV_projection4x4(1.2f, 16.f / 9.f, .5f, 100.f) *
+		       lookat4x4(Vector3{0.f, 1.f, 0.f}, Vector3{0.f, 0.f, 10.f}, Vector3{0.f, 0.f, 0.f});
+	auto const v = Viewport{0.f, 0.f, 1920.f, 1080.f};
+
+	Vector3 src[N];
+	Vector4 clip[N];
+	Vector3 ndc[N];
+	Vector3 screen[N];
+	std::uint8_t flags[N];
+	std::uint32_t visible[N];
+
+	for (std::size_t i = 0; i < N; i++)
+	{
+		src[i] = position(i);
+	}
+
+	auto const k = project_batch(clip, ndc, screen, flags, m, v, src, N, visible);
+
+	std::size_t j = 0;
+
+	for (std::size_t i = 0; i < N; i++)
+	{
+		auto const c = m * Vector4{src[i].x(), src[i].y(), src[i].z(), 1.f};
+		auto const f = clip_flags(c);
+
+		for (int l = 0; l < 4; l++)
+		{
+			if (!eq(clip[i].data[l], c.data[l]))
+			{
+				throw std::logic_error("@see " __FILE__ ":" STRINGIZE(__LINE__));
+			}
+		}
+
+		if (flags[i] != f)
+		{
+			throw std::logic_error("@see " __FILE__ ":" STRINGIZE(__LINE__));
+		}
+
+		if (f != 0)
+		{
+			continue;
+		}
+
+		auto const d = Vector3{c.x() / c.w(), c.y() / c.w(), c.z() / c.w()};
+		auto const s = viewport(v, d);
+
+		if (j >= k || visible[j++] != i)
+		{
+			throw std::logic_error("@see " __FILE__ ":" STRINGIZE(__LINE__));
+		}
+
+		for (int l = 0; l < 3; l++)
+		{
+			if (!eq(ndc[i].data[l], d.data[l]) ||
+			    !eq(screen[i].data[l], s.data[l]))
+			{
+				throw std::logic_error("@see " __FILE__ ":" STRINGIZE(__LINE__));
+			}
+		}
+	}
+
+	if (j != k || k == 0 || k == N)
+	{
+		throw std::logic_error("@see " __FILE__ ":" STRINGIZE(__LINE__));
+	}
+
+	//
+	// counting only
+	//
+
+	if (project_batch(static_cast<Vector4 *>(nullptr),
+			  static_cast<Vector3 *>(nullptr),
+			  static_cast<Vector3 *>(nullptr),
+			  static_cast<std::uint8_t *>(nullptr), m, v, src, N) != k)
+	{
+		throw std::logic_error("@see " __FILE__ ":" STRINGIZE(__LINE__));
+	}
+}
\ No newline at end of file
@@ -0,0 +1,222 @@
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <iostream>
+
+#include <libmath/aabb.hh>
+#include <libmath/matrix.hh>
+#include <libmath/quantize.hh>
+#include <libmath/vector.hh>
+
+#ifdef WITH_SSE_INTRINSICS
+#	include <libmath/simd/sse.hh>
+#endif
+
+#ifdef WITH_ARM_INTRINSICS
+#	include <libmath/simd/arm.hh>
+#endif
+
+using namespace micro::math;
+using namespace micro::math::simd;
+
+#define STRINGIFY(s) #s
+#define STRINGIZE(s) STRINGIFY(s)
+
+constexpr std::size_t N = 37;
+
+void test_normal();
+void test_quaternion();
+void test_position();
+
+inline bool eq(float a,
+	       float b,
+	       float eps) noexcept
+{
+	return std::abs(a - b) <= eps;
+}
+
+inline Vector3 direction(std::size_t i) noexcept
+{
+	auto const t = float(i) * 0.7f;
+	auto const p = float(i) * 1.3f;
+
+	return normalize(Vector3{std::sin(t) * std::cos(p), std::sin(t) * std::sin(p), std::cos(t)});
+}
+
+int main(int argc, char *argv[])
+{
+	(void)argc;
+	(void)argv;
+
+	try
+	{
+		test_normal();
+		test_quaternion();
+		test_position();
+	}
+	catch (std::exception const &e)
+	{
+		std::cerr << "=============================== CAUGHT EXCEPTION ===============================" << std::endl;
+		std::cerr << e.what() << std::endl;
+		std::cerr << "================================================================================" << std::endl;
+
+		return 1;
+	}
+
+	return 0;
+}
+
+void test_normal()
+{
+	Vector3 src[N];
+	Vector3 out[N];
+	PackedNormal e[N];
+
+	for (std::size_t i = 0; i < N; i++)
+	{
+		src[i] = direction(i);
+	}
+
+	src[3] = Vector3{0.f, 0.f, -1.f};
+	src[4] = Vector3{-0.f, 1.f, 0.f};
+	src[6] = Vector3{0.f, 0.f, 0.f};
+
+	encode_batch(e, src, N);
+	decode_batch(out, e, N);
+
+	for (std::size_t i = 0; i < N; i++)
+	{
+		auto const s = encode_normal(src[i]);
+
+		if (e[i].data[0] != s.data[0] ||
+		    e[i].data[1] != s.data[1])
+		{
+			throw std::logic_error("@see " __FILE__ ":" STRINGIZE(__LINE__));
+		}
+
+		if (i == 6)
+		{
+			//
+			// the zero vector has no direction, it comes back as +Z
+			//
+
+			if (s.data[0] != 0 || s.data[1] != 0 || out[i].z() != 1.f)
+			{
+				throw std::logic_error("@see " __FILE__ ":" STRINGIZE(__LINE__));
+			}
+
+			continue;
+		}
+
+		if (!eq(dot(out[i], src[i]), 1.f, 1E-6f) ||
+		    !eq(len(out[i]), 1.f, 1E-6f))
+		{
+			throw std::logic_error("@see " __FILE__ ":" STRINGIZE(__LINE__));
+		}
+	}
+}
+
+void test_quaternion()
+{
+	Vector4 src[N];
+	Vector4 out[N];
+	Matrix3x3 rot[N];
+	PackedQuaternion e[N];
+
+	for (std::size_t i = 0; i < N; i++)
+	{
+		auto const a = direction(i);
+		auto const t = float(i) * 0.37f;
+
+		src[i] = Vector4{a.x() * std::sin(t), a.y() * std::sin(t), a.z() * std::sin(t), std::cos(t)};
+	}
+
+	src[5] = Vector4{0.f, 0.f, 0.f, -1.f};
+
+	encode_batch(e, src, N);
+	decode_batch(out, e, N);
+	decode_batch(rot, e, N);
+
+	for (std::size_t i = 0; i < N; i++)
+	{
+		auto const s = encode_quaternion(src[i]);
+
+		if (std::abs(int(e[i].data[0]) - int(s.data[0])) > 2 ||
+		    std::abs(int(e[i].data[1]) - int(s.data[1])) > 2 ||
+		    std::abs(int(e[i].data[2]) - int(s.data[2])) > 2)
+		{
+			throw std::logic_error("@see " __FILE__ ":" STRINGIZE(__LINE__));
+		}
+
+		//
+		// q and -q are the same rotation
+		//
+
+		if (!eq(std::abs(dot(out[i], src[i])), 1.f, 1E-4f))
+		{
+			throw std::logic_error("@see " __FILE__ ":" STRINGIZE(__LINE__));
+		}
+
+		auto const r = rotate3x3(src[i]);
+
+		for (int j = 0; j < 9; j++)
+		{
+			if (!eq(rot[i].data[j / 3].data[j % 3], r.data[j / 3].data[j % 3], 1E-3f))
+			{
+				throw std::logic_error("@see " __FILE__ ":" STRINGIZE(__LINE__));
+			}
+		}
+	}
+}
+
+void test_position()
+{
+	Vector3 src[N];
+	Vector3 out[N];
+	PackedPosition e[N];
+
+	AABB b{Vector3{-10.f, 0.f, 5.f}, Vector3{10.f, 0.f, 105.f}};
+
+	for (std::size_t i = 0; i < N; i++)
+	{
+		src[i] = Vector3{std::sin(float(i)) * 10.f, 0.f, 5.f + float(i * i % 101)};
+	}
+
+	src[7] = Vector3{50.f, 1.f, -50.f}; // clamped
+
+	encode_batch(e, src, N, b);
+	decode_batch(out, e, N, b);
+
+	auto const step = extent(b) / quantize_unorm16;
+
+	for (std::size_t i = 0; i < N; i++)
+	{
+		auto const s = encode_position(src[i], b);
+
+		for (int j = 0; j < 3; j++)
+		{
+			if (std::abs(int(e[i].data[j]) - int(s.data[j])) > 1)
+			{
+				throw std::logic_error("@see " __FILE__ ":" STRINGIZE(__LINE__));
+			}
+		}
+
+		if (i == 7)
+		{
+			continue;
+		}
+
+		if (!contains(b, out[i]) ||
+		    !eq(out[i].x(), src[i].x(), step.x()) ||
+		    !eq(out[i].y(), src[i].y(), step.y()) ||
+		    !eq(out[i].z(), src[i].z(), step.z()))
+		{
+			throw std::logic_error("@see " __FILE__ ":" STRINGIZE(__LINE__));
+		}
+	}
+
+	if (out[7].x() != 10.f || out[7].y() != 0.f || out[7].z() != 5.f)
+	{
+		throw std::logic_error("@see " __FILE__ ":" STRINGIZE(__LINE__));
+	}
+}
\ No newline at end of file
@@ -0,0 +1,224 @@
+#include <cmath>
+#include <cstdint>
+#include <stdexcept>
+#include <iostream>
+#include <vector>
+
+#include <libmath/matrix.hh>
+#include <libmath/serialize.hh>
+#include <libmath/vector.hh>
+
+#ifdef WITH_SSE_INTRINSICS
+#	include <libmath/simd/sse.hh>
+#endif
+
+#ifdef WITH_ARM_INTRINSICS
+#	include <libmath/simd/arm.hh>
+#endif
+
+using namespace micro::math;
+using namespace micro::math::simd;
+
+#define STRINGIFY(s) #s
+#define STRINGIZE(s) STRINGIFY(s)
+
+constexpr std::size_t N = 37;
+
+void test_raw();
+void test_quantized();
+void test_delta();
+
+inline float value(std::size_t i, std::size_t j) noexcept
+{
+	return std::sin(float(i * 7 + j)) * 4.f;
+}
+
+int main(int argc, char *argv[])
+{
+	(void)argc;
+	(void)argv;
+
+	try
+	{
+		test_raw();
+		test_quantized();
+		test_delta();
+	}
+	catch (std::exception const &e)
+	{
+		std::cerr << "=============================== CAUGHT EXCEPTION ===============================" << std::endl;
+		std::cerr << e.what() << std::endl;
+		std::cerr << "================================================================================" << std::endl;
+
+		return 1;
+	}
+
+	return 0;
+}
+
+void test_raw()
+{
+	//
+	// scalars are little-endian on the wire
+	//
+
+	TVector2<std::int32_t> const p = {0x01020304, -2};
+
+	std::uint8_t b[serialized_size<TVector2<std::int32_t>>(1)];
+
+	if (serialize_batch(b, &p, 0) != 0 || serialize_batch(b, &p, 1) != 8 ||
+	    b[0] != 0x04 || b[1] != 0x03 || b[2] != 0x02 || b[3] != 0x01 ||
+	    b[4] != 0xfe || b[5] != 0xff || b[6] != 0xff || b[7] != 0xff)
+	{
+		throw std::logic_error("@see " __FILE__ ":" STRINGIZE(__LINE__));
+	}
+
+	Matrix4x4 m[N];
+	Matrix4x4 r[N];
+	TVector3<double> u[N];
+	TVector3<double> v[N];
+
+	for (std::size_t i = 0; i < N; i++)
+	{
+		for (std::size_t j = 0; j < 16; j++)
+		{
+			m[i].data[j / 4].data[j % 4] = value(i, j);
+		}
+
+		u[i] = TVector3<double>{value(i, 0), value(i, 1), value(i, 2)};
+	}
+
+	std::vector<std::uint8_t> a(serialized_size<Matrix4x4>(N) + serialized_size<TVector3<double>>(N));
+
+	auto k = serialize_batch(a.data(), m, N);
+
+	k += serialize_batch(a.data() + k, u, N);
+
+	auto l = deserialize_batch(r, a.data(), N);
+
+	l += deserialize_batch(v, a.data() + l, N);
+
+	if (k != a.size() || l != a.size())
+	{
+		throw std::logic_error("@see " __FILE__ ":" STRINGIZE(__LINE__));
+	}
+
+	for (std::size_t i = 0; i < N; i++)
+	{
+		for (std::size_t j = 0; j < 16; j++)
+		{
+			if (r[i].data[j / 4].data[j % 4] != m[i].data[j / 4].data[j % 4] ||
+			    (j < 3 && v[i].data[j] != u[i].data[j]))
+			{
+				throw std::logic_error("@see " __FILE__ ":" STRINGIZE(__LINE__));
+			}
+		}
+	}
+}
+
+void test_quantized()
+{
+	Matrix3x4 m[N];
+	Matrix3x4 r[N];
+
+	for (std::size_t i = 0; i < N; i++)
+	{
+		for (std::size_t j = 0; j < 12; j++)
+		{
+			m[i].data[j / 4].data[j % 4] = value(i, j) * 1.25f; // some fall outside the range
+		}
+	}
+
+	std::uint8_t a[N * 12 * 2];
+	std::uint8_t b[N * 12 * 2];
+
+	auto const k = serialize_quantized(a, m, N, -4.f, 4.f);
+	auto const l = deserialize_quantized(r, a, N, -4.f, 4.f);
+
+	micro::math::serialize_quantized(b, m, N, -4.f, 4.f);
+
+	if (k != sizeof(a) || l != sizeof(a))
+	{
+		throw std::logic_error("@see " __FILE__ ":" STRINGIZE(__LINE__));
+	}
+
+	for (std::size_t i = 0; i < N; i++)
+	{
+		for (std::size_t j = 0; j < 12; j++)
+		{
+			auto const x = std::fmin(std::fmax(m[i].data[j / 4].data[j % 4], -4.f), 4.f);
+
+			if (std::abs(r[i].data[j / 4].data[j % 4] - x) > 8.f / 131070.f + 1E-6f ||
+			    a[(i * 12 + j) * 2] != b[(i * 12 + j) * 2] || a[(i * 12 + j) * 2 + 1] != b[(i * 12 + j) * 2 + 1])
+			{
+				throw std::logic_error("@see " __FILE__ ":" STRINGIZE(__LINE__));
+			}
+		}
+	}
+
+	//
+	// vector spans run as 3 N scalars, so the wide kernels see them too
+	//
+
+	Vector3 p[N];
+	Vector3 q[N];
+
+	for (std::size_t i = 0; i < N; i++)
+	{
+		p[i] = Vector3{value(i, 0), value(i, 1), value(i, 2)};
+	}
+
+	serialize_quantized(a, p, N, -4.f, 4.f);
+	deserialize_quantized(q, a, N, -4.f, 4.f);
+	micro::math::serialize_quantized(b, p, N, -4.f, 4.f);
+
+	for (std::size_t i = 0; i < N * 3; i++)
+	{
+		if (std::abs(q[i / 3].data[i % 3] - p[i / 3].data[i % 3]) > 8.f / 131070.f + 1E-6f ||
+		    a[i * 2] != b[i * 2] || a[i * 2 + 1] != b[i * 2 + 1])
+		{
+			throw std::logic_error("@see " __FILE__ ":" STRINGIZE(__LINE__));
+		}
+	}
+}
+
+void test_delta()
+{
+	//
+	// a slowly moving transform, the common case for replication
+	//
+
+	Matrix4x4 m[N];
+	Matrix4x4 r[N];
+
+	for (std::size_t i = 0; i < N; i++)
+	{
+		m[i] = translate4x4(100.f + float(i) * .01f, 2.f, -50.f) * rotate4x4(Vector3{0.f, 1.f, 0.f}, float(i) * .001f);
+	}
+
+	constexpr float step = 1.f / 4096.f;
+
+	std::vector<std::uint8_t> a(delta_bound<Matrix4x4>(N));
+
+	auto const k = serialize_delta(a.data(), m, N, step);
+	auto const l = deserialize_delta(r, a.data(), k, N, step);
+
+	if (k == 0 || k != l || k >= serialized_size<Matrix4x4>(N) / 3 ||
+	    deserialize_delta(r, a.data(), k - 1, N, step) != 0)
+	{
+		throw std::logic_error("@see " __FILE__ ":" STRINGIZE(__LINE__));
+	}
+
+	deserialize_delta(r, a.data(), k, N, step);
+
+	for (std::size_t i = 0; i < N; i++)
+	{
+		for (std::size_t j = 0; j < 16; j++)
+		{
+			if (std::abs(r[i].data[j / 4].data[j % 4] - m[i].data[j / 4].data[j % 4]) > step / 2.f + 1E-5f)
+			{
+				throw std::logic_error("@see " __FILE__ ":" STRINGIZE(__LINE__));
+			}
+		}
+	}
+}
\ No newline at end of file
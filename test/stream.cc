@@ -0,0 +1,219 @@
+#include <cmath>
+#include <cstdio>
+#include <stdexcept>
+#include <iostream>
+#include <vector>
+
+#include <libmath/matrix.hh>
+#include <libmath/stream.hh>
+#include <libmath/vector.hh>
+
+#ifdef WITH_SSE_INTRINSICS
+#	include <libmath/simd/sse.hh>
+#	include <libmath/simd/stream_sse.hh>
+#endif
+
+#ifdef WITH_ARM_INTRINSICS
+#	include <libmath/simd/arm.hh>
+#	include <libmath/simd/stream_arm.hh>
+#endif
+
+#ifdef _WIN32
+#	define fileno _fileno
+#endif
+
+using namespace micro::math;
+using namespace micro::math::simd;
+
+#define STRINGIFY(s) #s
+#define STRINGIZE(s) STRINGIFY(s)
+
+constexpr std::size_t N = 1000;
+
+void test_transform();
+void test_project();
+void test_partial();
+
+inline float value(std::size_t i, std::size_t j) noexcept
+{
+	return std::sin(float(i * 7 + j)) * 4.f;
+}
+
+/**
+ * @brief Temporary file holding n records, positioned at its start
+ */
+template <class T>
+inline std::FILE *input(T const *src, std::size_t n)
+{
+	auto *f = std::tmpfile();
+
+	if (!f || std::fwrite(src, sizeof(T), n, f) != n || std::fflush(f) != 0)
+	{
+		throw std::logic_error("@see " __FILE__ ":" STRINGIZE(__LINE__));
+	}
+
+	std::rewind(f);
+
+	return f;
+}
+
+template <class T>
+inline std::vector<T> output(std::FILE *f)
+{
+	std::vector<T> r(N);
+
+	std::rewind(f);
+
+	r.resize(std::fread(r.data(), sizeof(T), N, f));
+
+	return r;
+}
+
+int main(int argc, char *argv[])
+{
+	(void)argc;
+	(void)argv;
+
+	try
+	{
+		test_transform();
+		test_project();
+		test_partial();
+	}
+	catch (std::exception const &e)
+	{
+		std::cerr << "=============================== CAUGHT EXCEPTION ===============================" << std::endl;
+		std::cerr << e.what() << std::endl;
+		std::cerr << "================================================================================" << std::endl;
+
+		return 1;
+	}
+
+	return 0;
+}
+
+void test_transform()
+{
+	auto const m = translate4x4(1.f, 2.f, 3.f) * rotate4x4(normalize(Vector3{1.f, 1.f, 0.f}), .5f);
+
+	std::vector<Vector4> a(N);
+	std::vector<Vector4> b(N);
+
+	for (std::size_t i = 0; i < N; i++)
+	{
+		a[i] = Vector4{value(i, 0), value(i, 1), value(i, 2), 1.f};
+	}
+
+	transform_batch(b.data(), m, a.data(), N);
+
+	for (auto chunk : {std::size_t(1), std::size_t(64), std::size_t(1000), std::size_t(4096)})
+	{
+		auto *in = input(a.data(), N);
+		auto *out = std::tmpfile();
+
+		StreamStats stats;
+
+		if (!transform_stream(fileno(in), fileno(out), m, chunk, &stats) ||
+		    stats.read != N || stats.written != N)
+		{
+			throw std::logic_error("@see " __FILE__ ":" STRINGIZE(__LINE__));
+		}
+
+		auto const c = output<Vector4>(out);
+
+		std::fclose(in);
+		std::fclose(out);
+
+		for (std::size_t i = 0; i < N; i++)
+		{
+			for (int j = 0; j < 4; j++)
+			{
+				if (c.size() != N || c[i].data[j] != b[i].data[j])
+				{
+					throw std::logic_error("@see " __FILE__ ":" STRINGIZE(__LINE__));
+				}
+			}
+		}
+	}
+}
+
+void test_project()
+{
+	auto const v = Viewport{0.f, 0.f, 640.f, 480.f};
+	auto const m = persp_projection4x4(1.f, .75f, 1.f, 100.f) *
+		       lookat4x4(Vector3{0.f, 1.f, 0.f}, Vector3{0.f, 0.f, 0.f}, Vector3{0.f, 0.f, -5.f});
+
+	std::vector<Vector3> a(N);
+	std::vector<Vector3> s(N);
+	std::vector<std::uint32_t> k(N);
+
+	for (std::size_t i = 0; i < N; i++)
+	{
+		a[i] = Vector3{value(i, 0), value(i, 1), value(i, 2)};
+	}
+
+	auto const n = project_batch(static_cast<Vector4 *>(nullptr), static_cast<Vector3 *>(nullptr), s.data(),
+				     static_cast<std::uint8_t *>(nullptr), m, v, a.data(), N, k.data());
+
+	auto *in = input(a.data(), N);
+	auto *out = std::tmpfile();
+
+	StreamStats stats;
+
+	if (n == 0 || n == N ||
+	    !project_stream(fileno(in), fileno(out), m, v, 100, &stats) ||
+	    stats.read != N || stats.written != n)
+	{
+		throw std::logic_error("@see " __FILE__ ":" STRINGIZE(__LINE__));
+	}
+
+	auto const c = output<Vector3>(out);
+
+	std::fclose(in);
+	std::fclose(out);
+
+	if (c.size() != n)
+	{
+		throw std::logic_error("@see " __FILE__ ":" STRINGIZE(__LINE__));
+	}
+
+	for (std::size_t i = 0; i < n; i++)
+	{
+		for (int j = 0; j < 3; j++)
+		{
+			if (std::abs(c[i].data[j] - s[k[i]].data[j]) > 1E-3f)
+			{
+				throw std::logic_error("@see " __FILE__ ":" STRINGIZE(__LINE__));
+			}
+		}
+	}
+}
+
+void test_partial()
+{
+	float const a[7] = {};
+
+	auto *in = input(a, 7); // one and three quarters of a Vector4
+	auto *out = std::tmpfile();
+
+	StreamStats stats;
+
+	if (transform_stream(fileno(in), fileno(out), Matrix4x4{}, 16, &stats))
+	{
+		throw std::logic_error("@see " __FILE__ ":" STRINGIZE(__LINE__));
+	}
+
+	//
+	// a zero chunk would never read anything
+	//
+
+	std::rewind(in);
+
+	if (transform_stream(fileno(in), fileno(out), Matrix4x4{}, 0, &stats) || stats.read != 0)
+	{
+		throw std::logic_error("@see " __FILE__ ":" STRINGIZE(__LINE__));
+	}
+
+	std::fclose(in);
+	std::fclose(out);
+}
\ No newline at end of file
@@ -34,6 +34,7 @@ void test_div();
 void test_dot();
 void test_len();
 void test_crs();
+void test_nrm();
 
 inline bool eq(Vector3 const &a,
 	       Vector3 const &b) 
@@ -64,6 +65,7 @@ int main(int argc, char *argv[])
 		test_dot();
 		test_len();
 		test_crs();
+		test_nrm();
 	}
 	catch (std::exception const &e)
 	{
@@ -327,4 +329,40 @@ void test_crs()
 	{
 		throw std::logic_error("@see " __FILE__ ":" STRINGIZE(__LINE__));
 	}
+}
+
+void test_nrm()
+{
+	auto a = const_cast<Vector3 const &>(A);
+	auto b = const_cast<Vector3 const &>(B);
+	auto c = const_cast<Vector3 const &>(C);
+
+	if (std::abs(len(normalize(a)) - 1.f) > EPS ||
+	    std::abs(len(normalize(b)) - 1.f) > EPS ||
+	    std::abs(len(normalize(c)) - 1.f) > EPS ||
+	    !eq(normalize(a) * len(a), a) ||
+	    !eq(normalize(b) * len(b), b) ||
+	    !eq(normalize(c) * len(c), c))
+	{
+		throw std::logic_error("@see " __FILE__ ":" STRINGIZE(__LINE__));
+	}
+
+	if (!eq(lerp(a, b, 0.f), a) ||
+	    !eq(lerp(a, b, 1.f), b) ||
+	    !eq(lerp(b, c, .25f), b + .25f * (c - b)) ||
+	    !eq(lerp(c, a, .75f), c + .75f * (a - c)))
+	{
+		throw std::logic_error("@see " __FILE__ ":" STRINGIZE(__LINE__));
+	}
+
+	auto const d = TVector3<double>{a.x(), a.y(), a.z()};
+	auto const e = TVector3<double>{b.x(), b.y(), b.z()};
+
+	if (std::abs(len(normalize(d)) - 1.) > 1E-12 ||
+	    std::abs(dot(d ^ e, d)) > 1E-9 ||
+	    std::abs(dot(d ^ e, e)) > 1E-9 ||
+	    std::abs(dot(lerp(d, e, .5) - .5 * (d + e), lerp(d, e, .5) - .5 * (d + e))) > 1E-12)
+	{
+		throw std::logic_error("@see " __FILE__ ":" STRINGIZE(__LINE__));
+	}
 }
\ No newline at end of file
@@ -34,6 +34,7 @@ void test_sub();
 void test_div();
 void test_dot();
 void test_len();
+void test_aln();
 
 inline bool eq(Vector4 const &a,
 	       Vector4 const &b) 
@@ -66,6 +67,7 @@ int main(int argc, char *argv[])
 		test_div();
 		test_dot();
 		test_len();
+		test_aln();
 	}
 	catch (std::exception const &e)
 	{
@@ -302,4 +304,37 @@ void test_len()
 	{
 		throw std::logic_error("@see " __FILE__ ":" STRINGIZE(__LINE__));
 	}
+}
+
+void test_aln()
+{
+	static_assert(alignof(Vector4A) == 16);
+	static_assert(alignof(TVector4A<double>) == 32);
+
+	auto a = const_cast<Vector4 const &>(A);
+	auto b = const_cast<Vector4 const &>(B);
+	auto c = const_cast<Vector4 const &>(C);
+
+	Vector4A const x = a;
+	Vector4A const y = b;
+	Vector4A const z = c;
+
+	if (!eq(x + y, a + b) ||
+	    !eq(y - z, b - c) ||
+	    !eq(z * x, c * a) ||
+	    !eq(x / y, a / b))
+	{
+		throw std::logic_error("@see " __FILE__ ":" STRINGIZE(__LINE__));
+	}
+
+	TVector4A<double> const u = {a.x(), a.y(), a.z(), a.w()};
+	TVector4A<double> const v = {b.x(), b.y(), b.z(), b.w()};
+
+	if (!eq(vector_cast<float>(u + v), a + b) ||
+	    !eq(vector_cast<float>(u - v), a - b) ||
+	    !eq(vector_cast<float>(u * v), a * b) ||
+	    !eq(vector_cast<float>(u / v), a / b))
+	{
+		throw std::logic_error("@see " __FILE__ ":" STRINGIZE(__LINE__));
+	}
 }
\ No newline at end of file